@@ -92,8 +92,17 @@ struct TrueTypeCmap
     int offset;
     int len;
     int fmt;
+    int nLookups; // number of mapCodeToGID calls so far
+    unsigned short *gidMap; // code-to-GID array (format 4 only, built
+                            //   after cmapMapThreshold lookups)
 };
 
+// Number of lookups through a format 4 cmap after which the whole
+// subtable is expanded into a code-to-GID array.  This keeps simple
+// fonts (a few hundred lookups) on the binary search and moves CID
+// fonts, which map every code in the collection, to the array.
+#define cmapMapThreshold 1024
+
 struct TrueTypeLoca
 {
     int idx;
@@ -467,6 +476,7 @@ FoFiTrueType::FoFiTrueType(const char *fileA, int lenA, bool freeFileDataA, int
     : FoFiBase(fileA, lenA, freeFileDataA)
 {
     tables = NULL;
+    sortedTables = NULL;
     nTables = 0;
     cmaps = NULL;
     nCmaps = 0;
@@ -479,7 +489,13 @@ FoFiTrueType::FoFiTrueType(const char *fileA, int lenA, bool freeFileDataA, int
 
 FoFiTrueType::~FoFiTrueType()
 {
+    int i;
+
     free(tables);
+    free(sortedTables);
+    for (i = 0; i < nCmaps; ++i) {
+        free(cmaps[i].gidMap);
+    }
     free(cmaps);
     if (nameToGID) {
         delete nameToGID;
@@ -524,6 +540,14 @@ int FoFiTrueType::mapCodeToGID(int i, int c)
     if (i < 0 || i >= nCmaps) {
         return 0;
     }
+    if (cmaps[i].fmt == 4) {
+        if (!cmaps[i].gidMap && ++cmaps[i].nLookups == cmapMapThreshold) {
+            buildCmapMap(i);
+        }
+        if (cmaps[i].gidMap) {
+            return (c >= 0 && c <= 0xffff) ? cmaps[i].gidMap[c] : 0;
+        }
+    }
     ok = true;
     pos = cmaps[i].offset;
     switch (cmaps[i].fmt) {
@@ -605,6 +629,64 @@ int FoFiTrueType::mapCodeToGID(int i, int c)
     return gid;
 }
 
+// Expand format 4 cmap <i> into a code-to-GID array which gives the
+// same results as the binary search in mapCodeToGID.  The search picks
+// the first segment whose end is >= the code, which only partitions
+// the code space when the segment ends are in order; subtables with
+// unordered ends are left on the search.
+void FoFiTrueType::buildCmapMap(int i)
+{
+    unsigned short *map;
+    int             segCnt, segEnd, segStart, segDelta, segOffset;
+    int             pos, gid, prevEnd, b, c;
+    bool            ok, ok2;
+
+    ok = true;
+    pos = cmaps[i].offset;
+    segCnt = getU16BE(pos + 6, &ok) / 2;
+    if (!ok || segCnt < 1) {
+        return;
+    }
+    prevEnd = 0;
+    for (b = 0; b < segCnt; ++b) {
+        segEnd = getU16BE(pos + 14 + 2 * b, &ok);
+        if (!ok || segEnd < prevEnd) {
+            return;
+        }
+        prevEnd = segEnd;
+    }
+
+    map = (unsigned short *)calloc(0x10000, sizeof(unsigned short));
+    c = 0;
+    for (b = 0; b < segCnt; ++b) {
+        ok = true;
+        segEnd = getU16BE(pos + 14 + 2 * b, &ok);
+        segStart = getU16BE(pos + 16 + 2 * segCnt + 2 * b, &ok);
+        segDelta = getU16BE(pos + 16 + 4 * segCnt + 2 * b, &ok);
+        segOffset = getU16BE(pos + 16 + 6 * segCnt + 2 * b, &ok);
+        if (ok) {
+            for (c = std::max(c, segStart); c <= segEnd; ++c) {
+                if (segOffset == 0) {
+                    gid = (c + segDelta) & 0xffff;
+                } else {
+                    ok2 = true;
+                    gid = getU16BE(pos + 16 + 6 * segCnt + 2 * b + segOffset +
+                                       2 * (c - segStart),
+                                   &ok2);
+                    if (!ok2) {
+                        gid = 0;
+                    } else if (gid != 0) {
+                        gid = (gid + segDelta) & 0xffff;
+                    }
+                }
+                map[c] = (unsigned short)gid;
+            }
+        }
+        c = segEnd + 1;
+    }
+    cmaps[i].gidMap = map;
+}
+
 int FoFiTrueType::mapNameToGID(char *name)
 {
     if (!nameToGID) {
@@ -1917,6 +1999,7 @@ void FoFiTrueType::cvtSfnts(FoFiOutputFunc outputFunc, void *outputStream,
             length = 54;
             checksum = computeTableChecksum(headData, 54);
         } else if (i == t42LocaTable) {
+            length = (int)locaData.size();
             checksum = checksum_of(locaData);
         } else if (i == t42GlyfTable) {
             length = 0;
@@ -2086,16 +2169,19 @@ void FoFiTrueType::cvtSfnts(FoFiOutputFunc outputFunc, void *outputStream,
 void FoFiTrueType::dumpString(const unsigned char *s, size_t n,
                               FoFiOutputFunc pfun, void *pstream)
 {
-    GString *buf;
+    static const char hexChars[17] = "0123456789abcdef";
+    char              buf[64];
+    size_t            k;
 
     (*pfun)(pstream, "<", 1);
 
     for (size_t i = 0; i < n; i += 32) {
+        k = 0;
         for (size_t j = 0; j < 32 && i + j < n; ++j) {
-            buf = GString::format("{0:02x}", s[i + j] & 0xff);
-            (*pfun)(pstream, buf->c_str(), buf->getLength());
-            delete buf;
+            buf[k++] = hexChars[s[i + j] >> 4];
+            buf[k++] = hexChars[s[i + j] & 0x0f];
         }
+        (*pfun)(pstream, buf, (int)k);
 
         if (i % (65536 - 32) == 65536 - 64) {
             (*pfun)(pstream, ">\n<", 3);
@@ -2209,6 +2295,16 @@ void FoFiTrueType::parse(int fontNum, bool allowHeadlessCFF)
         return;
     }
 
+    // index the table directory by tag -- the stable sort keeps the
+    // first of any duplicate tags in front, as the linear search did
+    sortedTables = (int *)calloc(nTables, sizeof(int));
+    for (i = 0; i < nTables; ++i) {
+        sortedTables[i] = i;
+    }
+    std::stable_sort(sortedTables, sortedTables + nTables, [this](int a, int b) {
+        return tables[a].tag < tables[b].tag;
+    });
+
     // check for the head table; allow for a head-less OpenType CFF font
     headlessCFF = false;
     if (seekTable("head") < 0) {
@@ -2375,10 +2471,11 @@ void FoFiTrueType::parseDfont(int fontNum, int *offset, int *startPos)
 
 void FoFiTrueType::readPostTable()
 {
-    GString *name;
-    int      tablePos, postFmt, stringIdx, stringPos;
-    bool     ok;
-    int      i, j, n, m;
+    GString *          name;
+    std::vector< int > stringPos;
+    int                tablePos, postFmt;
+    bool               ok;
+    int                i, j, n, m;
 
     ok = true;
     if ((i = seekTable("post")) < 0) {
@@ -2403,8 +2500,10 @@ void FoFiTrueType::readPostTable()
         if (n > nGlyphs) {
             n = nGlyphs;
         }
-        stringIdx = 0;
-        stringPos = tablePos + 34 + 2 * n;
+        // stringPos[k] = position of the k-th Pascal string, filled in
+        // as far as the glyph name indexes have reached, so glyphs that
+        // refer to the strings out of order don't rescan the table
+        stringPos.push_back(tablePos + 34 + 2 * n);
         for (i = 0; i < n; ++i) {
             j = getU16BE(tablePos + 34 + 2 * i, &ok);
             if (j < 258) {
@@ -2412,24 +2511,20 @@ void FoFiTrueType::readPostTable()
                 nameToGID->add(new GString(macGlyphNames[j]), i);
             } else {
                 j -= 258;
-                if (j != stringIdx) {
-                    for (stringIdx = 0, stringPos = tablePos + 34 + 2 * n;
-                         stringIdx < j;
-                         ++stringIdx, stringPos += 1 + getU8(stringPos, &ok))
-                        ;
+                while ((int)stringPos.size() <= j) {
+                    stringPos.push_back(stringPos.back() + 1 +
+                                        getU8(stringPos.back(), &ok));
                     if (!ok) {
                         goto err;
                     }
                 }
-                m = getU8(stringPos, &ok);
-                if (!ok || !checkRegion(stringPos + 1, m)) {
+                m = getU8(stringPos[j], &ok);
+                if (!ok || !checkRegion(stringPos[j] + 1, m)) {
                     goto err;
                 }
-                name = new GString((char *)&file[stringPos + 1], m);
+                name = new GString((char *)&file[stringPos[j] + 1], m);
                 nameToGID->removeInt(name);
                 nameToGID->add(name, i);
-                ++stringIdx;
-                stringPos += 1 + m;
             }
         }
     } else if (postFmt == 0x00028000) {
@@ -2458,14 +2553,17 @@ err:
 int FoFiTrueType::seekTable(const char *tag)
 {
     unsigned tagI;
-    int      i;
+    int *    p;
 
+    if (!sortedTables) {
+        return -1;
+    }
     tagI = ((tag[0] & 0xff) << 24) | ((tag[1] & 0xff) << 16) |
            ((tag[2] & 0xff) << 8) | (tag[3] & 0xff);
-    for (i = 0; i < nTables; ++i) {
-        if (tables[i].tag == tagI) {
-            return i;
-        }
+    p = std::lower_bound(sortedTables, sortedTables + nTables, tagI,
+                         [this](int a, unsigned t) { return tables[a].tag < t; });
+    if (p < sortedTables + nTables && tables[*p].tag == tagI) {
+        return *p;
     }
     return -1;
 }
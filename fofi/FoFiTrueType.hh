@@ -184,8 +184,10 @@ private:
     void parseDfont(int fontNum, int *offset, int *pos);
     void readPostTable();
     int  seekTable(const char *tag);
+    void buildCmapMap(int i);
 
     TrueTypeTable *tables;
+    int *          sortedTables; // table indexes, sorted by tag
     int            nTables;
     TrueTypeCmap * cmaps;
     int            nCmaps;
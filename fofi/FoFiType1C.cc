@@ -13,6 +13,7 @@
 //------------------------------------------------------------------------
 
 static char hexChars[17] = "0123456789ABCDEF";
+static char lowerHexChars[17] = "0123456789abcdef";
 
 //------------------------------------------------------------------------
 // FoFiType1C
@@ -309,6 +310,8 @@ void FoFiType1C::convertToType1(const char *psName, const char **newEncoding,
     eb.ascii = ascii;
     eb.r1 = 55665;
     eb.line = 0;
+    eb.bufLen = 0;
+    eb.charBuf = new GString();
 
     // write the private dictionary
     eexecWrite(&eb, "\x83\xca\x73\xd5");
@@ -479,6 +482,8 @@ void FoFiType1C::convertToType1(const char *psName, const char **newEncoding,
     eexecWrite(&eb, "noaccess put\n");
     eexecWrite(&eb, "dup /FontName get exch definefont pop\n");
     eexecWrite(&eb, "mark currentfile closefile\n");
+    eexecFlush(&eb);
+    delete eb.charBuf;
 
     // trailer
     if (ascii && eb.line > 0) {
@@ -500,13 +505,14 @@ void FoFiType1C::convertToCIDType0(const char *psName, int *codeMap, int nCodes,
     int *          cidMap;
     GString *      charStrings;
     int *          charStringOffsets;
-    Type1CIndex    subrIdx;
+    Type1CIndex    subrIdx[256];
+    bool           subrIdxOk[256];
     Type1CIndexVal val;
     int            nCIDs, gdBytes;
     GString *      buf;
-    char           buf2[256];
+    char           buf2[256], hexBuf[80];
     bool           ok;
-    int            gid, offset, n, i, j, k;
+    int            gid, fd, offset, n, i, j, k, m;
 
     // compute the CID count and build the CID-to-GID mapping
     if (codeMap) {
@@ -541,22 +547,29 @@ void FoFiType1C::convertToCIDType0(const char *psName, int *codeMap, int nCodes,
         }
     }
 
-    // build the charstrings
+    // build the charstrings (the subroutine index is read once per FD,
+    // when the first glyph using that FD comes up)
     charStrings = new GString();
     charStringOffsets = (int *)calloc(nCIDs + 1, sizeof(int));
+    for (fd = 0; fd < 256; ++fd) {
+        subrIdxOk[fd] = false;
+    }
     for (i = 0; i < nCIDs; ++i) {
         charStringOffsets[i] = charStrings->getLength();
         if ((gid = cidMap[i]) >= 0) {
             ok = true;
             getIndexVal(&charStringsIdx, gid, &val, &ok);
             if (ok) {
-                getIndex(privateDicts[fdSelect ? fdSelect[gid] : 0].subrsOffset,
-                         &subrIdx, &ok);
-                if (!ok) {
-                    subrIdx.pos = -1;
+                fd = fdSelect ? fdSelect[gid] : 0;
+                if (!subrIdxOk[fd]) {
+                    getIndex(privateDicts[fd].subrsOffset, &subrIdx[fd], &ok);
+                    if (!ok) {
+                        subrIdx[fd].pos = -1;
+                    }
+                    subrIdxOk[fd] = true;
                 }
-                cvtGlyph(val.pos, val.len, charStrings, &subrIdx,
-                         &privateDicts[fdSelect ? fdSelect[gid] : 0], true);
+                cvtGlyph(val.pos, val.len, charStrings, &subrIdx[fd],
+                         &privateDicts[fd], true);
             }
         }
     }
@@ -822,6 +835,7 @@ void FoFiType1C::convertToCIDType0(const char *psName, int *codeMap, int nCodes,
 
     // write the charstring offset (CIDMap) table
     for (i = 0; i <= nCIDs; i += 6) {
+        m = 0;
         for (j = 0; j < 6 && i + j <= nCIDs; ++j) {
             if (i + j < nCIDs && cidMap[i + j] >= 0 && fdSelect) {
                 buf2[0] = (char)fdSelect[cidMap[i + j]];
@@ -834,26 +848,27 @@ void FoFiType1C::convertToCIDType0(const char *psName, int *codeMap, int nCodes,
                 n >>= 8;
             }
             for (k = 0; k <= gdBytes; ++k) {
-                buf = GString::format("{0:02x}", buf2[k] & 0xff);
-                (*outputFunc)(outputStream, buf->c_str(), buf->getLength());
-                delete buf;
+                hexBuf[m++] = lowerHexChars[(buf2[k] >> 4) & 0x0f];
+                hexBuf[m++] = lowerHexChars[buf2[k] & 0x0f];
             }
         }
-        (*outputFunc)(outputStream, "\n", 1);
+        hexBuf[m++] = '\n';
+        (*outputFunc)(outputStream, hexBuf, m);
     }
 
     // write the charstring data
     n = charStrings->getLength();
     for (i = 0; i < n; i += 32) {
+        m = 0;
         for (j = 0; j < 32 && i + j < n; ++j) {
-            buf = GString::format("{0:02x}", (*charStrings)[i + j] & 0xff);
-            (*outputFunc)(outputStream, buf->c_str(), buf->getLength());
-            delete buf;
+            hexBuf[m++] = lowerHexChars[((*charStrings)[i + j] >> 4) & 0x0f];
+            hexBuf[m++] = lowerHexChars[(*charStrings)[i + j] & 0x0f];
         }
         if (i + 32 >= n) {
-            (*outputFunc)(outputStream, ">", 1);
+            hexBuf[m++] = '>';
         }
-        (*outputFunc)(outputStream, "\n", 1);
+        hexBuf[m++] = '\n';
+        (*outputFunc)(outputStream, hexBuf, m);
     }
 
     free(charStringOffsets);
@@ -869,6 +884,7 @@ void FoFiType1C::convertToType0(const char *psName, int *codeMap, int nCodes,
     Type1CIndexVal val;
     int            nCIDs;
     GString *      buf;
+    char           glyphName[8];
     Type1CEexecBuf eb;
     bool           ok;
     int            fd, i, j, k;
@@ -981,6 +997,8 @@ void FoFiType1C::convertToType0(const char *psName, int *codeMap, int nCodes,
         eb.ascii = true;
         eb.r1 = 55665;
         eb.line = 0;
+        eb.bufLen = 0;
+        eb.charBuf = new GString();
 
         // start the private dictionary
         eexecWrite(&eb, "\x83\xca\x73\xd5");
@@ -1150,10 +1168,9 @@ void FoFiType1C::convertToType0(const char *psName, int *codeMap, int nCodes,
                 ok = true;
                 getIndexVal(&charStringsIdx, cidMap[i + j], &val, &ok);
                 if (ok) {
-                    buf = GString::format("c{0:02x}", j);
-                    eexecCvtGlyph(&eb, buf->c_str(), val.pos, val.len, &subrIdx,
+                    snprintf(glyphName, sizeof(glyphName), "c%02x", j);
+                    eexecCvtGlyph(&eb, glyphName, val.pos, val.len, &subrIdx,
                                   &privateDicts[fd]);
-                    delete buf;
                 }
             }
         }
@@ -1163,6 +1180,8 @@ void FoFiType1C::convertToType0(const char *psName, int *codeMap, int nCodes,
         eexecWrite(&eb, "noaccess put\n");
         eexecWrite(&eb, "dup /FontName get exch definefont pop\n");
         eexecWrite(&eb, "mark currentfile closefile\n");
+        eexecFlush(&eb);
+        delete eb.charBuf;
 
         // trailer
         if (eb.line > 0) {
@@ -1221,21 +1240,19 @@ void FoFiType1C::eexecCvtGlyph(Type1CEexecBuf *eb, const char *glyphName,
                                int offset, int nBytes, Type1CIndex *subrIdx,
                                Type1CPrivateDict *pDict)
 {
-    GString *buf;
+    char     buf[300];
     GString *charBuf;
 
-    // generate the charstring
-    charBuf = new GString();
+    // generate the charstring, reusing the conversion's buffer
+    charBuf = eb->charBuf;
+    charBuf->clear();
     cvtGlyph(offset, nBytes, charBuf, subrIdx, pDict, true);
 
-    buf = GString::format("/{0:s} {1:d} RD ", glyphName, charBuf->getLength());
-    eexecWrite(eb, buf->c_str());
-    delete buf;
+    snprintf(buf, sizeof(buf), "/%s %d RD ", glyphName, charBuf->getLength());
+    eexecWrite(eb, buf);
     eexecWriteCharstring(eb, (unsigned char *)charBuf->c_str(),
                          charBuf->getLength());
     eexecWrite(eb, " ND\n");
-
-    delete charBuf;
 }
 
 void FoFiType1C::cvtGlyph(int offset, int nBytes, GString *charBuf,
@@ -1960,24 +1977,7 @@ void FoFiType1C::cvtNum(double x, bool isFP, GString *charBuf)
 
 void FoFiType1C::eexecWrite(Type1CEexecBuf *eb, const char *s)
 {
-    unsigned char *p;
-    unsigned char  x;
-
-    for (p = (unsigned char *)s; *p; ++p) {
-        x = *p ^ (eb->r1 >> 8);
-        eb->r1 = (x + eb->r1) * 52845 + 22719;
-        if (eb->ascii) {
-            (*eb->outputFunc)(eb->outputStream, &hexChars[x >> 4], 1);
-            (*eb->outputFunc)(eb->outputStream, &hexChars[x & 0x0f], 1);
-            eb->line += 2;
-            if (eb->line == 64) {
-                (*eb->outputFunc)(eb->outputStream, "\n", 1);
-                eb->line = 0;
-            }
-        } else {
-            (*eb->outputFunc)(eb->outputStream, (char *)&x, 1);
-        }
-    }
+    eexecWriteCharstring(eb, (unsigned char *)s, (int)strlen(s));
 }
 
 void FoFiType1C::eexecWriteCharstring(Type1CEexecBuf *eb, unsigned char *s, int n)
@@ -1985,21 +1985,33 @@ void FoFiType1C::eexecWriteCharstring(Type1CEexecBuf *eb, unsigned char *s, int
     unsigned char x;
     int           i;
 
-    // eexec encryption
+    // eexec encryption -- the output is collected in eb->buf, which
+    // always has room for one more hex pair plus newline
     for (i = 0; i < n; ++i) {
         x = s[i] ^ (eb->r1 >> 8);
         eb->r1 = (x + eb->r1) * 52845 + 22719;
         if (eb->ascii) {
-            (*eb->outputFunc)(eb->outputStream, &hexChars[x >> 4], 1);
-            (*eb->outputFunc)(eb->outputStream, &hexChars[x & 0x0f], 1);
+            eb->buf[eb->bufLen++] = hexChars[x >> 4];
+            eb->buf[eb->bufLen++] = hexChars[x & 0x0f];
             eb->line += 2;
             if (eb->line == 64) {
-                (*eb->outputFunc)(eb->outputStream, "\n", 1);
+                eb->buf[eb->bufLen++] = '\n';
                 eb->line = 0;
             }
         } else {
-            (*eb->outputFunc)(eb->outputStream, (char *)&x, 1);
+            eb->buf[eb->bufLen++] = (char)x;
         }
+        if (eb->bufLen > type1CEexecBufSize - 3) {
+            eexecFlush(eb);
+        }
+    }
+}
+
+void FoFiType1C::eexecFlush(Type1CEexecBuf *eb)
+{
+    if (eb->bufLen > 0) {
+        (*eb->outputFunc)(eb->outputStream, eb->buf, eb->bufLen);
+        eb->bufLen = 0;
     }
 }
 
@@ -113,6 +113,8 @@ struct Type1COp
     };
 };
 
+#define type1CEexecBufSize 4096
+
 struct Type1CEexecBuf
 {
     FoFiOutputFunc outputFunc;
@@ -120,6 +122,9 @@ struct Type1CEexecBuf
     bool           ascii; // ASCII encoding?
     unsigned short r1; // eexec encryption key
     int            line; // number of eexec chars left on current line
+    char           buf[type1CEexecBufSize]; // pending (encrypted) output
+    int            bufLen; // number of bytes in buf
+    GString *      charBuf; // charstring buffer, reused for each glyph
 };
 
 //------------------------------------------------------------------------
@@ -198,6 +203,7 @@ private:
     void  cvtNum(double x, bool isFP, GString *charBuf);
     void  eexecWrite(Type1CEexecBuf *eb, const char *s);
     void  eexecWriteCharstring(Type1CEexecBuf *eb, unsigned char *s, int n);
+    void  eexecFlush(Type1CEexecBuf *eb);
     void  writePSString(char *s, FoFiOutputFunc outputFunc, void *outputStream);
     bool  parse();
     void  readTopDict();
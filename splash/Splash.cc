@@ -13,10 +13,14 @@
 #include <splash/SplashPath.hh>
 #include <splash/SplashXPath.hh>
 #include <splash/SplashXPathScanner.hh>
+#include <splash/SplashThinStroke.hh>
 #include <splash/SplashPattern.hh>
 #include <splash/SplashScreen.hh>
 #include <splash/SplashFont.hh>
 #include <splash/SplashGlyphBitmap.hh>
+#include <splash/SplashScaleKernels.hh>
+#include <splash/SplashSpanKernels.hh>
+#include <splash/SplashBands.hh>
 #include <splash/Splash.hh>
 
 //------------------------------------------------------------------------
@@ -59,6 +63,9 @@ struct ImageSection
 
 #define splashPipeMaxStages 9
 
+// pixels per chunk in pipeRunTransp -- a multiple of splashVecSize
+#define splashPipeSpanSize 256
+
 struct SplashPipe
 {
     // source pattern
@@ -85,17 +92,20 @@ struct SplashPipe
 
 SplashPipeResultColorCtrl Splash::pipeResultColorNoAlphaBlend[] = {
     splashPipeResultColorNoAlphaBlendMono, splashPipeResultColorNoAlphaBlendMono,
-    splashPipeResultColorNoAlphaBlendRGB, splashPipeResultColorNoAlphaBlendRGB
+    splashPipeResultColorNoAlphaBlendRGB, splashPipeResultColorNoAlphaBlendRGB,
+    splashPipeResultColorNoAlphaBlendRGB
 };
 
 SplashPipeResultColorCtrl Splash::pipeResultColorAlphaNoBlend[] = {
     splashPipeResultColorAlphaNoBlendMono, splashPipeResultColorAlphaNoBlendMono,
-    splashPipeResultColorAlphaNoBlendRGB, splashPipeResultColorAlphaNoBlendRGB
+    splashPipeResultColorAlphaNoBlendRGB, splashPipeResultColorAlphaNoBlendRGB,
+    splashPipeResultColorAlphaNoBlendRGB
 };
 
 SplashPipeResultColorCtrl Splash::pipeResultColorAlphaBlend[] = {
     splashPipeResultColorAlphaBlendMono, splashPipeResultColorAlphaBlendMono,
-    splashPipeResultColorAlphaBlendRGB, splashPipeResultColorAlphaBlendRGB
+    splashPipeResultColorAlphaBlendRGB, splashPipeResultColorAlphaBlendRGB,
+    splashPipeResultColorAlphaBlendRGB
 };
 
 //------------------------------------------------------------------------
@@ -114,8 +124,18 @@ static void blendXor(SplashColorPtr src, SplashColorPtr dest,
 // modified region
 //------------------------------------------------------------------------
 
+void Splash::getModRegion(int *xMin, int *yMin, int *xMax, int *yMax)
+{
+    flush();
+    *xMin = modXMin;
+    *yMin = modYMin;
+    *xMax = modXMax;
+    *yMax = modYMax;
+}
+
 void Splash::clearModRegion()
 {
+    flush();
     modXMin = bitmap->getWidth();
     modYMin = bitmap->getHeight();
     modXMax = -1;
@@ -196,6 +216,8 @@ inline void Splash::pipeInit(SplashPipe *pipe, SplashPattern *pattern,
             pipe->run = &Splash::pipeRunSimpleRGB8;
         } else if (bitmap->mode == splashModeBGR8 && bitmap->alpha) {
             pipe->run = &Splash::pipeRunSimpleBGR8;
+        } else if (bitmap->mode == splashModeXBGR8 && bitmap->alpha) {
+            pipe->run = &Splash::pipeRunSimpleXBGR8;
         }
     } else if (!pipe->pattern && pipe->shapeOnly && !state->blendFunc) {
         if (bitmap->mode == splashModeMono1 && !bitmap->alpha) {
@@ -206,6 +228,8 @@ inline void Splash::pipeInit(SplashPipe *pipe, SplashPattern *pattern,
             pipe->run = &Splash::pipeRunShapeRGB8;
         } else if (bitmap->mode == splashModeBGR8 && bitmap->alpha) {
             pipe->run = &Splash::pipeRunShapeBGR8;
+        } else if (bitmap->mode == splashModeXBGR8 && bitmap->alpha) {
+            pipe->run = &Splash::pipeRunShapeXBGR8;
         }
     } else if (!pipe->pattern && !pipe->noTransparency && !state->softMask &&
                usesShape &&
@@ -220,6 +244,20 @@ inline void Splash::pipeInit(SplashPipe *pipe, SplashPattern *pattern,
             pipe->run = &Splash::pipeRunAARGB8;
         } else if (bitmap->mode == splashModeBGR8 && bitmap->alpha) {
             pipe->run = &Splash::pipeRunAABGR8;
+        } else if (bitmap->mode == splashModeXBGR8 && bitmap->alpha) {
+            pipe->run = &Splash::pipeRunAAXBGR8;
+        }
+    }
+    if (pipe->run == &Splash::pipeRun && !state->inKnockoutGroup &&
+        (!pipe->noTransparency || state->blendFunc)) {
+        if (bitmap->mode == splashModeMono8) {
+            pipe->run = &Splash::pipeRunTranspMono8;
+        } else if (bitmap->mode == splashModeRGB8) {
+            pipe->run = &Splash::pipeRunTranspRGB8;
+        } else if (bitmap->mode == splashModeBGR8) {
+            pipe->run = &Splash::pipeRunTranspBGR8;
+        } else if (bitmap->mode == splashModeXBGR8) {
+            pipe->run = &Splash::pipeRunTranspXBGR8;
         }
     }
 }
@@ -274,7 +312,7 @@ void Splash::pipeRun(SplashPipe *pipe, int x0, int x1, int y,
         destColorPtr = &bitmap->data[y * bitmap->rowSize + (x0 >> 3)];
         destColorMask = 0x80 >> (x0 & 7);
     } else {
-        destColorPtr = &bitmap->data[y * bitmap->rowSize + x0 * bitmapComps];
+        destColorPtr = &bitmap->data[y * bitmap->rowSize + x0 * bitmapPixelSize];
         destColorMask = 0; // make gcc happy
     }
     if (bitmap->alpha) {
@@ -296,7 +334,7 @@ void Splash::pipeRun(SplashPipe *pipe, int x0, int x1, int y,
         } else {
             color0Ptr = &groupBackBitmap
                              ->data[(groupBackY + y) * groupBackBitmap->rowSize +
-                                    (groupBackX + x0) * bitmapComps];
+                                    (groupBackX + x0) * bitmapPixelSize];
             color0Mask = 0; // make gcc happy
         }
     } else {
@@ -320,7 +358,7 @@ void Splash::pipeRun(SplashPipe *pipe, int x0, int x1, int y,
                 destColorPtr += destColorMask & 1;
                 destColorMask = (destColorMask << 7) | (destColorMask >> 1);
             } else {
-                destColorPtr += bitmapComps;
+                destColorPtr += bitmapPixelSize;
             }
             if (destAlphaPtr) {
                 ++destAlphaPtr;
@@ -333,7 +371,7 @@ void Splash::pipeRun(SplashPipe *pipe, int x0, int x1, int y,
                     color0Ptr += color0Mask & 1;
                     color0Mask = (color0Mask << 7) | (color0Mask >> 1);
                 } else {
-                    color0Ptr += bitmapComps;
+                    color0Ptr += bitmapPixelSize;
                 }
             }
             if (alpha0Ptr) {
@@ -384,6 +422,13 @@ void Splash::pipeRun(SplashPipe *pipe, int x0, int x1, int y,
                 destColorPtr[2] = state->rgbTransferR[cSrcPtr[0]];
                 destColorPtr += 3;
                 break;
+            case splashModeXBGR8:
+                destColorPtr[0] = state->rgbTransferB[cSrcPtr[2]];
+                destColorPtr[1] = state->rgbTransferG[cSrcPtr[1]];
+                destColorPtr[2] = state->rgbTransferR[cSrcPtr[0]];
+                destColorPtr[3] = 255;
+                destColorPtr += 4;
+                break;
             }
             if (destAlphaPtr) {
                 *destAlphaPtr++ = 255;
@@ -415,6 +460,12 @@ void Splash::pipeRun(SplashPipe *pipe, int x0, int x1, int y,
                     cDest[0] = color0Ptr[2];
                     color0Ptr += 3;
                     break;
+                case splashModeXBGR8:
+                    cDest[2] = color0Ptr[0];
+                    cDest[1] = color0Ptr[1];
+                    cDest[0] = color0Ptr[2];
+                    color0Ptr += 4;
+                    break;
                 }
             } else {
                 switch (bitmap->mode) {
@@ -430,6 +481,7 @@ void Splash::pipeRun(SplashPipe *pipe, int x0, int x1, int y,
                     cDest[2] = destColorPtr[2];
                     break;
                 case splashModeBGR8:
+                case splashModeXBGR8:
                     cDest[0] = destColorPtr[2];
                     cDest[1] = destColorPtr[1];
                     cDest[2] = destColorPtr[0];
@@ -473,6 +525,7 @@ void Splash::pipeRun(SplashPipe *pipe, int x0, int x1, int y,
                 switch (bitmap->mode) {
                 case splashModeRGB8:
                 case splashModeBGR8:
+                case splashModeXBGR8:
                     cSrc[2] = clip255(cSrc[2] + ((cSrc[2] - cDest[2]) * t) / 255);
                     cSrc[1] = clip255(cSrc[1] + ((cSrc[1] - cDest[1]) * t) / 255);
                 case splashModeMono1:
@@ -639,6 +692,13 @@ void Splash::pipeRun(SplashPipe *pipe, int x0, int x1, int y,
                 destColorPtr[2] = cResult0;
                 destColorPtr += 3;
                 break;
+            case splashModeXBGR8:
+                destColorPtr[0] = cResult2;
+                destColorPtr[1] = cResult1;
+                destColorPtr[2] = cResult0;
+                destColorPtr[3] = 255;
+                destColorPtr += 4;
+                break;
             }
             if (destAlphaPtr) {
                 *destAlphaPtr++ = aResult;
@@ -806,6 +866,45 @@ void Splash::pipeRunSimpleBGR8(SplashPipe *pipe, int x0, int x1, int y,
     }
 }
 
+// special case:
+// !pipe->pattern && pipe->noTransparency && !state->blendFunc &&
+// bitmap->mode == splashModeXBGR8 && bitmap->alpha) {
+void Splash::pipeRunSimpleXBGR8(SplashPipe *pipe, int x0, int x1, int y,
+                                unsigned char *shapePtr, SplashColorPtr cSrcPtr)
+{
+    SplashColorPtr destColorPtr;
+    unsigned char *destAlphaPtr;
+    int            cSrcStride, x;
+
+    if (cSrcPtr) {
+        cSrcStride = 3;
+    } else {
+        cSrcPtr = pipe->cSrcVal;
+        cSrcStride = 0;
+    }
+    if (x0 > x1) {
+        return;
+    }
+    updateModX(x0);
+    updateModX(x1);
+    updateModY(y);
+
+    destColorPtr = &bitmap->data[y * bitmap->rowSize + 4 * x0];
+    destAlphaPtr = &bitmap->alpha[y * bitmap->width + x0];
+
+    for (x = x0; x <= x1; ++x) {
+        //----- write destination pixel
+        destColorPtr[0] = state->rgbTransferB[cSrcPtr[2]];
+        destColorPtr[1] = state->rgbTransferG[cSrcPtr[1]];
+        destColorPtr[2] = state->rgbTransferR[cSrcPtr[0]];
+        destColorPtr[3] = 255;
+        destColorPtr += 4;
+        *destAlphaPtr++ = 255;
+
+        cSrcPtr += cSrcStride;
+    }
+}
+
 // special case:
 // !pipe->pattern && pipe->shapeOnly && !state->blendFunc &&
 // bitmap->mode == splashModeMono1 && !bitmap->alpha
@@ -1140,6 +1239,99 @@ void Splash::pipeRunShapeBGR8(SplashPipe *pipe, int x0, int x1, int y,
     updateModX(lastX);
 }
 
+// special case:
+// !pipe->pattern && pipe->shapeOnly && !state->blendFunc &&
+// bitmap->mode == splashModeXBGR8 && bitmap->alpha
+void Splash::pipeRunShapeXBGR8(SplashPipe *pipe, int x0, int x1, int y,
+                               unsigned char *shapePtr, SplashColorPtr cSrcPtr)
+{
+    unsigned char  shape, aSrc, aDest, alphaI, aResult;
+    unsigned char  cDest0, cDest1, cDest2;
+    unsigned char  cResult0, cResult1, cResult2;
+    SplashColorPtr destColorPtr;
+    unsigned char *destAlphaPtr;
+    int            cSrcStride, x, lastX;
+
+    if (cSrcPtr) {
+        cSrcStride = 3;
+    } else {
+        cSrcPtr = pipe->cSrcVal;
+        cSrcStride = 0;
+    }
+    for (; x0 <= x1; ++x0) {
+        if (*shapePtr) {
+            break;
+        }
+        cSrcPtr += cSrcStride;
+        ++shapePtr;
+    }
+    if (x0 > x1) {
+        return;
+    }
+    updateModX(x0);
+    updateModY(y);
+    lastX = x0;
+
+    destColorPtr = &bitmap->data[y * bitmap->rowSize + 4 * x0];
+    destAlphaPtr = &bitmap->alpha[y * bitmap->width + x0];
+
+    for (x = x0; x <= x1; ++x) {
+        //----- shape
+        shape = *shapePtr;
+        if (!shape) {
+            destColorPtr += 4;
+            ++destAlphaPtr;
+            cSrcPtr += cSrcStride;
+            ++shapePtr;
+            continue;
+        }
+        lastX = x;
+
+        //----- read destination pixel
+        cDest0 = destColorPtr[2];
+        cDest1 = destColorPtr[1];
+        cDest2 = destColorPtr[0];
+        aDest = *destAlphaPtr;
+
+        //----- source alpha
+        aSrc = shape;
+
+        //----- result alpha and non-isolated group element correction
+        aResult = aSrc + aDest - div255(aSrc * aDest);
+        alphaI = aResult;
+
+        //----- result color
+        if (alphaI == 0) {
+            cResult0 = 0;
+            cResult1 = 0;
+            cResult2 = 0;
+        } else {
+            cResult0 = state->rgbTransferR[(
+                unsigned char)(((alphaI - aSrc) * cDest0 + aSrc * cSrcPtr[0]) /
+                               alphaI)];
+            cResult1 = state->rgbTransferG[(
+                unsigned char)(((alphaI - aSrc) * cDest1 + aSrc * cSrcPtr[1]) /
+                               alphaI)];
+            cResult2 = state->rgbTransferB[(
+                unsigned char)(((alphaI - aSrc) * cDest2 + aSrc * cSrcPtr[2]) /
+                               alphaI)];
+        }
+
+        //----- write destination pixel
+        destColorPtr[0] = cResult2;
+        destColorPtr[1] = cResult1;
+        destColorPtr[2] = cResult0;
+        destColorPtr[3] = 255;
+        destColorPtr += 4;
+        *destAlphaPtr++ = aResult;
+
+        cSrcPtr += cSrcStride;
+        ++shapePtr;
+    }
+
+    updateModX(lastX);
+}
+
 // special case:
 // !pipe->pattern && !pipe->noTransparency && !state->softMask &&
 // pipe->usesShape && !pipe->alpha0Ptr && !state->blendFunc &&
@@ -1482,6 +1674,414 @@ void Splash::pipeRunAABGR8(SplashPipe *pipe, int x0, int x1, int y,
     updateModX(lastX);
 }
 
+// special case:
+// !pipe->pattern && !pipe->noTransparency && !state->softMask &&
+// pipe->usesShape && !pipe->alpha0Ptr && !state->blendFunc &&
+// !pipe->nonIsolatedGroup &&
+// bitmap->mode == splashModeXBGR8 && bitmap->alpha
+void Splash::pipeRunAAXBGR8(SplashPipe *pipe, int x0, int x1, int y,
+                            unsigned char *shapePtr, SplashColorPtr cSrcPtr)
+{
+    unsigned char  shape, aSrc, aDest, alphaI, aResult;
+    unsigned char  cDest0, cDest1, cDest2;
+    unsigned char  cResult0, cResult1, cResult2;
+    SplashColorPtr destColorPtr;
+    unsigned char *destAlphaPtr;
+    int            cSrcStride, x, lastX;
+
+    if (cSrcPtr) {
+        cSrcStride = 3;
+    } else {
+        cSrcPtr = pipe->cSrcVal;
+        cSrcStride = 0;
+    }
+    for (; x0 <= x1; ++x0) {
+        if (*shapePtr) {
+            break;
+        }
+        cSrcPtr += cSrcStride;
+        ++shapePtr;
+    }
+    if (x0 > x1) {
+        return;
+    }
+    updateModX(x0);
+    updateModY(y);
+    lastX = x0;
+
+    destColorPtr = &bitmap->data[y * bitmap->rowSize + 4 * x0];
+    destAlphaPtr = &bitmap->alpha[y * bitmap->width + x0];
+
+    for (x = x0; x <= x1; ++x) {
+        //----- shape
+        shape = *shapePtr;
+        if (!shape) {
+            destColorPtr += 4;
+            ++destAlphaPtr;
+            cSrcPtr += cSrcStride;
+            ++shapePtr;
+            continue;
+        }
+        lastX = x;
+
+        //----- read destination pixel
+        cDest0 = destColorPtr[2];
+        cDest1 = destColorPtr[1];
+        cDest2 = destColorPtr[0];
+        aDest = *destAlphaPtr;
+
+        //----- source alpha
+        aSrc = div255(pipe->aInput * shape);
+
+        //----- result alpha and non-isolated group element correction
+        aResult = aSrc + aDest - div255(aSrc * aDest);
+        alphaI = aResult;
+
+        //----- result color
+        if (alphaI == 0) {
+            cResult0 = 0;
+            cResult1 = 0;
+            cResult2 = 0;
+        } else {
+            cResult0 = state->rgbTransferR[(
+                unsigned char)(((alphaI - aSrc) * cDest0 + aSrc * cSrcPtr[0]) /
+                               alphaI)];
+            cResult1 = state->rgbTransferG[(
+                unsigned char)(((alphaI - aSrc) * cDest1 + aSrc * cSrcPtr[1]) /
+                               alphaI)];
+            cResult2 = state->rgbTransferB[(
+                unsigned char)(((alphaI - aSrc) * cDest2 + aSrc * cSrcPtr[2]) /
+                               alphaI)];
+        }
+
+        //----- write destination pixel
+        destColorPtr[0] = cResult2;
+        destColorPtr[1] = cResult1;
+        destColorPtr[2] = cResult0;
+        destColorPtr[3] = 255;
+        destColorPtr += 4;
+        *destAlphaPtr++ = aResult;
+
+        cSrcPtr += cSrcStride;
+        ++shapePtr;
+    }
+
+    updateModX(lastX);
+}
+
+// Same as the transparent cases of pipeRun, computed in chunks of up
+// to splashPipeSpanSize pixels, one stage at a time, with the span
+// kernels.  Color components are kept in separate planes, in RGB
+// order.
+inline void Splash::pipeRunTransp(SplashPipe *pipe, int x0, int x1, int y,
+                                  unsigned char *shapePtr,
+                                  SplashColorPtr cSrcPtr, SplashColorMode mode)
+{
+    unsigned char  shape[splashPipeSpanSize], aSrc[splashPipeSpanSize];
+    unsigned char  aDest[splashPipeSpanSize], alpha0[splashPipeSpanSize];
+    unsigned char  softMask[splashPipeSpanSize], aResult[splashPipeSpanSize];
+    unsigned char  alphaI[splashPipeSpanSize], alphaIm1[splashPipeSpanSize];
+    unsigned char  cSrc[3][splashPipeSpanSize], cDest[3][splashPipeSpanSize];
+    unsigned char  cBlend[3][splashPipeSpanSize];
+    unsigned char *cResult[3];
+    SplashColor    pixSrc, pixDest, pixBlend;
+    SplashColorPtr destColorPtr, srcPtr;
+    unsigned char *destAlphaPtr;
+    int            nComps, cSrcStride, xc, xe, xa, xb, xMod0, xMod1, n, nv, i, c;
+
+    nComps = mode == splashModeMono8 ? 1 : 3;
+
+    if (cSrcPtr && !pipe->pattern) {
+        cSrcStride = bitmapComps;
+    } else {
+        cSrcPtr = pipe->cSrcVal;
+        cSrcStride = 0;
+    }
+
+    // the result color overwrites the blend output
+    for (c = 0; c < 3; ++c) {
+        cResult[c] = cBlend[c];
+    }
+
+    xMod0 = x1 + 1;
+    xMod1 = -1;
+
+    for (xc = x0; xc <= x1; xc = xe + 1) {
+        if ((xe = xc + splashPipeSpanSize - 1) > x1) {
+            xe = x1;
+        }
+
+        //----- shape; skip the empty ends of the chunk
+
+        xa = xc;
+        xb = xe;
+        if (shapePtr) {
+            for (; xa <= xb && !shapePtr[xa - x0]; ++xa)
+                ;
+            for (; xb >= xa && !shapePtr[xb - x0]; --xb)
+                ;
+            if (xa > xb) {
+                continue;
+            }
+        }
+        n = xb - xa + 1;
+        nv = (n + splashVecSize - 1) & ~(splashVecSize - 1);
+
+        if (shapePtr) {
+            memcpy(shape, shapePtr + (xa - x0), n);
+        } else {
+            memset(shape, 0xff, n);
+        }
+        memset(shape + n, 0, nv - n);
+
+        if (xa < xMod0) {
+            xMod0 = xa;
+        }
+        xMod1 = xb;
+
+        //----- source color
+
+        if (pipe->pattern) {
+            for (i = 0; i < n; ++i) {
+                if (shape[i]) {
+                    pipe->pattern->getColor(xa + i, y, pipe->cSrcVal);
+                }
+                for (c = 0; c < nComps; ++c) {
+                    cSrc[c][i] = pipe->cSrcVal[c];
+                }
+            }
+        } else if (cSrcStride) {
+            srcPtr = cSrcPtr + (xa - x0) * cSrcStride;
+            for (i = 0; i < n; ++i, srcPtr += cSrcStride) {
+                for (c = 0; c < nComps; ++c) {
+                    cSrc[c][i] = srcPtr[c];
+                }
+            }
+        } else {
+            for (c = 0; c < nComps; ++c) {
+                memset(cSrc[c], cSrcPtr[c], n);
+            }
+        }
+
+        //----- destination color and alpha
+
+        destColorPtr = &bitmap->data[y * bitmap->rowSize + xa * bitmapPixelSize];
+        switch (mode) {
+        case splashModeMono8:
+            memcpy(cDest[0], destColorPtr, n);
+            break;
+        case splashModeRGB8:
+            for (i = 0; i < n; ++i) {
+                cDest[0][i] = destColorPtr[3 * i];
+                cDest[1][i] = destColorPtr[3 * i + 1];
+                cDest[2][i] = destColorPtr[3 * i + 2];
+            }
+            break;
+        case splashModeBGR8:
+            for (i = 0; i < n; ++i) {
+                cDest[2][i] = destColorPtr[3 * i];
+                cDest[1][i] = destColorPtr[3 * i + 1];
+                cDest[0][i] = destColorPtr[3 * i + 2];
+            }
+            break;
+        case splashModeXBGR8:
+            for (i = 0; i < n; ++i) {
+                cDest[2][i] = destColorPtr[4 * i];
+                cDest[1][i] = destColorPtr[4 * i + 1];
+                cDest[0][i] = destColorPtr[4 * i + 2];
+            }
+            break;
+        default:
+            break;
+        }
+
+        if (bitmap->alpha) {
+            destAlphaPtr = &bitmap->alpha[y * bitmap->width + xa];
+            memcpy(aDest, destAlphaPtr, n);
+        } else {
+            destAlphaPtr = NULL;
+            memset(aDest, 0xff, n);
+        }
+
+        //----- non-isolated group correction
+
+        if (pipe->nonIsolatedGroup) {
+            for (c = 0; c < nComps; ++c) {
+                splashSpanNonIsolated(cSrc[c], cDest[c], shape, aDest, nv);
+            }
+        }
+
+        //----- blend function
+
+        if (state->blendFunc) {
+            if (state->blendSpanFunc) {
+                for (c = 0; c < nComps; ++c) {
+                    (*state->blendSpanFunc)(cSrc[c], cDest[c], cBlend[c], nv);
+                }
+            } else {
+                for (i = 0; i < n; ++i) {
+                    for (c = 0; c < nComps; ++c) {
+                        pixSrc[c] = cSrc[c][i];
+                        pixDest[c] = cDest[c][i];
+                    }
+                    (*state->blendFunc)(pixSrc, pixDest, pixBlend, bitmap->mode);
+                    for (c = 0; c < nComps; ++c) {
+                        cBlend[c][i] = pixBlend[c];
+                    }
+                }
+            }
+        }
+
+        //----- result alpha and color
+
+        if (pipe->noTransparency) {
+            // opaque source, with a blend function
+            for (c = 0; c < nComps; ++c) {
+                splashSpanBlendOpaque(cSrc[c], cBlend[c], aDest, cResult[c], nv);
+            }
+            memset(aResult, 0xff, n);
+            memset(alphaI, 0xff, n);
+        } else {
+            if (state->softMask) {
+                memcpy(softMask,
+                       &state->softMask
+                            ->data[y * state->softMask->rowSize + xa],
+                       n);
+            }
+            splashSpanSrcAlpha(pipe->aInput,
+                               state->softMask ? softMask : NULL, shape, aSrc,
+                               nv);
+
+            if (state->inNonIsolatedGroup && groupBackBitmap->alpha) {
+                memcpy(alpha0,
+                       &groupBackBitmap
+                            ->alpha[(groupBackY + y) * groupBackBitmap->width +
+                                    (groupBackX + xa)],
+                       n);
+                splashSpanAlpha(aSrc, aDest, alpha0, aResult, alphaI,
+                                alphaIm1, nv);
+            } else {
+                splashSpanAlpha(aSrc, aDest, NULL, aResult, alphaI, alphaIm1,
+                                nv);
+            }
+
+            for (c = 0; c < nComps; ++c) {
+                splashSpanResultColor(cSrc[c], cDest[c],
+                                      state->blendFunc ? cBlend[c] : NULL,
+                                      aSrc, destAlphaPtr ? alphaI : NULL,
+                                      alphaIm1, cResult[c], nv);
+            }
+        }
+
+        //----- write destination pixels
+
+        switch (mode) {
+        case splashModeMono8:
+            for (i = 0; i < n; ++i) {
+                if (shape[i]) {
+                    destColorPtr[i] =
+                        alphaI[i] ? state->grayTransfer[cResult[0][i]] : 0;
+                }
+            }
+            break;
+        case splashModeRGB8:
+            for (i = 0; i < n; ++i, destColorPtr += 3) {
+                if (!shape[i]) {
+                    continue;
+                }
+                if (alphaI[i]) {
+                    destColorPtr[0] = state->rgbTransferR[cResult[0][i]];
+                    destColorPtr[1] = state->rgbTransferG[cResult[1][i]];
+                    destColorPtr[2] = state->rgbTransferB[cResult[2][i]];
+                } else {
+                    destColorPtr[0] = destColorPtr[1] = destColorPtr[2] = 0;
+                }
+            }
+            break;
+        case splashModeBGR8:
+            for (i = 0; i < n; ++i, destColorPtr += 3) {
+                if (!shape[i]) {
+                    continue;
+                }
+                if (alphaI[i]) {
+                    destColorPtr[0] = state->rgbTransferB[cResult[2][i]];
+                    destColorPtr[1] = state->rgbTransferG[cResult[1][i]];
+                    destColorPtr[2] = state->rgbTransferR[cResult[0][i]];
+                } else {
+                    destColorPtr[0] = destColorPtr[1] = destColorPtr[2] = 0;
+                }
+            }
+            break;
+        case splashModeXBGR8:
+            for (i = 0; i < n; ++i, destColorPtr += 4) {
+                if (!shape[i]) {
+                    continue;
+                }
+                if (alphaI[i]) {
+                    destColorPtr[0] = state->rgbTransferB[cResult[2][i]];
+                    destColorPtr[1] = state->rgbTransferG[cResult[1][i]];
+                    destColorPtr[2] = state->rgbTransferR[cResult[0][i]];
+                } else {
+                    destColorPtr[0] = destColorPtr[1] = destColorPtr[2] = 0;
+                }
+                destColorPtr[3] = 255;
+            }
+            break;
+        default:
+            break;
+        }
+        if (destAlphaPtr) {
+            for (i = 0; i < n; ++i) {
+                if (shape[i]) {
+                    destAlphaPtr[i] = aResult[i];
+                }
+            }
+        }
+    }
+
+    if (xMod1 >= 0) {
+        updateModX(xMod0);
+        updateModX(xMod1);
+        updateModY(y);
+    }
+}
+
+// special case:
+// !state->inKnockoutGroup && (!pipe->noTransparency || state->blendFunc) &&
+// bitmap->mode == splashModeMono8
+void Splash::pipeRunTranspMono8(SplashPipe *pipe, int x0, int x1, int y,
+                                unsigned char *shapePtr, SplashColorPtr cSrcPtr)
+{
+    pipeRunTransp(pipe, x0, x1, y, shapePtr, cSrcPtr, splashModeMono8);
+}
+
+// special case:
+// !state->inKnockoutGroup && (!pipe->noTransparency || state->blendFunc) &&
+// bitmap->mode == splashModeRGB8
+void Splash::pipeRunTranspRGB8(SplashPipe *pipe, int x0, int x1, int y,
+                               unsigned char *shapePtr, SplashColorPtr cSrcPtr)
+{
+    pipeRunTransp(pipe, x0, x1, y, shapePtr, cSrcPtr, splashModeRGB8);
+}
+
+// special case:
+// !state->inKnockoutGroup && (!pipe->noTransparency || state->blendFunc) &&
+// bitmap->mode == splashModeBGR8
+void Splash::pipeRunTranspBGR8(SplashPipe *pipe, int x0, int x1, int y,
+                               unsigned char *shapePtr, SplashColorPtr cSrcPtr)
+{
+    pipeRunTransp(pipe, x0, x1, y, shapePtr, cSrcPtr, splashModeBGR8);
+}
+
+// special case:
+// !state->inKnockoutGroup && (!pipe->noTransparency || state->blendFunc) &&
+// bitmap->mode == splashModeXBGR8
+void Splash::pipeRunTranspXBGR8(SplashPipe *pipe, int x0, int x1, int y,
+                                unsigned char *shapePtr, SplashColorPtr cSrcPtr)
+{
+    pipeRunTransp(pipe, x0, x1, y, shapePtr, cSrcPtr, splashModeXBGR8);
+}
+
 //------------------------------------------------------------------------
 
 // Transform a point from user space to device space.
@@ -1506,8 +2106,12 @@ Splash::Splash(SplashBitmap *bitmapA, bool vectorAntialiasA,
 
     bitmap = bitmapA;
     bitmapComps = splashColorModeNComps[bitmap->mode];
+    bitmapPixelSize = splashColorModePixelSize[bitmap->mode];
     vectorAntialias = vectorAntialiasA;
     inShading = false;
+    groupBackBitmap = NULL;
+    groupBackX = groupBackY = 0;
+    bands = NULL;
     state = new SplashState(bitmap->width, bitmap->height, vectorAntialias,
                             screenParams);
     scanBuf = (unsigned char *)malloc(bitmap->width);
@@ -1530,8 +2134,12 @@ Splash::Splash(SplashBitmap *bitmapA, bool vectorAntialiasA,
 
     bitmap = bitmapA;
     bitmapComps = splashColorModeNComps[bitmap->mode];
+    bitmapPixelSize = splashColorModePixelSize[bitmap->mode];
     vectorAntialias = vectorAntialiasA;
     inShading = false;
+    groupBackBitmap = NULL;
+    groupBackX = groupBackY = 0;
+    bands = NULL;
     state =
         new SplashState(bitmap->width, bitmap->height, vectorAntialias, screenA);
     scanBuf = (unsigned char *)malloc(bitmap->width);
@@ -1549,6 +2157,10 @@ Splash::Splash(SplashBitmap *bitmapA, bool vectorAntialiasA,
 
 Splash::~Splash()
 {
+    if (bands) {
+        bands->flush();
+        delete bands;
+    }
     while (state->next) {
         restoreState();
     }
@@ -1667,56 +2279,68 @@ bool Splash::getInKnockoutGroup()
 void Splash::setMatrix(SplashCoord *matrix)
 {
     memcpy(state->matrix, matrix, 6 * sizeof(SplashCoord));
+    stateChanged();
 }
 
 void Splash::setStrokePattern(SplashPattern *strokePattern)
 {
     state->setStrokePattern(strokePattern);
+    stateChanged();
 }
 
 void Splash::setFillPattern(SplashPattern *fillPattern)
 {
     state->setFillPattern(fillPattern);
+    stateChanged();
 }
 
 void Splash::setScreen(SplashScreen *screen)
 {
     state->setScreen(screen);
+    stateChanged();
 }
 
-void Splash::setBlendFunc(SplashBlendFunc func)
+void Splash::setBlendFunc(SplashBlendFunc func, SplashBlendSpanFunc spanFunc)
 {
     state->blendFunc = func;
+    state->blendSpanFunc = spanFunc;
+    stateChanged();
 }
 
 void Splash::setStrokeAlpha(SplashCoord alpha)
 {
     state->strokeAlpha = alpha;
+    stateChanged();
 }
 
 void Splash::setFillAlpha(SplashCoord alpha)
 {
     state->fillAlpha = alpha;
+    stateChanged();
 }
 
 void Splash::setLineWidth(SplashCoord lineWidth)
 {
     state->lineWidth = lineWidth;
+    stateChanged();
 }
 
 void Splash::setLineCap(int lineCap)
 {
     state->lineCap = lineCap;
+    stateChanged();
 }
 
 void Splash::setLineJoin(int lineJoin)
 {
     state->lineJoin = lineJoin;
+    stateChanged();
 }
 
 void Splash::setMiterLimit(SplashCoord miterLimit)
 {
     state->miterLimit = miterLimit;
+    stateChanged();
 }
 
 void Splash::setFlatness(SplashCoord flatness)
@@ -1726,39 +2350,50 @@ void Splash::setFlatness(SplashCoord flatness)
     } else {
         state->flatness = flatness;
     }
+    stateChanged();
 }
 
 void Splash::setLineDash(SplashCoord *lineDash, int lineDashLength,
                          SplashCoord lineDashPhase)
 {
     state->setLineDash(lineDash, lineDashLength, lineDashPhase);
+    stateChanged();
 }
 
 void Splash::setStrokeAdjust(bool strokeAdjust)
 {
     state->strokeAdjust = strokeAdjust;
+    stateChanged();
 }
 
 void Splash::clipResetToRect(SplashCoord x0, SplashCoord y0, SplashCoord x1,
                              SplashCoord y1)
 {
     state->clipResetToRect(x0, y0, x1, y1);
+    clipChanged();
 }
 
 SplashError Splash::clipToRect(SplashCoord x0, SplashCoord y0, SplashCoord x1,
                                SplashCoord y1)
 {
+    clipChanged();
     return state->clipToRect(x0, y0, x1, y1);
 }
 
 SplashError Splash::clipToPath(SplashPath *path, bool eo)
 {
+    clipChanged();
     return state->clipToPath(path, eo);
 }
 
 void Splash::setSoftMask(SplashBitmap *softMask)
 {
+    // recorded operations may use the old soft mask
+    if (state->deleteSoftMask && state->softMask) {
+        flush();
+    }
     state->setSoftMask(softMask);
+    stateChanged();
 }
 
 void Splash::setInTransparencyGroup(SplashBitmap *groupBackBitmapA,
@@ -1770,17 +2405,34 @@ void Splash::setInTransparencyGroup(SplashBitmap *groupBackBitmapA,
     groupBackY = groupBackYA;
     state->inNonIsolatedGroup = nonIsolated;
     state->inKnockoutGroup = knockout;
+    stateChanged();
 }
 
 void Splash::setTransfer(unsigned char *red, unsigned char *green,
                          unsigned char *blue, unsigned char *gray)
 {
-    state->setTransfer(red, green, blue, gray);
+    state->setTransfer(red, green, blue, gray);
+    stateChanged();
+}
+
+void Splash::setOverprintMask(unsigned overprintMask)
+{
+    state->overprintMask = overprintMask;
+    stateChanged();
+}
+
+void Splash::stateChanged()
+{
+    if (bands) {
+        bands->stateChanged();
+    }
 }
 
-void Splash::setOverprintMask(unsigned overprintMask)
+void Splash::clipChanged()
 {
-    state->overprintMask = overprintMask;
+    if (bands) {
+        bands->clipChanged();
+    }
 }
 
 //------------------------------------------------------------------------
@@ -1803,12 +2455,38 @@ SplashError Splash::restoreState()
     if (!state->next) {
         return splashErrNoSave;
     }
+    // recorded operations may use the soft mask
+    if (state->deleteSoftMask && state->softMask) {
+        flush();
+    }
     oldState = state;
     state = state->next;
     delete oldState;
+    clipChanged();
     return splashOk;
 }
 
+//------------------------------------------------------------------------
+// banded rasterization
+//------------------------------------------------------------------------
+
+void Splash::setThreads(int nThreads)
+{
+    flush();
+    delete bands;
+    bands = NULL;
+    if (SplashBands::canSplit(bitmap, nThreads)) {
+        bands = new SplashBands(this, nThreads);
+    }
+}
+
+void Splash::flush()
+{
+    if (bands) {
+        bands->flush();
+    }
+}
+
 //------------------------------------------------------------------------
 // drawing operations
 //------------------------------------------------------------------------
@@ -1819,6 +2497,8 @@ void Splash::clear(SplashColorPtr color, unsigned char alpha)
     unsigned char  mono;
     int            x, y;
 
+    flush();
+
     switch (bitmap->mode) {
     case splashModeMono1:
         mono = (color[0] & 0x80) ? 0xff : 0x00;
@@ -1879,6 +2559,19 @@ void Splash::clear(SplashColorPtr color, unsigned char alpha)
             }
         }
         break;
+    case splashModeXBGR8:
+        row = bitmap->data;
+        for (y = 0; y < bitmap->height; ++y) {
+            p = row;
+            for (x = 0; x < bitmap->width; ++x) {
+                *p++ = color[2];
+                *p++ = color[1];
+                *p++ = color[0];
+                *p++ = 255;
+            }
+            row += bitmap->rowSize;
+        }
+        break;
     }
 
     if (bitmap->alpha) {
@@ -1894,7 +2587,7 @@ void Splash::clear(SplashColorPtr color, unsigned char alpha)
 SplashError Splash::stroke(SplashPath *path)
 {
     SplashPath *path2, *dPath;
-    SplashCoord t0, t1, t2, t3, w, w2;
+    SplashCoord t0, t1, t2, t3, w, w2, wThin;
 
     if (debugMode) {
         printf("stroke [dash:%d] [width:%.2f]:\n", state->lineDashLength,
@@ -1905,16 +2598,11 @@ SplashError Splash::stroke(SplashPath *path)
     if (path->length == 0) {
         return splashErrEmptyPath;
     }
-    path2 = flattenPath(path, state->matrix, state->flatness);
-    if (state->lineDashLength > 0) {
-        dPath = makeDashedPath(path2);
-        delete path2;
-        path2 = dPath;
-        if (path2->length == 0) {
-            delete path2;
-            return splashErrEmptyPath;
-        }
+    if (bands) {
+        bands->stroke(path);
+        return splashOk;
     }
+    path2 = flattenPath(path, state->matrix, state->flatness);
 
     // Compute an approximation of the transformed line width.
     // Given a CTM of [m0 m1],
@@ -1935,6 +2623,37 @@ SplashError Splash::stroke(SplashPath *path)
         w = (t1 < t2) ? t1 : t2;
     }
     w2 = w * state->lineWidth;
+
+    // in antialiased gray and color modes, strokes up to
+    // splashMaxThinStrokeWidth pixels wide (after applying the min line
+    // width) are drawn directly, dashes included, without building the
+    // outline
+    wThin = 0;
+    if (vectorAntialias && bitmap->mode != splashModeMono1 && w > 0) {
+        if (w2 < minLineWidth) {
+            if (minLineWidth <= splashMaxThinStrokeWidth) {
+                wThin = minLineWidth / w;
+            }
+        } else if (w2 <= splashMaxThinStrokeWidth) {
+            wThin = state->lineWidth;
+        }
+    }
+    if (wThin > 0) {
+        strokeThin(path2, wThin);
+        delete path2;
+        return splashOk;
+    }
+
+    if (state->lineDashLength > 0) {
+        dPath = makeDashedPath(path2);
+        delete path2;
+        path2 = dPath;
+        if (path2->length == 0) {
+            delete path2;
+            return splashErrEmptyPath;
+        }
+    }
+
     // if there is a min line width set, and the transformed line width
     // is smaller, use the min line width
     if (w > 0 && w2 < minLineWidth) {
@@ -1967,9 +2686,10 @@ void Splash::strokeNarrow(SplashPath *path)
     SplashPipe       pipe;
     SplashXPath *    xPath;
     SplashXPathSeg * seg;
-    int              x0, x1, y0, y1, xa, xb, y;
+    int              x0, x1, y0, y1, yEnd, xa, xb, y;
     SplashCoord      dxdy;
     SplashClipResult clipRes;
+    bool             xIncr;
     int              nClipRes[3];
     int              i;
 
@@ -2004,7 +2724,12 @@ void Splash::strokeNarrow(SplashPath *path)
                                    clipRes == splashClipAllInside);
                 }
             } else {
+                // the clip region removes rows from the ends of the
+                // segment, without changing the spans drawn in the other
+                // rows (which keeps banded rasterization exact)
                 dxdy = seg->dxdy;
+                xIncr = x0 <= x1;
+                yEnd = y1;
                 y = state->clip->getYMinI(state->strokeAdjust);
                 if (y0 < y) {
                     y0 = y;
@@ -2014,13 +2739,11 @@ void Splash::strokeNarrow(SplashPath *path)
                 y = state->clip->getYMaxI(state->strokeAdjust);
                 if (y1 > y) {
                     y1 = y;
-                    x1 =
-                        splashFloor(seg->x0 + ((SplashCoord)y1 - seg->y0) * dxdy);
                 }
-                if (x0 <= x1) {
+                if (xIncr) {
                     xa = x0;
                     for (y = y0; y <= y1; ++y) {
-                        if (y < y1) {
+                        if (y < yEnd) {
                             xb = splashFloor(
                                 seg->x0 + ((SplashCoord)y + 1 - seg->y0) * dxdy);
                         } else {
@@ -2038,7 +2761,7 @@ void Splash::strokeNarrow(SplashPath *path)
                 } else {
                     xa = x0;
                     for (y = y0; y <= y1; ++y) {
-                        if (y < y1) {
+                        if (y < yEnd) {
                             xb = splashFloor(
                                 seg->x0 + ((SplashCoord)y + 1 - seg->y0) * dxdy);
                         } else {
@@ -2106,6 +2829,72 @@ void Splash::strokeWide(SplashPath *path, SplashCoord w)
     delete path2;
 }
 
+void Splash::strokeThin(SplashPath *path, SplashCoord w)
+{
+    SplashPipe       pipe;
+    int              xMin, yMin, xMax, yMax, xa, xb, x, y, t;
+    SplashClipResult clipRes;
+
+    SplashThinStroke thinStroke(path, state, w);
+
+    xMin = thinStroke.getXMin();
+    yMin = thinStroke.getYMin();
+    xMax = thinStroke.getXMax();
+    yMax = thinStroke.getYMax();
+
+    if (xMin > xMax || yMin > yMax) {
+        opClipRes = splashClipAllOutside;
+        return;
+    }
+
+    // check clipping
+    if (splashClipAllOutside !=
+        (clipRes = state->clip->testRect(xMin, yMin, xMax, yMax,
+                                         state->strokeAdjust))) {
+        if ((t = state->clip->getXMinI(state->strokeAdjust)) > xMin) {
+            xMin = t;
+        }
+
+        if ((t = state->clip->getXMaxI(state->strokeAdjust)) < xMax) {
+            xMax = t;
+        }
+
+        if ((t = state->clip->getYMinI(state->strokeAdjust)) > yMin) {
+            yMin = t;
+        }
+
+        if ((t = state->clip->getYMaxI(state->strokeAdjust)) < yMax) {
+            yMax = t;
+        }
+
+        if (xMin > xMax || yMin > yMax) {
+            opClipRes = clipRes;
+            return;
+        }
+
+        pipeInit(&pipe, state->strokePattern,
+                 (unsigned char)splashRound(state->strokeAlpha * 255), true,
+                 false);
+
+        // draw the spans -- only the pixels near the stroke, rather than
+        // the whole bounding box
+        for (y = yMin; y <= yMax; ++y) {
+            if (!thinStroke.getSpan(scanBuf, y, xMin, xMax, &xa, &xb)) {
+                continue;
+            }
+            if (clipRes != splashClipAllInside) {
+                state->clip->clipSpan(scanBuf, y, xa, xb, state->strokeAdjust);
+            }
+            for (x = xa; x <= xb; ++x) {
+                scanBuf[x] = aaGamma[scanBuf[x]];
+            }
+            (this->*pipe.run)(&pipe, xa, xb, y, scanBuf + xa, NULL);
+        }
+    }
+
+    opClipRes = clipRes;
+}
+
 SplashPath *Splash::flattenPath(SplashPath *path, SplashCoord *matrix,
                                 SplashCoord flatness)
 {
@@ -2338,6 +3127,10 @@ SplashError Splash::fill(SplashPath *path, bool eo)
         printf("fill [eo:%d]:\n", eo);
         dumpPath(path);
     }
+    if (bands && path->length > 0) {
+        bands->fill(path, eo);
+        return splashOk;
+    }
     return fillWithPattern(path, eo, state->fillPattern, state->fillAlpha);
 }
 
@@ -2600,10 +3393,13 @@ bool Splash::pathAllOutside(SplashPath *path)
 
 SplashError Splash::xorFill(SplashPath *path, bool eo)
 {
-    SplashPipe       pipe;
-    int              xMin, yMin, xMax, yMax, y, t;
-    SplashClipResult clipRes;
-    SplashBlendFunc  origBlendFunc;
+    SplashPipe          pipe;
+    int                 xMin, yMin, xMax, yMax, y, t;
+    SplashClipResult    clipRes;
+    SplashBlendFunc     origBlendFunc;
+    SplashBlendSpanFunc origBlendSpanFunc;
+
+    flush();
 
     if (path->length == 0) {
         return splashErrEmptyPath;
@@ -2642,7 +3438,9 @@ SplashError Splash::xorFill(SplashPath *path, bool eo)
         }
 
         origBlendFunc = state->blendFunc;
+        origBlendSpanFunc = state->blendSpanFunc;
         state->blendFunc = &blendXor;
+        state->blendSpanFunc = NULL;
         pipeInit(&pipe, state->fillPattern, 255, true, false);
 
         // draw the spans
@@ -2655,6 +3453,7 @@ SplashError Splash::xorFill(SplashPath *path, bool eo)
             (this->*pipe.run)(&pipe, xMin, xMax, y, scanBuf + xMin, NULL);
         }
         state->blendFunc = origBlendFunc;
+        state->blendSpanFunc = origBlendSpanFunc;
     }
     opClipRes = clipRes;
 
@@ -2681,7 +3480,12 @@ SplashError Splash::fillChar(SplashCoord x, SplashCoord y, int c,
     if (!font->getGlyph(c, xFrac, yFrac, &glyph)) {
         return splashErrNoGlyph;
     }
-    err = fillGlyph2(x0, y0, &glyph);
+    if (bands) {
+        bands->fillGlyph(x0, y0, &glyph);
+        err = splashOk;
+    } else {
+        err = fillGlyph2(x0, y0, &glyph);
+    }
     if (glyph.freeData) {
         free(glyph.data);
     }
@@ -2697,6 +3501,10 @@ SplashError Splash::fillGlyph(SplashCoord x, SplashCoord y,
     transform(state->matrix, x, y, &xt, &yt);
     x0 = splashFloor(xt);
     y0 = splashFloor(yt);
+    if (bands) {
+        bands->fillGlyph(x0, y0, glyph);
+        return splashOk;
+    }
     return fillGlyph2(x0, y0, glyph);
 }
 
@@ -2832,6 +3640,15 @@ SplashError Splash::fillImageMask(SplashImageMaskSource src, void *srcData, int
         return splashErrSingularMatrix;
     }
 
+    // large masks are not recorded
+    if (bands) {
+        if (bands->fillImageMask(src, srcData, w, h, mat, glyphMode,
+                                 interpolate)) {
+            return splashOk;
+        }
+        flush();
+    }
+
     minorAxisZero = splashAbs(mat[1]) <= 0.0001 && splashAbs(mat[2]) <= 0.0001;
 
     // rough estimate of size of scaled mask
@@ -3405,19 +4222,14 @@ void Splash::scaleMaskYdXd(SplashImageMaskSource src, void *srcData, int srcWidt
 {
     unsigned char *lineBuf;
     unsigned *     pixBuf;
-    unsigned       pix;
     unsigned char *destPtr;
-    int            yp, yq, xp, xq, yt, y, yStep, xt, x, xStep, xx, d, d0, d1;
-    int            i, j;
+    int            yp, yq, yt, y, yStep;
+    int            i;
 
     // Bresenham parameters for y scale
     yp = srcHeight / scaledHeight;
     yq = srcHeight % scaledHeight;
 
-    // Bresenham parameters for x scale
-    xp = srcWidth / scaledWidth;
-    xq = srcWidth % scaledWidth;
-
     // allocate buffers
     lineBuf = (unsigned char *)malloc(srcWidth);
     pixBuf = (unsigned *)calloc(srcWidth, sizeof(int));
@@ -3439,39 +4251,13 @@ void Splash::scaleMaskYdXd(SplashImageMaskSource src, void *srcData, int srcWidt
         memset(pixBuf, 0, srcWidth * sizeof(int));
         for (i = 0; i < yStep; ++i) {
             (*src)(srcData, lineBuf);
-            for (j = 0; j < srcWidth; ++j) {
-                pixBuf[j] += lineBuf[j];
-            }
+            splashScaleAccumRow(pixBuf, lineBuf, srcWidth);
         }
 
-        // init x scale Bresenham
-        xt = 0;
-        d0 = (255 << 23) / (yStep * xp);
-        d1 = (255 << 23) / (yStep * (xp + 1));
-
-        xx = 0;
-        for (x = 0; x < scaledWidth; ++x) {
-            // x scale Bresenham
-            if ((xt += xq) >= scaledWidth) {
-                xt -= scaledWidth;
-                xStep = xp + 1;
-                d = d1;
-            } else {
-                xStep = xp;
-                d = d0;
-            }
-
-            // compute the final pixel
-            pix = 0;
-            for (i = 0; i < xStep; ++i) {
-                pix += pixBuf[xx++];
-            }
-            // (255 * pix) / xStep * yStep
-            pix = (pix * d) >> 23;
-
-            // store the pixel
-            *destPtr++ = (unsigned char)pix;
-        }
+        // compute the final pixels (x scale Bresenham):
+        // (255 * pix) / xStep * yStep
+        splashScaleBoxRow(pixBuf, 1, srcWidth, scaledWidth, yStep, 255, destPtr);
+        destPtr += scaledWidth;
     }
 
     free(pixBuf);
@@ -3484,10 +4270,9 @@ void Splash::scaleMaskYdXu(SplashImageMaskSource src, void *srcData, int srcWidt
 {
     unsigned char *lineBuf;
     unsigned *     pixBuf;
-    unsigned       pix;
     unsigned char *destPtr;
-    int            yp, yq, xp, xq, yt, y, yStep, xt, x, xStep, d;
-    int            i, j;
+    int            yp, yq, xp, xq, yt, y, yStep, xt, x, xStep;
+    int            i;
 
     // Bresenham parameters for y scale
     yp = srcHeight / scaledHeight;
@@ -3518,14 +4303,15 @@ void Splash::scaleMaskYdXu(SplashImageMaskSource src, void *srcData, int srcWidt
         memset(pixBuf, 0, srcWidth * sizeof(int));
         for (i = 0; i < yStep; ++i) {
             (*src)(srcData, lineBuf);
-            for (j = 0; j < srcWidth; ++j) {
-                pixBuf[j] += lineBuf[j];
-            }
+            splashScaleAccumRow(pixBuf, lineBuf, srcWidth);
         }
 
+        // compute the final pixels -- (255 * pixBuf[]) / yStep -- into
+        // lineBuf, which is free until the next row
+        splashScaleDivRow(pixBuf, yStep, 255, lineBuf, srcWidth);
+
         // init x scale Bresenham
         xt = 0;
-        d = (255 << 23) / yStep;
 
         for (x = 0; x < srcWidth; ++x) {
             // x scale Bresenham
@@ -3536,14 +4322,9 @@ void Splash::scaleMaskYdXu(SplashImageMaskSource src, void *srcData, int srcWidt
                 xStep = xp;
             }
 
-            // compute the final pixel
-            pix = pixBuf[x];
-            // (255 * pix) / yStep
-            pix = (pix * d) >> 23;
-
             // store the pixel
             for (i = 0; i < xStep; ++i) {
-                *destPtr++ = (unsigned char)pix;
+                *destPtr++ = lineBuf[x];
             }
         }
     }
@@ -3885,6 +4666,7 @@ SplashError Splash::drawImage(SplashImageSource src, void *srcData,
         break;
     case splashModeRGB8:
     case splashModeBGR8:
+    case splashModeXBGR8:
         ok = srcMode == splashModeRGB8;
         nComps = 3;
         break;
@@ -3901,6 +4683,15 @@ SplashError Splash::drawImage(SplashImageSource src, void *srcData,
         return splashErrSingularMatrix;
     }
 
+    // large images are not recorded
+    if (bands) {
+        if (bands->drawImage(src, srcData, srcMode, srcAlpha, w, h, mat,
+                             interpolate)) {
+            return splashOk;
+        }
+        flush();
+    }
+
     minorAxisZero = splashAbs(mat[1]) <= 0.0001 && splashAbs(mat[2]) <= 0.0001;
 
     // rough estimate of size of scaled image
@@ -4532,20 +5323,14 @@ void Splash::scaleImageYdXd(SplashImageSource src, void *srcData,
 {
     unsigned char *lineBuf, *alphaLineBuf;
     unsigned *     pixBuf, *alphaPixBuf;
-    unsigned       pix0, pix1, pix2;
-    unsigned       alpha;
     unsigned char *destPtr, *destAlphaPtr;
-    int            yp, yq, xp, xq, yt, y, yStep, xt, x, xStep, xx, xxa, d, d0, d1;
-    int            i, j;
+    int            yp, yq, yt, y, yStep;
+    int            i;
 
     // Bresenham parameters for y scale
     yp = srcHeight / scaledHeight;
     yq = srcHeight % scaledHeight;
 
-    // Bresenham parameters for x scale
-    xp = srcWidth / scaledWidth;
-    xq = srcWidth % scaledWidth;
-
     // allocate buffers
     lineBuf = (unsigned char *)calloc(srcWidth, nComps);
     pixBuf = (unsigned *)calloc(srcWidth, nComps * sizeof(int));
@@ -4578,85 +5363,32 @@ void Splash::scaleImageYdXd(SplashImageSource src, void *srcData,
         }
         for (i = 0; i < yStep; ++i) {
             (*src)(srcData, lineBuf, alphaLineBuf);
-            for (j = 0; j < srcWidth * nComps; ++j) {
-                pixBuf[j] += lineBuf[j];
-            }
+            splashScaleAccumRow(pixBuf, lineBuf, srcWidth * nComps);
             if (srcAlpha) {
-                for (j = 0; j < srcWidth; ++j) {
-                    alphaPixBuf[j] += alphaLineBuf[j];
-                }
+                splashScaleAccumRow(alphaPixBuf, alphaLineBuf, srcWidth);
             }
         }
 
-        // init x scale Bresenham
-        xt = 0;
-        d0 = (1 << 23) / (yStep * xp);
-        d1 = (1 << 23) / (yStep * (xp + 1));
-
-        xx = xxa = 0;
-        for (x = 0; x < scaledWidth; ++x) {
-            // x scale Bresenham
-            if ((xt += xq) >= scaledWidth) {
-                xt -= scaledWidth;
-                xStep = xp + 1;
-                d = d1;
-            } else {
-                xStep = xp;
-                d = d0;
-            }
-
-            switch (srcMode) {
-            case splashModeMono8:
-
-                // compute the final pixel
-                pix0 = 0;
-                for (i = 0; i < xStep; ++i) {
-                    pix0 += pixBuf[xx++];
-                }
-                // pix / xStep * yStep
-                pix0 = (pix0 * d) >> 23;
-
-                // store the pixel
-                *destPtr++ = (unsigned char)pix0;
-                break;
-
-            case splashModeRGB8:
-
-                // compute the final pixel
-                pix0 = pix1 = pix2 = 0;
-                for (i = 0; i < xStep; ++i) {
-                    pix0 += pixBuf[xx];
-                    pix1 += pixBuf[xx + 1];
-                    pix2 += pixBuf[xx + 2];
-                    xx += 3;
-                }
-                // pix / xStep * yStep
-                pix0 = (pix0 * d) >> 23;
-                pix1 = (pix1 * d) >> 23;
-                pix2 = (pix2 * d) >> 23;
-
-                // store the pixel
-                *destPtr++ = (unsigned char)pix0;
-                *destPtr++ = (unsigned char)pix1;
-                *destPtr++ = (unsigned char)pix2;
-                break;
+        // compute the final pixels (x scale Bresenham)
+        switch (srcMode) {
+        case splashModeMono8:
+        case splashModeRGB8:
+            splashScaleBoxRow(pixBuf, nComps, srcWidth, scaledWidth, yStep, 1,
+                              destPtr);
+            destPtr += scaledWidth * nComps;
+            break;
 
-            case splashModeMono1: // mono1 is not allowed
-            case splashModeBGR8: // bgr8 is not allowed
-            default:
-                break;
-            }
+        case splashModeMono1: // mono1 is not allowed
+        case splashModeBGR8: // bgr8 is not allowed
+        default:
+            break;
+        }
 
-            // process alpha
-            if (srcAlpha) {
-                alpha = 0;
-                for (i = 0; i < xStep; ++i, ++xxa) {
-                    alpha += alphaPixBuf[xxa];
-                }
-                // alpha / xStep * yStep
-                alpha = (alpha * d) >> 23;
-                *destAlphaPtr++ = (unsigned char)alpha;
-            }
+        // process alpha
+        if (srcAlpha) {
+            splashScaleBoxRow(alphaPixBuf, 1, srcWidth, scaledWidth, yStep, 1,
+                              destAlphaPtr);
+            destAlphaPtr += scaledWidth;
         }
     }
 
@@ -4673,11 +5405,10 @@ void Splash::scaleImageYdXu(SplashImageSource src, void *srcData,
 {
     unsigned char *lineBuf, *alphaLineBuf;
     unsigned *     pixBuf, *alphaPixBuf;
-    unsigned       pix[splashMaxColorComps];
-    unsigned       alpha;
+    unsigned char *pix;
     unsigned char *destPtr, *destAlphaPtr;
-    int            yp, yq, xp, xq, yt, y, yStep, xt, x, xStep, d;
-    int            i, j;
+    int            yp, yq, xp, xq, yt, y, yStep, xt, x, xStep;
+    int            i;
 
     // Bresenham parameters for y scale
     yp = srcHeight / scaledHeight;
@@ -4719,20 +5450,23 @@ void Splash::scaleImageYdXu(SplashImageSource src, void *srcData,
         }
         for (i = 0; i < yStep; ++i) {
             (*src)(srcData, lineBuf, alphaLineBuf);
-            for (j = 0; j < srcWidth * nComps; ++j) {
-                pixBuf[j] += lineBuf[j];
-            }
+            splashScaleAccumRow(pixBuf, lineBuf, srcWidth * nComps);
             if (srcAlpha) {
-                for (j = 0; j < srcWidth; ++j) {
-                    alphaPixBuf[j] += alphaLineBuf[j];
-                }
+                splashScaleAccumRow(alphaPixBuf, alphaLineBuf, srcWidth);
             }
         }
 
+        // compute the final pixels -- pixBuf[] / yStep -- into lineBuf
+        // and alphaLineBuf, which are free until the next row
+        splashScaleDivRow(pixBuf, yStep, 1, lineBuf, srcWidth * nComps);
+        if (srcAlpha) {
+            splashScaleDivRow(alphaPixBuf, yStep, 1, alphaLineBuf, srcWidth);
+        }
+
         // init x scale Bresenham
         xt = 0;
-        d = (1 << 23) / yStep;
 
+        pix = lineBuf;
         for (x = 0; x < srcWidth; ++x) {
             // x scale Bresenham
             if ((xt += xq) >= srcWidth) {
@@ -4742,24 +5476,18 @@ void Splash::scaleImageYdXu(SplashImageSource src, void *srcData,
                 xStep = xp;
             }
 
-            // compute the final pixel
-            for (i = 0; i < nComps; ++i) {
-                // pixBuf[] / yStep
-                pix[i] = (pixBuf[x * nComps + i] * d) >> 23;
-            }
-
             // store the pixel
             switch (srcMode) {
             case splashModeMono8:
                 for (i = 0; i < xStep; ++i) {
-                    *destPtr++ = (unsigned char)pix[0];
+                    *destPtr++ = pix[0];
                 }
                 break;
             case splashModeRGB8:
                 for (i = 0; i < xStep; ++i) {
-                    *destPtr++ = (unsigned char)pix[0];
-                    *destPtr++ = (unsigned char)pix[1];
-                    *destPtr++ = (unsigned char)pix[2];
+                    *destPtr++ = pix[0];
+                    *destPtr++ = pix[1];
+                    *destPtr++ = pix[2];
                 }
                 break;
             case splashModeMono1: // mono1 is not allowed
@@ -4767,13 +5495,12 @@ void Splash::scaleImageYdXu(SplashImageSource src, void *srcData,
             default:
                 break;
             }
+            pix += nComps;
 
             // process alpha
             if (srcAlpha) {
-                // alphaPixBuf[] / yStep
-                alpha = (alphaPixBuf[x] * d) >> 23;
                 for (i = 0; i < xStep; ++i) {
-                    *destAlphaPtr++ = (unsigned char)alpha;
+                    *destAlphaPtr++ = alphaLineBuf[x];
                 }
             }
         }
@@ -5383,17 +6110,45 @@ void Splash::blitImageClipped(SplashBitmap *src, bool srcAlpha, int xSrc,
     }
 }
 
+// The pipe takes source colors in RGB order, three bytes per pixel.
+// This converts <n> pixels of a BGR8 or XBGR8 bitmap row, starting at
+// <p>, into <buf>, and returns <buf> -- other rows are returned as is.
+static SplashColorPtr getSrcColors(SplashBitmap *src, SplashColorPtr p, int n,
+                                   SplashColorPtr buf)
+{
+    SplashColorPtr q;
+    int            step, i;
+
+    switch (src->getMode()) {
+    case splashModeBGR8:
+    case splashModeXBGR8:
+        step = src->getMode() == splashModeBGR8 ? 3 : 4;
+        for (i = 0, q = buf; i < n; ++i, p += step, q += 3) {
+            q[0] = p[2];
+            q[1] = p[1];
+            q[2] = p[0];
+        }
+        return buf;
+    default:
+        return p;
+    }
+}
+
 SplashError Splash::composite(SplashBitmap *src, int xSrc, int ySrc, int xDest,
                               int yDest, int w, int h, bool noClip,
                               bool nonIsolated)
 {
-    SplashPipe pipe;
-    int        x0, x1, y0, y1, y, t;
+    SplashPipe     pipe;
+    SplashColorPtr colorBuf;
+    int            x0, x1, y0, y1, y, t;
+
+    flush();
 
     if (src->mode != bitmap->mode) {
         return splashErrModeMismatch;
     }
 
+    colorBuf = (SplashColorPtr)malloc(w > 0 ? 3 * w : 1);
     pipeInit(&pipe, NULL, (unsigned char)splashRound(state->fillAlpha * 255),
              !noClip || src->alpha != NULL, nonIsolated);
     if (noClip) {
@@ -5404,15 +6159,21 @@ SplashError Splash::composite(SplashBitmap *src, int xSrc, int ySrc, int xDest,
                 (this->*pipe.run)(
                     &pipe, xDest, xDest + w - 1, yDest + y,
                     src->getAlphaPtr() + (ySrc + y) * src->getWidth() + xSrc,
-                    src->getDataPtr() + (ySrc + y) * src->getRowSize() +
-                        xSrc * bitmapComps);
+                    getSrcColors(src,
+                                 src->getDataPtr() +
+                                     (ySrc + y) * src->getRowSize() +
+                                     xSrc * bitmapPixelSize,
+                                 w, colorBuf));
             }
         } else {
             for (y = 0; y < h; ++y) {
-                (this->*pipe.run)(&pipe, xDest, xDest + w - 1, yDest + y, NULL,
-                                  src->getDataPtr() +
-                                      (ySrc + y) * src->getRowSize() +
-                                      xSrc * bitmapComps);
+                (this->*pipe.run)(
+                    &pipe, xDest, xDest + w - 1, yDest + y, NULL,
+                    getSrcColors(src,
+                                 src->getDataPtr() +
+                                     (ySrc + y) * src->getRowSize() +
+                                     xSrc * bitmapPixelSize,
+                                 w, colorBuf));
             }
         }
     } else {
@@ -5446,10 +6207,13 @@ SplashError Splash::composite(SplashBitmap *src, int xSrc, int ySrc, int xDest,
                     }
                     // this uses shape instead of alpha, which isn't technically
                     // correct, but works out the same
-                    (this->*pipe.run)(&pipe, x0, x1 - 1, y, scanBuf + x0,
-                                      src->getDataPtr() +
-                                          (ySrc + y - yDest) * src->getRowSize() +
-                                          (xSrc + x0 - xDest) * bitmapComps);
+                    (this->*pipe.run)(
+                        &pipe, x0, x1 - 1, y, scanBuf + x0,
+                        getSrcColors(src,
+                                     src->getDataPtr() +
+                                         (ySrc + y - yDest) * src->getRowSize() +
+                                         (xSrc + x0 - xDest) * bitmapPixelSize,
+                                     x1 - x0, colorBuf));
                 }
             } else {
                 for (y = y0; y < y1; ++y) {
@@ -5458,15 +6222,18 @@ SplashError Splash::composite(SplashBitmap *src, int xSrc, int ySrc, int xDest,
                                                      state->strokeAdjust)) {
                         continue;
                     }
-                    (this->*pipe.run)(&pipe, xDest, xDest + w - 1, yDest + y,
-                                      scanBuf + x0,
-                                      src->getDataPtr() +
-                                          (ySrc + y - yDest) * src->getRowSize() +
-                                          (xSrc - xDest) * bitmapComps);
+                    (this->*pipe.run)(
+                        &pipe, xDest, xDest + w - 1, yDest + y, scanBuf + x0,
+                        getSrcColors(src,
+                                     src->getDataPtr() +
+                                         (ySrc + y - yDest) * src->getRowSize() +
+                                         (xSrc - xDest) * bitmapPixelSize,
+                                     w, colorBuf));
                 }
             }
         }
     }
+    free(colorBuf);
 
     return splashOk;
 }
@@ -5475,9 +6242,11 @@ void Splash::compositeBackground(SplashColorPtr color)
 {
     SplashColorPtr p;
     unsigned char *q;
-    unsigned char  alpha, alpha1, c, color0, color1, color2;
+    unsigned char  alpha, alpha1, c, color0;
     int            x, y, mask;
 
+    flush();
+
     switch (bitmap->mode) {
     case splashModeMono1:
         color0 = color[0];
@@ -5503,34 +6272,32 @@ void Splash::compositeBackground(SplashColorPtr color)
         }
         break;
     case splashModeMono8:
-        color0 = color[0];
         for (y = 0; y < bitmap->height; ++y) {
             p = &bitmap->data[y * bitmap->rowSize];
             q = &bitmap->alpha[y * bitmap->width];
-            for (x = 0; x < bitmap->width; ++x) {
-                alpha = *q++;
-                alpha1 = 255 - alpha;
-                p[0] = div255(alpha1 * color0 + alpha * p[0]);
-                ++p;
-            }
+            splashSpanCompositeBackground(p, q, color[0], 1, bitmap->width);
         }
         break;
     case splashModeRGB8:
+        for (y = 0; y < bitmap->height; ++y) {
+            p = &bitmap->data[y * bitmap->rowSize];
+            q = &bitmap->alpha[y * bitmap->width];
+            splashSpanCompositeBackground(p, q, color[0], 3, bitmap->width);
+            splashSpanCompositeBackground(p + 1, q, color[1], 3, bitmap->width);
+            splashSpanCompositeBackground(p + 2, q, color[2], 3, bitmap->width);
+        }
+        break;
     case splashModeBGR8:
-        color0 = color[0];
-        color1 = color[1];
-        color2 = color[2];
+    case splashModeXBGR8:
         for (y = 0; y < bitmap->height; ++y) {
             p = &bitmap->data[y * bitmap->rowSize];
             q = &bitmap->alpha[y * bitmap->width];
-            for (x = 0; x < bitmap->width; ++x) {
-                alpha = *q++;
-                alpha1 = 255 - alpha;
-                p[0] = div255(alpha1 * color0 + alpha * p[0]);
-                p[1] = div255(alpha1 * color1 + alpha * p[1]);
-                p[2] = div255(alpha1 * color2 + alpha * p[2]);
-                p += 3;
-            }
+            splashSpanCompositeBackground(p, q, color[2], bitmapPixelSize,
+                                          bitmap->width);
+            splashSpanCompositeBackground(p + 1, q, color[1], bitmapPixelSize,
+                                          bitmap->width);
+            splashSpanCompositeBackground(p + 2, q, color[0], bitmapPixelSize,
+                                          bitmap->width);
         }
         break;
     }
@@ -5543,6 +6310,8 @@ SplashError Splash::blitTransparent(SplashBitmap *src, int xSrc, int ySrc,
     SplashColorPtr p, q;
     int            x, y, mask, srcMask;
 
+    flush();
+
     if (src->mode != bitmap->mode) {
         return splashErrModeMismatch;
     }
@@ -5580,10 +6349,12 @@ SplashError Splash::blitTransparent(SplashBitmap *src, int xSrc, int ySrc,
         break;
     case splashModeRGB8:
     case splashModeBGR8:
+    case splashModeXBGR8:
         for (y = 0; y < h; ++y) {
-            p = &bitmap->data[(yDest + y) * bitmap->rowSize + 3 * xDest];
-            q = &src->data[(ySrc + y) * src->rowSize + 3 * xSrc];
-            memcpy(p, q, 3 * w);
+            p = &bitmap->data[(yDest + y) * bitmap->rowSize +
+                              bitmapPixelSize * xDest];
+            q = &src->data[(ySrc + y) * src->rowSize + bitmapPixelSize * xSrc];
+            memcpy(p, q, bitmapPixelSize * w);
         }
         break;
     }
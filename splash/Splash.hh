@@ -18,6 +18,7 @@ class SplashScreen;
 class SplashPath;
 class SplashXPath;
 class SplashFont;
+class SplashBands;
 struct SplashPipe;
 
 //------------------------------------------------------------------------
@@ -97,7 +98,9 @@ public:
     void setStrokePattern(SplashPattern *strokeColor);
     void setFillPattern(SplashPattern *fillColor);
     void setScreen(SplashScreen *screen);
-    void setBlendFunc(SplashBlendFunc func);
+    // <spanFunc> is an optional span version of <func>, for separable
+    // blend modes.
+    void setBlendFunc(SplashBlendFunc func, SplashBlendSpanFunc spanFunc = NULL);
     void setStrokeAlpha(SplashCoord alpha);
     void setFillAlpha(SplashCoord alpha);
     void setLineWidth(SplashCoord lineWidth);
@@ -179,6 +182,7 @@ public:
     //    Mono8        Mono8
     //    RGB8         RGB8
     //    BGR8         RGB8
+    //    XBGR8        RGB8
     //    CMYK8        CMYK8
     // The matrix behaves as for fillImageMask.
     SplashError drawImage(SplashImageSource src, void *srcData,
@@ -200,6 +204,19 @@ public:
     SplashError blitTransparent(SplashBitmap *src, int xSrc, int ySrc, int xDest,
                                 int yDest, int w, int h);
 
+    //----- banded rasterization
+
+    // Draw fills, strokes, glyphs, and images on <nThreads> threads,
+    // each one owning a horizontal band of the bitmap.  These
+    // operations are recorded, and drawn when flush() is called, or
+    // before any operation which reads the bitmap (clear, composite,
+    // etc.).  If <nThreads> is less than 2, or the bitmap is too small
+    // to be split, everything is drawn immediately.
+    void setThreads(int nThreads);
+
+    // Draw all recorded operations.
+    void flush();
+
     //----- misc
 
     // Construct a path for a stroke, given the path to be stroked and
@@ -213,17 +230,15 @@ public:
     SplashBitmap *getBitmap() { return bitmap; }
 
     // Set the minimum line width.
-    void setMinLineWidth(SplashCoord w) { minLineWidth = w; }
+    void setMinLineWidth(SplashCoord w)
+    {
+        minLineWidth = w;
+        stateChanged();
+    }
 
     // Get a bounding box which includes all modifications since the
     // last call to clearModRegion.
-    void getModRegion(int *xMin, int *yMin, int *xMax, int *yMax)
-    {
-        *xMin = modXMin;
-        *yMin = modYMin;
-        *xMax = modXMax;
-        *yMax = modYMax;
-    }
+    void getModRegion(int *xMin, int *yMin, int *xMax, int *yMax);
 
     // Clear the modified region bounding box.
     void clearModRegion();
@@ -236,10 +251,16 @@ public:
     void setDebugMode(bool debugModeA) { debugMode = debugModeA; }
 
 #if 1 //~tmp: turn off anti-aliasing temporarily
-    void setInShading(bool sh) { inShading = sh; }
+    void setInShading(bool sh)
+    {
+        inShading = sh;
+        stateChanged();
+    }
 #endif
 
 private:
+    void stateChanged();
+    void clipChanged();
     void pipeInit(SplashPipe *pipe, SplashPattern *pattern, unsigned char aInput,
                   bool usesShape, bool nonIsolatedGroup);
     void pipeRun(SplashPipe *pipe, int x0, int x1, int y, unsigned char *shapePtr,
@@ -252,6 +273,8 @@ private:
                            unsigned char *shapePtr, SplashColorPtr cSrcPtr);
     void pipeRunSimpleBGR8(SplashPipe *pipe, int x0, int x1, int y,
                            unsigned char *shapePtr, SplashColorPtr cSrcPtr);
+    void pipeRunSimpleXBGR8(SplashPipe *pipe, int x0, int x1, int y,
+                            unsigned char *shapePtr, SplashColorPtr cSrcPtr);
 #if SPLASH_CMYK
     void pipeRunSimpleCMYK8(SplashPipe *pipe, int x0, int x1, int y,
                             unsigned char *shapePtr, SplashColorPtr cSrcPtr);
@@ -264,6 +287,8 @@ private:
                           unsigned char *shapePtr, SplashColorPtr cSrcPtr);
     void pipeRunShapeBGR8(SplashPipe *pipe, int x0, int x1, int y,
                           unsigned char *shapePtr, SplashColorPtr cSrcPtr);
+    void pipeRunShapeXBGR8(SplashPipe *pipe, int x0, int x1, int y,
+                           unsigned char *shapePtr, SplashColorPtr cSrcPtr);
 #if SPLASH_CMYK
     void pipeRunShapeCMYK8(SplashPipe *pipe, int x0, int x1, int y,
                            unsigned char *shapePtr, SplashColorPtr cSrcPtr);
@@ -276,6 +301,19 @@ private:
                        unsigned char *shapePtr, SplashColorPtr cSrcPtr);
     void pipeRunAABGR8(SplashPipe *pipe, int x0, int x1, int y,
                        unsigned char *shapePtr, SplashColorPtr cSrcPtr);
+    void pipeRunAAXBGR8(SplashPipe *pipe, int x0, int x1, int y,
+                        unsigned char *shapePtr, SplashColorPtr cSrcPtr);
+    void pipeRunTranspMono8(SplashPipe *pipe, int x0, int x1, int y,
+                            unsigned char *shapePtr, SplashColorPtr cSrcPtr);
+    void pipeRunTranspRGB8(SplashPipe *pipe, int x0, int x1, int y,
+                           unsigned char *shapePtr, SplashColorPtr cSrcPtr);
+    void pipeRunTranspBGR8(SplashPipe *pipe, int x0, int x1, int y,
+                           unsigned char *shapePtr, SplashColorPtr cSrcPtr);
+    void pipeRunTranspXBGR8(SplashPipe *pipe, int x0, int x1, int y,
+                            unsigned char *shapePtr, SplashColorPtr cSrcPtr);
+    void pipeRunTransp(SplashPipe *pipe, int x0, int x1, int y,
+                       unsigned char *shapePtr, SplashColorPtr cSrcPtr,
+                       SplashColorMode mode);
 #if SPLASH_CMYK
     void pipeRunAACMYK8(SplashPipe *pipe, int x0, int x1, int y,
                         unsigned char *shapePtr, SplashColorPtr cSrcPtr);
@@ -287,6 +325,7 @@ private:
     void strokeNarrow(SplashPath *path);
     void drawStrokeSpan(SplashPipe *pipe, int x0, int x1, int y, bool noClip);
     void strokeWide(SplashPath *path, SplashCoord w);
+    void strokeThin(SplashPath *path, SplashCoord w);
     SplashPath *flattenPath(SplashPath *path, SplashCoord *matrix,
                             SplashCoord flatness);
     void        flattenCurve(SplashCoord x0, SplashCoord y0, SplashCoord x1,
@@ -375,6 +414,8 @@ private:
 
     SplashBitmap * bitmap;
     int            bitmapComps;
+    int            bitmapPixelSize; // bytes per pixel (see
+                                    //   splashColorModePixelSize)
     SplashState *  state;
     unsigned char *scanBuf;
     SplashBitmap // for transparency groups, this is the bitmap
@@ -387,6 +428,9 @@ private:
     bool             vectorAntialias;
     bool             inShading;
     bool             debugMode;
+    SplashBands *    bands; // recorded operations, if drawing in bands
+
+    friend class SplashBands;
 };
 
 #endif // XPDF_SPLASH_SPLASH_HH
@@ -0,0 +1,563 @@
+// -*- mode: c++; -*-
+// Copyright 2003-2013 Glyph & Cog, LLC
+
+#include <defs.hh>
+
+#include <cstring>
+#include <thread>
+
+#include <splash/SplashMath.hh>
+#include <splash/SplashBitmap.hh>
+#include <splash/SplashState.hh>
+#include <splash/SplashClip.hh>
+#include <splash/SplashPath.hh>
+#include <splash/SplashGlyphBitmap.hh>
+#include <splash/SplashBands.hh>
+
+//------------------------------------------------------------------------
+
+// number of bands per thread -- threads which finish early pick up
+// the remaining bands
+#define splashBandsPerThread 2
+
+// minimum height of a band, in pixels
+#define splashBandMinHeight 32
+
+// operations are flushed when this many are recorded, or when their
+// paths, glyphs, and images use this many bytes
+#define splashBandsMaxOps 65536
+#define splashBandsMaxDataSize (64 << 20)
+
+// images larger than this (in bytes) are drawn immediately
+#define splashBandsMaxImageSize (32 << 20)
+
+// flushes with fewer operations than this are drawn on the calling
+// thread
+#define splashBandsMinOpsPerFlush 16
+
+// distance (in pixels) by which the rows covered by an operation are
+// extended, to allow for anti-aliasing, stroke adjustment, and image
+// rounding
+#define splashBandPad 2
+
+//------------------------------------------------------------------------
+// SplashBandState
+//------------------------------------------------------------------------
+
+// A copy of the Splash state, shared by the operations recorded while
+// it was current.
+struct SplashBandState
+{
+    SplashBandState() : state(NULL) { }
+    ~SplashBandState() { delete state; }
+
+    SplashState *               state; // uses <clip> (clipIsShared is set)
+    std::shared_ptr< SplashClip > clip;
+    SplashCoord                 minLineWidth;
+    bool                        inShading;
+    SplashBitmap *              groupBackBitmap;
+    int                         groupBackX, groupBackY;
+};
+
+//------------------------------------------------------------------------
+// SplashBandOp
+//------------------------------------------------------------------------
+
+struct SplashBandOp
+{
+    SplashBandOp() : glyph() { }
+
+    SplashBandOpKind                   kind;
+    std::shared_ptr< SplashBandState > state;
+    int                                yMin, yMax; // rows covered
+
+    // stroke, fill
+    std::unique_ptr< SplashPath > path;
+    bool                          eo;
+
+    // glyph (glyph.data points to <data>)
+    int               x0, y0;
+    SplashGlyphBitmap glyph;
+
+    // image mask, image
+    SplashCoord     mat[6];
+    int             w, h;
+    SplashColorMode srcMode;
+    bool            srcAlpha;
+    bool            glyphMode;
+    bool            interpolate;
+
+    std::vector< unsigned char > data, alpha;
+};
+
+// Image source which reads the lines copied into an operation.
+struct SplashBandImageReader
+{
+    SplashBandOp *op;
+    int           lineSize; // bytes per line in op->data
+    int           y; // next line
+};
+
+static bool readBandMaskLine(void *data, SplashColorPtr line)
+{
+    SplashBandImageReader *reader = (SplashBandImageReader *)data;
+
+    if (reader->y >= reader->op->h) {
+        return false;
+    }
+    memcpy(line, &reader->op->data[(size_t)reader->y * reader->lineSize],
+           reader->lineSize);
+    ++reader->y;
+    return true;
+}
+
+static bool readBandImageLine(void *data, SplashColorPtr colorLine,
+                              unsigned char *alphaLine)
+{
+    SplashBandImageReader *reader = (SplashBandImageReader *)data;
+    SplashBandOp *         op = reader->op;
+
+    if (reader->y >= op->h) {
+        return false;
+    }
+    memcpy(colorLine, &op->data[(size_t)reader->y * reader->lineSize],
+           reader->lineSize);
+    if (alphaLine) {
+        memcpy(alphaLine, &op->alpha[(size_t)reader->y * op->w], op->w);
+    }
+    ++reader->y;
+    return true;
+}
+
+//------------------------------------------------------------------------
+// SplashBand
+//------------------------------------------------------------------------
+
+struct SplashBand
+{
+    SplashBand() : splash(NULL) { }
+    ~SplashBand() { delete splash; }
+
+    int     yMin, yMax; // rows [yMin, yMax)
+    Splash *splash; // draws into the shared bitmap
+
+    // the state currently loaded into <splash>, and the clip region it
+    // was made from
+    std::shared_ptr< SplashBandState > state;
+    std::shared_ptr< SplashClip >      clipSrc;
+    std::unique_ptr< SplashClip >      clip; // limited to the band
+};
+
+//------------------------------------------------------------------------
+// SplashBands
+//------------------------------------------------------------------------
+
+bool SplashBands::canSplit(SplashBitmap *bitmap, int nThreads)
+{
+    return nThreads > 1 && bitmap->getHeight() >= 2 * splashBandMinHeight;
+}
+
+SplashBands::SplashBands(Splash *splashA, int nThreadsA)
+{
+    SplashBitmap *bitmap;
+    SplashBand *  band;
+    int           nBands, height, i;
+
+    splash = splashA;
+    nThreads = nThreadsA;
+    opsDataSize = 0;
+
+    bitmap = splash->bitmap;
+    height = bitmap->getHeight();
+    nBands = nThreads * splashBandsPerThread;
+    if (nBands > height / splashBandMinHeight) {
+        nBands = height / splashBandMinHeight;
+    }
+    for (i = 0; i < nBands; ++i) {
+        band = new SplashBand();
+        band->yMin = (int)(((long long)height * i) / nBands);
+        band->yMax = (int)(((long long)height * (i + 1)) / nBands);
+        band->splash = new Splash(bitmap, splash->vectorAntialias,
+                                  splash->state->screen);
+        bands.emplace_back(band);
+    }
+}
+
+SplashBands::~SplashBands() { }
+
+void SplashBands::stateChanged()
+{
+    curState.reset();
+}
+
+void SplashBands::clipChanged()
+{
+    curState.reset();
+    curClip.reset();
+}
+
+void SplashBands::stroke(SplashPath *path)
+{
+    SplashBandOp *op;
+    SplashCoord   yMin, yMax, t0, t1, t2, t3, w, lineWidth, miterLimit, pad;
+
+    // Splash::stroke widens lines to the min line width, using this
+    // approximation of the transformed line width
+    t0 = splashAbs(splash->state->matrix[0]);
+    t1 = splashAbs(splash->state->matrix[1]);
+    t2 = splashAbs(splash->state->matrix[2]);
+    t3 = splashAbs(splash->state->matrix[3]);
+    if (t0 * t3 >= t1 * t2) {
+        w = (t0 < t3) ? t0 : t3;
+    } else {
+        w = (t1 < t2) ? t1 : t2;
+    }
+    lineWidth = splash->state->lineWidth;
+    if (w > 0 && w * lineWidth < splash->minLineWidth) {
+        lineWidth = splash->minLineWidth / w;
+    }
+
+    // miter joins extend up to miterLimit * lineWidth / 2 from the
+    // path, and projecting caps up to sqrt(2) * lineWidth / 2
+    miterLimit = splash->state->miterLimit;
+    if (miterLimit < 2) {
+        miterLimit = 2;
+    }
+    pad = (SplashCoord)0.5 * lineWidth * miterLimit * (t0 + t1 + t2 + t3);
+
+    getPathYBounds(path, &yMin, &yMax);
+    op = addOp(splashBandOpStroke, yMin - pad, yMax + pad);
+    op->path.reset(path->copy());
+    opDone(path->getLength() * (sizeof(SplashPathPoint) + 1));
+}
+
+void SplashBands::fill(SplashPath *path, bool eo)
+{
+    SplashBandOp *op;
+    SplashPath *  path2;
+    SplashCoord   yMin, yMax;
+
+    // Splash::fill modifies some paths (see Splash::tweakFillPath) --
+    // this is done here, as it would be without bands, so the bands
+    // can share the copy
+    path2 = splash->tweakFillPath(path);
+
+    getPathYBounds(path2, &yMin, &yMax);
+    op = addOp(splashBandOpFill, yMin, yMax);
+    op->path.reset(path2->copy());
+    op->eo = eo;
+    opDone(path2->getLength() * (sizeof(SplashPathPoint) + 1));
+    if (path2 != path) {
+        delete path2;
+    }
+}
+
+void SplashBands::fillGlyph(int x0, int y0, SplashGlyphBitmap *glyph)
+{
+    SplashBandOp *op;
+    size_t        size;
+    int           yg;
+
+    yg = y0 - glyph->y;
+    op = addOp(splashBandOpGlyph, yg, yg + glyph->h - 1);
+    op->x0 = x0;
+    op->y0 = y0;
+    op->glyph = *glyph;
+    if (glyph->aa) {
+        size = (size_t)glyph->w * glyph->h;
+    } else {
+        size = (size_t)((glyph->w + 7) >> 3) * glyph->h;
+    }
+    op->data.assign(glyph->data, glyph->data + size);
+    op->glyph.data = op->data.data();
+    op->glyph.freeData = false;
+    opDone(size);
+}
+
+bool SplashBands::fillImageMask(SplashImageMaskSource src, void *srcData, int w,
+                                int h, SplashCoord *mat, bool glyphMode,
+                                bool interpolate)
+{
+    SplashBandOp *op;
+    SplashCoord   yMin, yMax;
+    size_t        size;
+    int           y;
+
+    if (w <= 0 || h <= 0 ||
+        (size = (size_t)w * h) > (size_t)splashBandsMaxImageSize) {
+        return false;
+    }
+
+    getImageYBounds(mat, &yMin, &yMax);
+    op = addOp(splashBandOpImageMask, yMin, yMax);
+    memcpy(op->mat, mat, 6 * sizeof(SplashCoord));
+    op->w = w;
+    op->h = h;
+    op->glyphMode = glyphMode;
+    op->interpolate = interpolate;
+    op->data.resize(size);
+    for (y = 0; y < h; ++y) {
+        (*src)(srcData, &op->data[(size_t)y * w]);
+    }
+    opDone(size);
+    return true;
+}
+
+bool SplashBands::drawImage(SplashImageSource src, void *srcData,
+                            SplashColorMode srcMode, bool srcAlpha, int w, int h,
+                            SplashCoord *mat, bool interpolate)
+{
+    SplashBandOp *op;
+    SplashCoord   yMin, yMax;
+    size_t        lineSize, size;
+    int           y;
+
+    if (w <= 0 || h <= 0) {
+        return false;
+    }
+    lineSize = (size_t)w * splashColorModeNComps[srcMode];
+    size = (lineSize + (srcAlpha ? w : 0)) * h;
+    if (size > (size_t)splashBandsMaxImageSize) {
+        return false;
+    }
+
+    getImageYBounds(mat, &yMin, &yMax);
+    op = addOp(splashBandOpImage, yMin, yMax);
+    memcpy(op->mat, mat, 6 * sizeof(SplashCoord));
+    op->w = w;
+    op->h = h;
+    op->srcMode = srcMode;
+    op->srcAlpha = srcAlpha;
+    op->interpolate = interpolate;
+    op->data.resize(lineSize * h);
+    if (srcAlpha) {
+        op->alpha.resize((size_t)w * h);
+    }
+    for (y = 0; y < h; ++y) {
+        (*src)(srcData, &op->data[y * lineSize],
+               srcAlpha ? &op->alpha[(size_t)y * w] : NULL);
+    }
+    opDone(size);
+    return true;
+}
+
+SplashBandOp *SplashBands::addOp(SplashBandOpKind kind, SplashCoord yMin,
+                                 SplashCoord yMax)
+{
+    SplashBandOp *op;
+    SplashCoord   height;
+
+    // copy the state, if it changed since the last operation
+    if (!curState) {
+        if (!curClip) {
+            curClip.reset(splash->state->clip->copy());
+        }
+        curState = std::make_shared< SplashBandState >();
+        curState->state = splash->state->copy();
+        curState->state->clip = curClip.get();
+        curState->clip = curClip;
+        curState->minLineWidth = splash->minLineWidth;
+        curState->inShading = splash->inShading;
+        curState->groupBackBitmap = splash->groupBackBitmap;
+        curState->groupBackX = splash->groupBackX;
+        curState->groupBackY = splash->groupBackY;
+    }
+
+    op = new SplashBandOp();
+    op->kind = kind;
+    op->state = curState;
+
+    // convert the y range to rows -- this also handles NaNs and huge
+    // values
+    height = (SplashCoord)splash->bitmap->getHeight();
+    yMin -= splashBandPad;
+    yMax += splashBandPad;
+    op->yMin = yMin > 0 ? (yMin < height ? splashFloor(yMin) : (int)height) : 0;
+    op->yMax = yMax < height ? (yMax > 0 ? splashCeil(yMax) : -1)
+                             : (int)height - 1;
+
+    ops.emplace_back(op);
+    return op;
+}
+
+void SplashBands::opDone(size_t dataSize)
+{
+    opsDataSize += dataSize;
+    if (ops.size() >= splashBandsMaxOps ||
+        opsDataSize >= (size_t)splashBandsMaxDataSize) {
+        flush();
+    }
+}
+
+void SplashBands::getPathYBounds(SplashPath *path, SplashCoord *yMin,
+                                 SplashCoord *yMax)
+{
+    SplashCoord * mat;
+    SplashCoord   x, y, yt;
+    unsigned char f;
+    int           i;
+
+    // curves lie inside the convex hull of their control points
+    mat = splash->state->matrix;
+    *yMin = *yMax = 0;
+    for (i = 0; i < path->getLength(); ++i) {
+        path->getPoint(i, &x, &y, &f);
+        yt = x * mat[1] + y * mat[3] + mat[5];
+        if (i == 0 || yt < *yMin) {
+            *yMin = yt;
+        }
+        if (i == 0 || yt > *yMax) {
+            *yMax = yt;
+        }
+    }
+}
+
+void SplashBands::getImageYBounds(SplashCoord *mat, SplashCoord *yMin,
+                                  SplashCoord *yMax)
+{
+    SplashCoord y[4];
+    int         i;
+
+    // corners of the unit square
+    y[0] = mat[5];
+    y[1] = mat[1] + mat[5];
+    y[2] = mat[3] + mat[5];
+    y[3] = mat[1] + mat[3] + mat[5];
+    *yMin = *yMax = y[0];
+    for (i = 1; i < 4; ++i) {
+        if (y[i] < *yMin) {
+            *yMin = y[i];
+        }
+        if (y[i] > *yMax) {
+            *yMax = y[i];
+        }
+    }
+}
+
+void SplashBands::flush()
+{
+    std::vector< std::thread > threads;
+    SplashBand *               band;
+    int                        n, i, xMin, yMin, xMax, yMax;
+
+    if (ops.empty()) {
+        return;
+    }
+
+    n = (int)bands.size() < nThreads ? (int)bands.size() : nThreads;
+    if (ops.size() < splashBandsMinOpsPerFlush) {
+        n = 1;
+    }
+    nextBand = 0;
+    for (i = 1; i < n; ++i) {
+        threads.emplace_back(&SplashBands::drawBands, this);
+    }
+    drawBands();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ops.clear();
+    opsDataSize = 0;
+
+    // merge the modified regions
+    for (i = 0; i < (int)bands.size(); ++i) {
+        band = bands[i].get();
+        band->splash->getModRegion(&xMin, &yMin, &xMax, &yMax);
+        if (xMax >= xMin && yMax >= yMin) {
+            if (xMin < splash->modXMin) {
+                splash->modXMin = xMin;
+            }
+            if (yMin < splash->modYMin) {
+                splash->modYMin = yMin;
+            }
+            if (xMax > splash->modXMax) {
+                splash->modXMax = xMax;
+            }
+            if (yMax > splash->modYMax) {
+                splash->modYMax = yMax;
+            }
+        }
+        band->splash->clearModRegion();
+    }
+}
+
+void SplashBands::drawBands()
+{
+    int i;
+
+    while ((i = nextBand++) < (int)bands.size()) {
+        drawBand(bands[i].get());
+    }
+}
+
+void SplashBands::drawBand(SplashBand *band)
+{
+    SplashBandOp *        op;
+    SplashBandImageReader reader;
+
+    for (auto &opPtr : ops) {
+        op = opPtr.get();
+        if (op->yMax < band->yMin || op->yMin >= band->yMax) {
+            continue;
+        }
+        loadState(band, op->state);
+        switch (op->kind) {
+        case splashBandOpStroke:
+            band->splash->stroke(op->path.get());
+            break;
+        case splashBandOpFill:
+            band->splash->fill(op->path.get(), op->eo);
+            break;
+        case splashBandOpGlyph:
+            band->splash->fillGlyph2(op->x0, op->y0, &op->glyph);
+            break;
+        case splashBandOpImageMask:
+            reader.op = op;
+            reader.lineSize = op->w;
+            reader.y = 0;
+            band->splash->fillImageMask(&readBandMaskLine, &reader, op->w, op->h,
+                                        op->mat, op->glyphMode,
+                                        op->interpolate);
+            break;
+        case splashBandOpImage:
+            reader.op = op;
+            reader.lineSize = op->w * splashColorModeNComps[op->srcMode];
+            reader.y = 0;
+            band->splash->drawImage(&readBandImageLine, &reader, op->srcMode,
+                                    op->srcAlpha, op->w, op->h, op->mat,
+                                    op->interpolate);
+            break;
+        }
+    }
+}
+
+void SplashBands::loadState(SplashBand *                              band,
+                            const std::shared_ptr< SplashBandState > &st)
+{
+    Splash *     bandSplash;
+    SplashState *state;
+
+    if (band->state == st) {
+        return;
+    }
+    bandSplash = band->splash;
+
+    // the band's clip region is rebuilt only when the clip changes
+    if (band->clipSrc != st->clip) {
+        band->clip.reset(st->clip->copy());
+        band->clip->limitToRows(band->yMin, band->yMax);
+        band->clipSrc = st->clip;
+    }
+
+    state = st->state->copy();
+    state->clip = band->clip.get();
+    delete bandSplash->state;
+    bandSplash->state = state;
+    bandSplash->minLineWidth = st->minLineWidth;
+    bandSplash->inShading = st->inShading;
+    bandSplash->groupBackBitmap = st->groupBackBitmap;
+    bandSplash->groupBackX = st->groupBackX;
+    bandSplash->groupBackY = st->groupBackY;
+    band->state = st;
+}
@@ -0,0 +1,111 @@
+// -*- mode: c++; -*-
+// Copyright 2003-2013 Glyph & Cog, LLC
+
+#ifndef XPDF_SPLASH_SPLASHBANDS_HH
+#define XPDF_SPLASH_SPLASHBANDS_HH
+
+#include <defs.hh>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <splash/SplashTypes.hh>
+#include <splash/Splash.hh>
+
+class SplashBitmap;
+class SplashClip;
+class SplashPath;
+struct SplashGlyphBitmap;
+struct SplashBand;
+struct SplashBandOp;
+struct SplashBandState;
+
+//------------------------------------------------------------------------
+
+enum SplashBandOpKind {
+    splashBandOpStroke,
+    splashBandOpFill,
+    splashBandOpGlyph,
+    splashBandOpImageMask,
+    splashBandOpImage
+};
+
+//------------------------------------------------------------------------
+// SplashBands
+//------------------------------------------------------------------------
+
+// Records the drawing operations of a Splash object, and replays them
+// on several threads.  The bitmap is split into horizontal bands, each
+// one with its own Splash object, whose clip region is limited to the
+// band.  Each operation is drawn by all the bands it overlaps, in the
+// order it was recorded, so the result is identical to drawing
+// everything on one thread.
+//
+// Operations are recorded with a copy of the Splash state.  Copies are
+// shared by consecutive operations, until the state changes.  Soft
+// masks and transparency group backdrops are not copied: Splash flushes
+// the recorded operations before deleting a soft mask, and the caller
+// must flush a Splash object before reading its bitmap.
+class SplashBands
+{
+public:
+    // Returns true if <bitmap> is large enough to be split into bands
+    // for <nThreads> threads.
+    static bool canSplit(SplashBitmap *bitmap, int nThreads);
+
+    SplashBands(Splash *splashA, int nThreadsA);
+    ~SplashBands();
+
+    // Called by Splash when its state (other than the clip region), or
+    // its clip region, changes.
+    void stateChanged();
+    void clipChanged();
+
+    // Record a drawing operation -- the arguments are the same as for
+    // the corresponding Splash functions.  Paths, glyphs, and image
+    // data are copied.
+    void stroke(SplashPath *path);
+    void fill(SplashPath *path, bool eo);
+    void fillGlyph(int x0, int y0, SplashGlyphBitmap *glyph);
+
+    // These return false, without recording anything, if the image is
+    // too large to be copied.
+    bool fillImageMask(SplashImageMaskSource src, void *srcData, int w, int h,
+                       SplashCoord *mat, bool glyphMode, bool interpolate);
+    bool drawImage(SplashImageSource src, void *srcData, SplashColorMode srcMode,
+                   bool srcAlpha, int w, int h, SplashCoord *mat,
+                   bool interpolate);
+
+    // Draw all recorded operations, and wait for them to be finished.
+    void flush();
+
+private:
+    SplashBandOp *addOp(SplashBandOpKind kind, SplashCoord yMin,
+                        SplashCoord yMax);
+    void          opDone(size_t dataSize);
+    void          getPathYBounds(SplashPath *path, SplashCoord *yMin,
+                                 SplashCoord *yMax);
+    void          getImageYBounds(SplashCoord *mat, SplashCoord *yMin,
+                                  SplashCoord *yMax);
+    void          drawBands();
+    void          drawBand(SplashBand *band);
+    void          loadState(SplashBand *band,
+                            const std::shared_ptr< SplashBandState > &st);
+
+    Splash *splash;
+    int     nThreads;
+
+    std::vector< std::unique_ptr< SplashBand > >   bands;
+    std::vector< std::unique_ptr< SplashBandOp > > ops;
+    size_t                                         opsDataSize;
+
+    // copies of the current state and clip region, shared by the
+    // operations recorded since the last change
+    std::shared_ptr< SplashBandState > curState;
+    std::shared_ptr< SplashClip >      curClip;
+
+    std::atomic< int > nextBand; // next band to be drawn during a flush
+};
+
+#endif // XPDF_SPLASH_SPLASHBANDS_HH
@@ -6,6 +6,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <climits>
+#include <cstdint>
 
 #include <splash/SplashErrorCodes.hh>
 #include <splash/SplashBitmap.hh>
@@ -15,11 +16,14 @@
 //------------------------------------------------------------------------
 
 SplashBitmap::SplashBitmap(int widthA, int heightA, int rowPad,
-                           SplashColorMode modeA, bool alphaA, bool topDown)
+                           SplashColorMode modeA, bool alphaA, bool topDown,
+                           std::shared_ptr< SplashBitmapPool > poolA)
 {
     width = widthA;
     height = heightA;
     mode = modeA;
+    pool = poolA;
+    ownData = true;
     switch (mode) {
     case splashModeMono1:
         if (width > 0) {
@@ -43,6 +47,16 @@ SplashBitmap::SplashBitmap(int widthA, int heightA, int rowPad,
             rowSize = -1;
         }
         break;
+    case splashModeXBGR8:
+        if (width > 0 && width <= (INT_MAX - splashBitmapRowAlign) / 4) {
+            rowSize = width * 4;
+        } else {
+            rowSize = -1;
+        }
+        if (rowPad < splashBitmapRowAlign) {
+            rowPad = splashBitmapRowAlign;
+        }
+        break;
 #if SPLASH_CMYK
     case splashModeCMYK8:
         if (width > 0 && width <= INT_MAX / 4) {
@@ -57,13 +71,40 @@ SplashBitmap::SplashBitmap(int widthA, int heightA, int rowPad,
         rowSize += rowPad - 1;
         rowSize -= rowSize % rowPad;
     }
-    data = (SplashColorPtr)calloc(height, rowSize);
-    if (!topDown) {
+    if (rowSize > 0 && height > 0 && (size_t)height <= SIZE_MAX / rowSize) {
+        dataSize = (size_t)height * rowSize;
+        data = allocData(dataSize);
+    } else {
+        dataSize = 0;
+        data = NULL;
+    }
+    if (data && !topDown) {
         data += (height - 1) * rowSize;
         rowSize = -rowSize;
     }
-    if (alphaA) {
-        alpha = (unsigned char *)calloc(width, height);
+    if (alphaA && width > 0 && height > 0 &&
+        (size_t)height <= SIZE_MAX / width) {
+        alpha = allocData((size_t)width * height);
+    } else {
+        alpha = NULL;
+    }
+}
+
+SplashBitmap::SplashBitmap(int widthA, int heightA, SplashColorPtr dataA,
+                           int rowSizeA, SplashColorMode modeA, bool alphaA,
+                           std::shared_ptr< SplashBitmapPool > poolA)
+{
+    width = widthA;
+    height = heightA;
+    rowSize = rowSizeA;
+    mode = modeA;
+    data = dataA;
+    dataSize = (size_t)height * rowSize;
+    ownData = false;
+    pool = poolA;
+    if (alphaA && width > 0 && height > 0 &&
+        (size_t)height <= SIZE_MAX / width) {
+        alpha = allocData((size_t)width * height);
     } else {
         alpha = NULL;
     }
@@ -71,14 +112,33 @@ SplashBitmap::SplashBitmap(int widthA, int heightA, int rowPad,
 
 SplashBitmap::~SplashBitmap()
 {
-    if (data) {
+    if (data && ownData) {
         if (rowSize < 0) {
-            free(data + (height - 1) * rowSize);
+            freeData(data + (height - 1) * rowSize, dataSize);
         } else {
-            free(data);
+            freeData(data, dataSize);
         }
     }
-    free(alpha);
+    if (alpha) {
+        freeData(alpha, (size_t)width * height);
+    }
+}
+
+unsigned char *SplashBitmap::allocData(size_t size)
+{
+    if (pool) {
+        return pool->alloc(size);
+    }
+    return SplashBitmapPool::allocAligned(size);
+}
+
+void SplashBitmap::freeData(unsigned char *p, size_t size)
+{
+    if (pool) {
+        pool->release(p, size);
+    } else {
+        free(p);
+    }
 }
 
 SplashError SplashBitmap::writePNMFile(const char *fileName)
@@ -146,6 +206,21 @@ SplashError SplashBitmap::writePNMFile(FILE *f)
         }
         break;
 
+    case splashModeXBGR8:
+        fprintf(f, "P6\n%d %d\n255\n", width, height);
+        row = data;
+        for (y = 0; y < height; ++y) {
+            p = row;
+            for (x = 0; x < width; ++x) {
+                fputc(splashXBGR8R(p), f);
+                fputc(splashXBGR8G(p), f);
+                fputc(splashXBGR8B(p), f);
+                p += 4;
+            }
+            row += rowSize;
+        }
+        break;
+
 #if SPLASH_CMYK
     case splashModeCMYK8:
         // PNM doesn't support CMYK
@@ -200,6 +275,12 @@ void SplashBitmap::getPixel(int x, int y, SplashColorPtr pixel)
         pixel[1] = p[1];
         pixel[2] = p[0];
         break;
+    case splashModeXBGR8:
+        p = &data[y * rowSize + 4 * x];
+        pixel[0] = p[2];
+        pixel[1] = p[1];
+        pixel[2] = p[0];
+        break;
 #if SPLASH_CMYK
     case splashModeCMYK8:
         p = &data[y * rowSize + 4 * x];
@@ -7,7 +7,11 @@
 #include <defs.hh>
 
 #include <cstdio>
+
+#include <memory>
+
 #include <splash/SplashTypes.hh>
+#include <splash/SplashBitmapPool.hh>
 
 //------------------------------------------------------------------------
 // SplashBitmap
@@ -18,10 +22,21 @@ class SplashBitmap
 public:
     // Create a new bitmap.  It will have <widthA> x <heightA> pixels in
     // color mode <modeA>.  Rows will be padded out to a multiple of
-    // <rowPad> bytes.  If <topDown> is false, the bitmap will be stored
-    // upside-down, i.e., with the last row first in memory.
+    // <rowPad> bytes (and of splashBitmapRowAlign bytes in XBGR8 mode).
+    // If <topDown> is false, the bitmap will be stored upside-down,
+    // i.e., with the last row first in memory.  If <poolA> is non-NULL,
+    // the data is allocated from, and given back to, that pool.
     SplashBitmap(int widthA, int heightA, int rowPad, SplashColorMode modeA,
-                 bool alphaA, bool topDown = true);
+                 bool alphaA, bool topDown = true,
+                 std::shared_ptr< SplashBitmapPool > poolA = NULL);
+
+    // Create a top-down bitmap on color data owned by the caller, e.g.,
+    // a shared memory segment: <dataA> holds <heightA> rows of
+    // <rowSizeA> bytes, and must outlive the bitmap.  The alpha plane,
+    // if any, is allocated as usual.
+    SplashBitmap(int widthA, int heightA, SplashColorPtr dataA, int rowSizeA,
+                 SplashColorMode modeA, bool alphaA,
+                 std::shared_ptr< SplashBitmapPool > poolA = NULL);
 
     ~SplashBitmap();
 
@@ -40,12 +55,16 @@ public:
     void          getPixel(int x, int y, SplashColorPtr pixel);
     unsigned char getAlpha(int x, int y);
 
-    // Caller takes ownership of the bitmap data.  The SplashBitmap
-    // object is no longer valid -- the next call should be to the
-    // destructor.
+    // Caller takes ownership of the bitmap data (to be freed with
+    // free()), which must not be caller-owned already.  The
+    // SplashBitmap object is no longer valid -- the next call should be
+    // to the destructor.
     SplashColorPtr takeData();
 
 private:
+    unsigned char *allocData(size_t size);
+    void           freeData(unsigned char *p, size_t size);
+
     int width, height; // size of bitmap
     int rowSize; // size of one row of data, in bytes
         //   - negative for bottom-up bitmaps
@@ -53,6 +72,10 @@ private:
     SplashColorPtr  data; // pointer to row zero of the color data
     unsigned char * alpha; // pointer to row zero of the alpha data
         //   (always top-down)
+    size_t dataSize; // size of the color data, in bytes
+    bool   ownData; // set if the color data is freed with the bitmap
+    std::shared_ptr< SplashBitmapPool > pool; // pool used for the data,
+                                              //   or NULL
 
     friend class Splash;
 };
@@ -0,0 +1,130 @@
+// -*- mode: c++; -*-
+// Copyright 2003-2013 Glyph & Cog, LLC
+
+#include <defs.hh>
+
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+
+#include <splash/SplashBitmapPool.hh>
+
+//------------------------------------------------------------------------
+
+// smallest size class
+#define splashBitmapPoolMinSize 64
+
+//------------------------------------------------------------------------
+// SplashBitmapPool
+//------------------------------------------------------------------------
+
+SplashBitmapPool::SplashBitmapPool(size_t maxCachedA)
+{
+    cached = 0;
+    maxCached = maxCachedA;
+}
+
+SplashBitmapPool::~SplashBitmapPool()
+{
+    clear();
+}
+
+// Size classes are 64, 80, 96, 112, 128, 160, 192, 224, 256, ... bytes.
+int SplashBitmapPool::sizeClass(size_t size, size_t *classSize)
+{
+    size_t base, step;
+    int    e, j;
+
+    if (size <= splashBitmapPoolMinSize) {
+        *classSize = splashBitmapPoolMinSize;
+        return 0;
+    }
+    base = splashBitmapPoolMinSize;
+    for (e = 0; (base << 1) < size; ++e) {
+        base <<= 1;
+    }
+    step = base / 4;
+    j = (int)((size - base + step - 1) / step);
+    *classSize = base + j * step;
+    return 1 + 4 * e + (j - 1);
+}
+
+unsigned char *SplashBitmapPool::alloc(size_t size)
+{
+    unsigned char *p;
+    size_t         classSize;
+    int            cls;
+
+    if (size > SIZE_MAX / 2) {
+        return NULL;
+    }
+    cls = sizeClass(size, &classSize);
+    p = NULL;
+    {
+        std::lock_guard< std::mutex > lock(mutex);
+        if (cls < (int)freeBufs.size() && !freeBufs[cls].empty()) {
+            p = freeBufs[cls].back();
+            freeBufs[cls].pop_back();
+            cached -= classSize;
+        }
+    }
+    if (p) {
+        memset(p, 0, size);
+        return p;
+    }
+    return allocAligned(classSize);
+}
+
+void SplashBitmapPool::release(unsigned char *p, size_t size)
+{
+    size_t classSize;
+    int    cls;
+
+    if (!p) {
+        return;
+    }
+    cls = sizeClass(size, &classSize);
+    {
+        std::lock_guard< std::mutex > lock(mutex);
+        if (cached + classSize <= maxCached) {
+            if (cls >= (int)freeBufs.size()) {
+                freeBufs.resize(cls + 1);
+            }
+            freeBufs[cls].push_back(p);
+            cached += classSize;
+            return;
+        }
+    }
+    free(p);
+}
+
+void SplashBitmapPool::clear()
+{
+    std::lock_guard< std::mutex > lock(mutex);
+
+    for (auto &bufs : freeBufs) {
+        for (auto p : bufs) {
+            free(p);
+        }
+        bufs.clear();
+    }
+    cached = 0;
+}
+
+size_t SplashBitmapPool::getCachedSize()
+{
+    std::lock_guard< std::mutex > lock(mutex);
+
+    return cached;
+}
+
+unsigned char *SplashBitmapPool::allocAligned(size_t size)
+{
+    void *p;
+
+    if (posix_memalign(&p, splashBitmapRowAlign, size ? size : 1)) {
+        return NULL;
+    }
+    memset(p, 0, size);
+    return (unsigned char *)p;
+}
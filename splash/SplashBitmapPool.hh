@@ -0,0 +1,66 @@
+// -*- mode: c++; -*-
+// Copyright 2003-2013 Glyph & Cog, LLC
+
+#ifndef XPDF_SPLASH_SPLASHBITMAPPOOL_HH
+#define XPDF_SPLASH_SPLASHBITMAPPOOL_HH
+
+#include <defs.hh>
+
+#include <cstddef>
+
+#include <mutex>
+#include <vector>
+
+//------------------------------------------------------------------------
+
+// Bitmap data (and each row of an XBGR8 bitmap) is aligned to this
+// many bytes.
+#define splashBitmapRowAlign 64
+
+// Default limit on the size of the buffers kept by a SplashBitmapPool.
+#define splashBitmapPoolDefaultMax (64 * 1024 * 1024)
+
+//------------------------------------------------------------------------
+// SplashBitmapPool
+//------------------------------------------------------------------------
+
+// A cache of bitmap data buffers, shared by the bitmaps allocated from
+// it (see SplashBitmap).  Buffers are rounded up to a size class (four
+// classes per power of two), and the buffers released by deleted
+// bitmaps are reused by the next bitmaps in the same class, up to a
+// limit on the total size of the cached buffers.  The pool can be used
+// from several threads.
+class SplashBitmapPool
+{
+public:
+    SplashBitmapPool(size_t maxCachedA = splashBitmapPoolDefaultMax);
+    ~SplashBitmapPool();
+
+    // Returns a zero-filled buffer of at least <size> bytes, aligned to
+    // splashBitmapRowAlign bytes, or NULL if the allocation fails.  The
+    // buffer can be freed with free() instead of being released.
+    unsigned char *alloc(size_t size);
+
+    // Give a buffer obtained from alloc(<size>) back to the pool.
+    void release(unsigned char *p, size_t size);
+
+    // Free all cached buffers.
+    void clear();
+
+    // Get the total size of the cached buffers.
+    size_t getCachedSize();
+
+    // Allocate a zero-filled, aligned buffer, without a pool.
+    static unsigned char *allocAligned(size_t size);
+
+private:
+    static int sizeClass(size_t size, size_t *classSize);
+
+    std::mutex                                     mutex;
+    std::vector< std::vector< unsigned char * > > freeBufs; // indexed by
+                                                            //   size class
+    size_t cached; // total size of the cached buffers
+    size_t maxCached; // limit on cached
+};
+
+#endif // XPDF_SPLASH_SPLASHBITMAPPOOL_HH
@@ -12,19 +12,9 @@
 #include <splash/SplashPath.hh>
 #include <splash/SplashXPath.hh>
 #include <splash/SplashXPathScanner.hh>
+#include <splash/SplashClipMask.hh>
 #include <splash/SplashClip.hh>
 
-//------------------------------------------------------------------------
-
-// Compute x * y / 255, where x and y are in [0, 255].
-static inline unsigned char mul255(unsigned char x, unsigned char y)
-{
-    int z;
-
-    z = (int)x * (int)y;
-    return (unsigned char)((z + (z >> 8) + 0x80) >> 8);
-}
-
 //------------------------------------------------------------------------
 // SplashClip
 //------------------------------------------------------------------------
@@ -80,6 +70,7 @@ SplashClip::SplashClip(SplashClip *clip)
         eo[i] = clip->eo[i];
         scanners[i] = new SplashXPathScanner(paths[i], eo[i], yMinI, yMaxI);
     }
+    mask = clip->mask;
     if ((w = splashCeil(xMax)) <= 0) {
         w = 1;
     }
@@ -133,6 +124,7 @@ void SplashClip::resetToRect(SplashCoord x0, SplashCoord y0, SplashCoord x1,
     eo = NULL;
     scanners = NULL;
     length = size = 0;
+    mask.reset();
 
     if (x0 < x1) {
         xMin = x0;
@@ -264,10 +256,26 @@ SplashError SplashClip::clipToPath(SplashPath *path, SplashCoord *matrix,
     scanners[length] = new SplashXPathScanner(xPath, eoA, splashFloor(yMin),
                                               splashCeil(yMax) - 1);
     ++length;
+    mask.reset();
 
     return splashOk;
 }
 
+void SplashClip::limitToRows(int yMinA, int yMaxA)
+{
+    if (yMinA > hardYMin) {
+        hardYMin = yMinA;
+    }
+    if (yMaxA < hardYMax) {
+        hardYMax = yMaxA;
+    }
+    intBoundsValid = false;
+
+    // the mask covers the hard limits -- build a smaller one when it is
+    // needed
+    mask.reset();
+}
+
 SplashClipResult SplashClip::testRect(int rectXMin, int rectYMin, int rectXMax,
                                       int rectYMax, bool strokeAdjust)
 {
@@ -302,13 +310,15 @@ SplashClipResult SplashClip::testRect(int rectXMin, int rectYMin, int rectXMax,
         if ((SplashCoord)(rectXMax + 1) <= xMin ||
             (SplashCoord)rectXMin >= xMax ||
             (SplashCoord)(rectYMax + 1) <= yMin ||
-            (SplashCoord)rectYMin >= yMax) {
+            (SplashCoord)rectYMin >= yMax || rectYMax < hardYMin ||
+            rectYMin >= hardYMax) {
             return splashClipAllOutside;
         }
         if (length == 0 && (SplashCoord)rectXMin >= xMin &&
             (SplashCoord)(rectXMax + 1) <= xMax &&
             (SplashCoord)rectYMin >= yMin &&
-            (SplashCoord)(rectYMax + 1) <= yMax) {
+            (SplashCoord)(rectYMax + 1) <= yMax && rectYMin >= hardYMin &&
+            rectYMax < hardYMax) {
             return splashClipAllInside;
         }
     }
@@ -319,7 +329,7 @@ void SplashClip::clipSpan(unsigned char *line, int y, int x0, int x1,
                           bool strokeAdjust)
 {
     SplashCoord d;
-    int         x0a, x1a, x, i;
+    int         x0a, x1a, x;
 
     updateIntBounds(strokeAdjust);
 
@@ -349,7 +359,8 @@ void SplashClip::clipSpan(unsigned char *line, int y, int x0, int x1,
     }
 
     //--- clip to the floating point rectangle
-    //    (if stroke adjustment is disabled)
+    //    (if stroke adjustment is disabled -- the top and bottom edges
+    //    are skipped if they were cut off by limitToRows)
 
     if (!strokeAdjust) {
         // clip left edge (xMin)
@@ -365,7 +376,7 @@ void SplashClip::clipSpan(unsigned char *line, int y, int x0, int x1,
         }
 
         // clip top edge (yMin)
-        if (y == yMinI) {
+        if (y == yMinI && yMin >= hardYMin) {
             d = (SplashCoord)(yMinI + 1) - yMin;
             for (x = x0a; x <= x1a; ++x) {
                 line[x] = (unsigned char)(int)((SplashCoord)line[x] * d);
@@ -373,7 +384,7 @@ void SplashClip::clipSpan(unsigned char *line, int y, int x0, int x1,
         }
 
         // clip bottom edge (yMax)
-        if (y == yMaxI) {
+        if (y == yMaxI && yMax <= hardYMax) {
             d = yMax - (SplashCoord)yMaxI;
             for (x = x0a; x <= x1a; ++x) {
                 line[x] = (unsigned char)(int)((SplashCoord)line[x] * d);
@@ -387,12 +398,11 @@ void SplashClip::clipSpan(unsigned char *line, int y, int x0, int x1,
 
     //--- clip to the paths
 
-    for (i = 0; i < length; ++i) {
-        scanners[i]->getSpan(buf, y, x0a, x1a);
-        for (x = x0a; x <= x1a; ++x) {
-            line[x] = mul255(line[x], buf[x]);
-        }
+    if (!mask) {
+        mask = std::make_shared< SplashClipMask >(
+            paths, eo, length, hardXMin, hardYMin, hardXMax, hardYMax);
     }
+    mask->clipSpan(line, y, x0a, x1a);
 }
 
 bool SplashClip::clipSpanBinary(unsigned char *line, int y, int x0, int x1,
@@ -6,12 +6,15 @@
 
 #include <defs.hh>
 
+#include <memory>
+
 #include <splash/SplashTypes.hh>
 #include <splash/SplashMath.hh>
 
 class SplashPath;
 class SplashXPath;
 class SplashXPathScanner;
+class SplashClipMask;
 class SplashBitmap;
 
 //------------------------------------------------------------------------
@@ -49,6 +52,12 @@ public:
     SplashError clipToPath(SplashPath *path, SplashCoord *matrix,
                            SplashCoord flatness, bool eoA);
 
+    // Limit the clip to scan lines [yMinA, yMaxA).  Unlike clipToRect,
+    // this does not move the edges of the clip region, so the rows
+    // inside the limits are clipped exactly as before.  This is used to
+    // split a bitmap into bands (see SplashBands).
+    void limitToRows(int yMinA, int yMaxA);
+
     // Tests a rectangle against the clipping region.  Returns one of:
     //   - splashClipAllInside if the entire rectangle is inside the
     //     clipping region, i.e., all pixels in the rectangle are
@@ -74,8 +83,8 @@ public:
     // Get the rectangle part of the clip region.
     SplashCoord getXMin() { return xMin; }
     SplashCoord getXMax() { return xMax; }
-    SplashCoord getYMin() { return yMin; }
-    SplashCoord getYMax() { return yMax; }
+    SplashCoord getYMin() { return yMin > hardYMin ? yMin : hardYMin; }
+    SplashCoord getYMax() { return yMax < hardYMax ? yMax : hardYMax; }
 
     // Get the rectangle part of the clip region, in integer coordinates.
     int getXMinI(bool strokeAdjust);
@@ -108,6 +117,10 @@ private:
     SplashXPathScanner **scanners;
     int                  length, size;
     unsigned char *      buf;
+
+    // Rasterized intersection of the paths, built when first needed.
+    // Copies of the clip share it until a path is added.
+    std::shared_ptr< SplashClipMask > mask;
 };
 
 #endif // XPDF_SPLASH_SPLASHCLIP_HH
@@ -0,0 +1,195 @@
+// -*- mode: c++; -*-
+// Copyright 2003-2013 Glyph & Cog, LLC
+
+#include <defs.hh>
+
+#include <cstring>
+
+#include <splash/SplashXPath.hh>
+#include <splash/SplashXPathScanner.hh>
+#include <splash/SplashClipMask.hh>
+
+//------------------------------------------------------------------------
+
+#define splashClipMaskTileSize 32
+
+// Compute x * y / 255, where x and y are in [0, 255].
+static inline unsigned char mul255(unsigned char x, unsigned char y)
+{
+    int z;
+
+    z = (int)x * (int)y;
+    return (unsigned char)((z + (z >> 8) + 0x80) >> 8);
+}
+
+//------------------------------------------------------------------------
+// SplashClipMask
+//------------------------------------------------------------------------
+
+SplashClipMask::SplashClipMask(SplashXPath **pathsA, unsigned char *eoA,
+                               int nPaths, int hardXMin, int hardYMin,
+                               int hardXMax, int hardYMax)
+{
+    int i;
+
+    xMin = hardXMin;
+    yMin = hardYMin;
+    xMax = hardXMax - 1;
+    yMax = hardYMax - 1;
+
+    for (i = 0; i < nPaths; ++i) {
+        if (pathsA[i]->getXMin() > xMin) {
+            xMin = pathsA[i]->getXMin();
+        }
+        if (pathsA[i]->getYMin() > yMin) {
+            yMin = pathsA[i]->getYMin();
+        }
+        if (pathsA[i]->getXMax() < xMax) {
+            xMax = pathsA[i]->getXMax();
+        }
+        if (pathsA[i]->getYMax() < yMax) {
+            yMax = pathsA[i]->getYMax();
+        }
+    }
+
+    if (xMin > xMax || yMin > yMax) {
+        nTileCols = nBands = 0;
+        return;
+    }
+
+    for (i = 0; i < nPaths; ++i) {
+        paths.push_back(pathsA[i]->copy());
+        scanners.push_back(
+            new SplashXPathScanner(paths[i], eoA[i], yMin, yMax));
+    }
+
+    nTileCols = (xMax - xMin) / splashClipMaskTileSize + 1;
+    nBands = (yMax - yMin) / splashClipMaskTileSize + 1;
+
+    bandDone.resize(nBands, false);
+    tileKinds.resize(nTileCols * nBands, tileUnknown);
+    tiles.resize(nTileCols * nBands);
+}
+
+SplashClipMask::~SplashClipMask()
+{
+    for (auto p : scanners) {
+        delete p;
+    }
+    for (auto p : paths) {
+        delete p;
+    }
+}
+
+// Rasterize the intersection of the paths for all scan lines in one
+// band, then sort the tiles of the band into empty, full and partial
+// ones.
+void SplashClipMask::rasterizeBand(int band)
+{
+    unsigned char *row, *tile;
+    int            w, y0, y1, y, tx, x0, x1, x, i;
+    bool           empty, full;
+
+    w = xMax - xMin + 1;
+    y0 = yMin + band * splashClipMaskTileSize;
+    if ((y1 = y0 + splashClipMaskTileSize - 1) > yMax) {
+        y1 = yMax;
+    }
+
+    bandBuf.resize(splashClipMaskTileSize * w);
+    lineBuf.resize(xMax + 1);
+
+    for (y = y0; y <= y1; ++y) {
+        row = bandBuf.data() + (y - y0) * w;
+        scanners[0]->getSpan(lineBuf.data(), y, xMin, xMax);
+        memcpy(row, lineBuf.data() + xMin, w);
+        for (i = 1; i < (int)scanners.size(); ++i) {
+            scanners[i]->getSpan(lineBuf.data(), y, xMin, xMax);
+            for (x = 0; x < w; ++x) {
+                row[x] = mul255(row[x], lineBuf[xMin + x]);
+            }
+        }
+    }
+
+    for (tx = 0; tx < nTileCols; ++tx) {
+        x0 = tx * splashClipMaskTileSize;
+        if ((x1 = x0 + splashClipMaskTileSize - 1) >= w) {
+            x1 = w - 1;
+        }
+
+        empty = full = true;
+        for (y = y0; y <= y1 && (empty || full); ++y) {
+            row = bandBuf.data() + (y - y0) * w;
+            for (x = x0; x <= x1; ++x) {
+                empty = empty && !row[x];
+                full = full && row[x] == 0xff;
+            }
+        }
+
+        i = band * nTileCols + tx;
+        if (empty) {
+            tileKinds[i] = tileEmpty;
+        } else if (full) {
+            tileKinds[i] = tileFull;
+        } else {
+            tileKinds[i] = tilePartial;
+            tile = new unsigned char[splashClipMaskTileSize *
+                                     splashClipMaskTileSize];
+            for (y = y0; y <= y1; ++y) {
+                memcpy(tile + (y - y0) * splashClipMaskTileSize,
+                       bandBuf.data() + (y - y0) * w + x0, x1 - x0 + 1);
+            }
+            tiles[i].reset(tile);
+        }
+    }
+
+    bandDone[band] = true;
+}
+
+void SplashClipMask::clipSpan(unsigned char *line, int y, int x0, int x1)
+{
+    unsigned char *p;
+    int            band, tx, tx0, xa, xb, x;
+
+    if (!nBands || y < yMin || y > yMax || x1 < xMin || x0 > xMax) {
+        memset(line + x0, 0, x1 - x0 + 1);
+        return;
+    }
+
+    if (x0 < xMin) {
+        memset(line + x0, 0, xMin - x0);
+        x0 = xMin;
+    }
+    if (x1 > xMax) {
+        memset(line + xMax + 1, 0, x1 - xMax);
+        x1 = xMax;
+    }
+
+    band = (y - yMin) / splashClipMaskTileSize;
+    if (!bandDone[band]) {
+        rasterizeBand(band);
+    }
+
+    for (xa = x0; xa <= x1; xa = xb + 1) {
+        tx = (xa - xMin) / splashClipMaskTileSize;
+        tx0 = xMin + tx * splashClipMaskTileSize;
+        if ((xb = tx0 + splashClipMaskTileSize - 1) > x1) {
+            xb = x1;
+        }
+
+        switch (tileKinds[band * nTileCols + tx]) {
+        case tileEmpty:
+            memset(line + xa, 0, xb - xa + 1);
+            break;
+        case tilePartial:
+            p = tiles[band * nTileCols + tx].get() +
+                ((y - yMin) % splashClipMaskTileSize) * splashClipMaskTileSize;
+            for (x = xa; x <= xb; ++x) {
+                line[x] = mul255(line[x], p[x - tx0]);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
@@ -0,0 +1,59 @@
+// -*- mode: c++; -*-
+// Copyright 2003-2013 Glyph & Cog, LLC
+
+#ifndef XPDF_SPLASH_SPLASHCLIPMASK_HH
+#define XPDF_SPLASH_SPLASHCLIPMASK_HH
+
+#include <defs.hh>
+
+#include <memory>
+#include <vector>
+
+#include <splash/SplashTypes.hh>
+
+class SplashXPath;
+class SplashXPathScanner;
+
+//------------------------------------------------------------------------
+// SplashClipMask
+//------------------------------------------------------------------------
+
+// Coverage of the intersection of a set of clip paths, as a sparse
+// grid of 8-bit tiles.  Tiles are rasterized one band (row of tiles) at
+// a time, the first time a scan line in the band is clipped.  Tiles
+// that are entirely outside or entirely inside the paths are not
+// stored.
+class SplashClipMask
+{
+public:
+    // Create a mask for the intersection of <nPaths> paths, limited to
+    // [hardXMin, hardXMax) x [hardYMin, hardYMax).  The paths are
+    // copied.
+    SplashClipMask(SplashXPath **pathsA, unsigned char *eoA, int nPaths,
+                   int hardXMin, int hardYMin, int hardXMax, int hardYMax);
+
+    ~SplashClipMask();
+
+    // Multiply line[] with the mask values for one scan line: ([x0, x1],
+    // y).
+    void clipSpan(unsigned char *line, int y, int x0, int x1);
+
+private:
+    enum TileKind { tileUnknown, tileEmpty, tileFull, tilePartial };
+
+    void rasterizeBand(int band);
+
+    int xMin, yMin, xMax, yMax; // mask extent (inclusive); pixels
+                                //   outside of it are clipped
+    int nTileCols, nBands;
+
+    std::vector< unsigned char > bandDone; // true once a band is rasterized
+    std::vector< unsigned char > tileKinds; // [TileKind] for each tile
+    std::vector< std::unique_ptr< unsigned char[] > > tiles; // partial tiles
+
+    std::vector< SplashXPath * >        paths;
+    std::vector< SplashXPathScanner * > scanners;
+    std::vector< unsigned char >        bandBuf, lineBuf;
+};
+
+#endif // XPDF_SPLASH_SPLASHCLIPMASK_HH
@@ -6,11 +6,8 @@
 
 #include <defs.hh>
 
-#if USE_FIXEDPONT
-#include <utils/FixedPoint.hh>
-#else
 #include <cmath>
-#endif
+
 #include <splash/SplashTypes.hh>
 
 static inline SplashCoord splashAbs(SplashCoord x)
@@ -114,6 +114,7 @@ private:
     int             hintsLength, hintsSize;
 
     friend class SplashXPath;
+    friend class SplashThinStroke;
     friend class Splash;
 };
 
@@ -0,0 +1,118 @@
+// -*- mode: c++; -*-
+// Copyright 2003-2013 Glyph & Cog, LLC
+
+#ifndef XPDF_SPLASH_SPLASHSIMD_HH
+#define XPDF_SPLASH_SPLASHSIMD_HH
+
+#include <defs.hh>
+
+#include <cstring>
+
+//------------------------------------------------------------------------
+// Span kernels
+//------------------------------------------------------------------------
+
+// Span kernels are compiled once per instruction set (AVX2, SSE4.1 and
+// the baseline), and the best version for the CPU is picked when the
+// program is loaded.
+#if __GNUC__ && (__x86_64__ || __i386__) && __linux__
+#define SPLASH_SPAN_KERNEL \
+    __attribute__((target_clones("avx2", "sse4.1", "default")))
+#else
+#define SPLASH_SPAN_KERNEL
+#endif
+
+// Number of pixels handled by one step of a span kernel.  Buffers
+// passed to the kernels are padded to a multiple of this.
+#define splashVecSize 8
+
+#define SPLASH_VEC_INLINE static inline __attribute__((always_inline))
+
+// Eight 8-bit values, widened to 32 bits.  Intermediate results of the
+// pipe stay below 2^24, so they are computed in 32-bit lanes, and are
+// exact in single precision.
+typedef int           SplashVecI32 __attribute__((vector_size(32)));
+typedef float         SplashVecF32 __attribute__((vector_size(32)));
+typedef unsigned char SplashVecU8 __attribute__((vector_size(8)));
+typedef unsigned char SplashVecU8x32 __attribute__((vector_size(32)));
+
+// The load is written lane by lane, which compilers turn into a single
+// widening load.  The store picks the low byte of each lane.
+SPLASH_VEC_INLINE SplashVecI32 splashVecLoad(const unsigned char *p)
+{
+    return SplashVecI32{ p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7] };
+}
+
+SPLASH_VEC_INLINE void splashVecStore(unsigned char *p, SplashVecI32 v)
+{
+    SplashVecU8 u;
+
+    u = __builtin_shufflevector((SplashVecU8x32)v, (SplashVecU8x32)v, 0, 4, 8,
+                                12, 16, 20, 24, 28);
+    memcpy(p, &u, sizeof(u));
+}
+
+SPLASH_VEC_INLINE SplashVecI32 splashVecSplat(int x)
+{
+    return SplashVecI32{ x, x, x, x, x, x, x, x };
+}
+
+// Divide by 255, rounding, like div255() -- x must be in [0, 255*255].
+SPLASH_VEC_INLINE SplashVecI32 splashVecDiv255(SplashVecI32 x)
+{
+    return (x + (x >> 8) + 0x80) >> 8;
+}
+
+// Divide non-negative <n> by positive <d>, truncating.  The single
+// precision quotient is off by at most one, and is then corrected.
+SPLASH_VEC_INLINE SplashVecI32 splashVecDivPos(SplashVecI32 n, SplashVecI32 d)
+{
+    SplashVecI32 q;
+
+    q = __builtin_convertvector(__builtin_convertvector(n, SplashVecF32) /
+                                    __builtin_convertvector(d, SplashVecF32),
+                                SplashVecI32);
+    q += q * d > n;       // comparisons yield -1 for true
+    q -= (q + 1) * d <= n;
+
+    return q;
+}
+
+// Divide, truncating toward zero, like the / operator.  Lanes where
+// <d> is zero produce zero.
+SPLASH_VEC_INLINE SplashVecI32 splashVecDiv(SplashVecI32 n, SplashVecI32 d)
+{
+    SplashVecI32 z;
+
+    z = d == 0;
+    d = z ? splashVecSplat(1) : d;
+    n = z ? splashVecSplat(0) : n;
+
+    return splashVecDivPos(n, d);
+}
+
+// Divide by 255, truncating toward zero, like the / operator -- |n|
+// must be below 2^24.  The estimate sums the first terms of
+// n/256 + n/256^2 + ..., and is off by at most one.
+SPLASH_VEC_INLINE SplashVecI32 splashVecDivT255(SplashVecI32 n)
+{
+    SplashVecI32 x, q;
+
+    x = n < 0 ? -n : n;
+    q = (x + (x >> 8) + (x >> 16)) >> 8;
+    q -= x - ((q << 8) - q) >= 255;
+
+    return n < 0 ? -q : q;
+}
+
+SPLASH_VEC_INLINE SplashVecI32 splashVecMin(SplashVecI32 x, SplashVecI32 y)
+{
+    return x < y ? x : y;
+}
+
+SPLASH_VEC_INLINE SplashVecI32 splashVecMax(SplashVecI32 x, SplashVecI32 y)
+{
+    return x > y ? x : y;
+}
+
+#endif // XPDF_SPLASH_SPLASHSIMD_HH
@@ -0,0 +1,209 @@
+// -*- mode: c++; -*-
+// Copyright 2003-2013 Glyph & Cog, LLC
+
+#include <defs.hh>
+
+#include <cstring>
+
+#include <splash/SplashScaleKernels.hh>
+
+//------------------------------------------------------------------------
+
+// Eight 32-bit sums.  The sums of a box are at most 255 * xStep * yStep,
+// and the fixed-point quotients below are computed as in the per-pixel
+// code, with unsigned 32-bit arithmetic.
+typedef unsigned SplashVecU32 __attribute__((vector_size(32)));
+
+SPLASH_VEC_INLINE SplashVecU32 splashVecLoadU32(const unsigned *p)
+{
+    SplashVecU32 v;
+
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+SPLASH_VEC_INLINE void splashVecStoreU32(unsigned *p, SplashVecU32 v)
+{
+    memcpy(p, &v, sizeof(v));
+}
+
+// Sum <n> pixels of <acc> -- with <nComps> components and <xStep>
+// source pixels per scaled pixel, both known at compile time -- into
+// <sum>.
+template< int nComps, int xStep >
+SPLASH_VEC_INLINE void splashScaleSumPixels(const unsigned *acc, unsigned *sum,
+                                            int n)
+{
+    int x, i, s;
+
+    for (x = 0; x < n; ++x) {
+        for (i = 0; i < nComps; ++i) {
+            sum[x * nComps + i] = 0;
+            for (s = 0; s < xStep; ++s) {
+                sum[x * nComps + i] += acc[(x * xStep + s) * nComps + i];
+            }
+        }
+    }
+}
+
+// Exact reduction by <xStep>: every scaled pixel is the average of the
+// same number of sums, so there is a single divisor.
+template< int nComps, int xStep >
+SPLASH_VEC_INLINE void splashScaleBoxRowExact(const unsigned *acc, unsigned d,
+                                              unsigned char *dest,
+                                              int scaledWidth)
+{
+    unsigned     sum[splashVecSize * nComps];
+    SplashVecU32 dd;
+    int          x, i, n;
+
+    dd = SplashVecU32{ d, d, d, d, d, d, d, d };
+    for (x = 0; x < scaledWidth; x += splashVecSize) {
+        n = scaledWidth - x < splashVecSize ? scaledWidth - x : splashVecSize;
+        splashScaleSumPixels< nComps, xStep >(acc + x * xStep * nComps, sum, n);
+        if (n == splashVecSize) {
+            for (i = 0; i < nComps; ++i) {
+                splashVecStore(dest + i * splashVecSize,
+                               (SplashVecI32)(
+                                   (splashVecLoadU32(sum + i * splashVecSize) *
+                                    dd) >>
+                                   23));
+            }
+        } else {
+            for (i = 0; i < n * nComps; ++i) {
+                dest[i] = (unsigned char)((sum[i] * d) >> 23);
+            }
+        }
+        dest += splashVecSize * nComps;
+    }
+}
+
+//------------------------------------------------------------------------
+// scaling kernels
+//------------------------------------------------------------------------
+
+SPLASH_SPAN_KERNEL
+void splashScaleAccumRow(unsigned *acc, const unsigned char *line, int n)
+{
+    int i;
+
+    for (i = 0; i + splashVecSize <= n; i += splashVecSize) {
+        splashVecStoreU32(acc + i, splashVecLoadU32(acc + i) +
+                                       (SplashVecU32)splashVecLoad(line + i));
+    }
+    for (; i < n; ++i) {
+        acc[i] += line[i];
+    }
+}
+
+SPLASH_SPAN_KERNEL
+void splashScaleBoxRow(const unsigned *acc, int nComps, int srcWidth,
+                       int scaledWidth, int yStep, int scale,
+                       unsigned char *dest)
+{
+    unsigned pix[4];
+    unsigned d, d0, d1;
+    int      xp, xq, xt, x, xStep, xx, i, j;
+
+    // Bresenham parameters for x scale
+    xp = srcWidth / scaledWidth;
+    xq = srcWidth % scaledWidth;
+
+    d0 = ((unsigned)scale << 23) / (yStep * xp);
+    d1 = ((unsigned)scale << 23) / (yStep * (xp + 1));
+
+    if (xq == 0) {
+        switch ((nComps << 4) | xp) {
+#define splashScaleExactCase(nc, xs)                                         \
+    case ((nc) << 4) | (xs):                                                  \
+        splashScaleBoxRowExact< nc, xs >(acc, d0, dest, scaledWidth);        \
+        return
+            splashScaleExactCase(1, 1);
+            splashScaleExactCase(1, 2);
+            splashScaleExactCase(1, 4);
+            splashScaleExactCase(1, 8);
+            splashScaleExactCase(3, 1);
+            splashScaleExactCase(3, 2);
+            splashScaleExactCase(3, 4);
+            splashScaleExactCase(3, 8);
+            splashScaleExactCase(4, 1);
+            splashScaleExactCase(4, 2);
+            splashScaleExactCase(4, 4);
+            splashScaleExactCase(4, 8);
+#undef splashScaleExactCase
+        default:
+            break;
+        }
+    }
+
+    // init x scale Bresenham
+    xt = 0;
+
+    xx = 0;
+    for (x = 0; x < scaledWidth; ++x) {
+        // x scale Bresenham
+        if ((xt += xq) >= scaledWidth) {
+            xt -= scaledWidth;
+            xStep = xp + 1;
+            d = d1;
+        } else {
+            xStep = xp;
+            d = d0;
+        }
+
+        // compute the final pixel
+        switch (nComps) {
+        case 1:
+            pix[0] = 0;
+            for (i = 0; i < xStep; ++i) {
+                pix[0] += acc[xx++];
+            }
+            *dest++ = (unsigned char)((pix[0] * d) >> 23);
+            break;
+        case 3:
+            pix[0] = pix[1] = pix[2] = 0;
+            for (i = 0; i < xStep; ++i) {
+                pix[0] += acc[xx];
+                pix[1] += acc[xx + 1];
+                pix[2] += acc[xx + 2];
+                xx += 3;
+            }
+            *dest++ = (unsigned char)((pix[0] * d) >> 23);
+            *dest++ = (unsigned char)((pix[1] * d) >> 23);
+            *dest++ = (unsigned char)((pix[2] * d) >> 23);
+            break;
+        default:
+            for (j = 0; j < nComps; ++j) {
+                pix[j] = 0;
+            }
+            for (i = 0; i < xStep; ++i) {
+                for (j = 0; j < nComps; ++j) {
+                    pix[j] += acc[xx++];
+                }
+            }
+            for (j = 0; j < nComps; ++j) {
+                *dest++ = (unsigned char)((pix[j] * d) >> 23);
+            }
+            break;
+        }
+    }
+}
+
+SPLASH_SPAN_KERNEL
+void splashScaleDivRow(const unsigned *acc, int yStep, int scale,
+                       unsigned char *dest, int n)
+{
+    SplashVecU32 dd;
+    unsigned     d;
+    int          i;
+
+    d = ((unsigned)scale << 23) / yStep;
+    dd = SplashVecU32{ d, d, d, d, d, d, d, d };
+    for (i = 0; i + splashVecSize <= n; i += splashVecSize) {
+        splashVecStore(dest + i,
+                       (SplashVecI32)((splashVecLoadU32(acc + i) * dd) >> 23));
+    }
+    for (; i < n; ++i) {
+        dest[i] = (unsigned char)((acc[i] * d) >> 23);
+    }
+}
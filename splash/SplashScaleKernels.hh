@@ -0,0 +1,39 @@
+// -*- mode: c++; -*-
+// Copyright 2003-2013 Glyph & Cog, LLC
+
+#ifndef XPDF_SPLASH_SPLASHSCALEKERNELS_HH
+#define XPDF_SPLASH_SPLASHSCALEKERNELS_HH
+
+#include <defs.hh>
+
+#include <splash/SplashSIMD.hh>
+
+//------------------------------------------------------------------------
+// Row kernels for the area-averaging image and mask downscalers
+//------------------------------------------------------------------------
+
+// The downscalers (Splash::scaleImageYd*, Splash::scaleMaskYd*) add up
+// the <yStep> source rows that map to one scaled row, and then average
+// the sums over the <xStep> source columns that map to each scaled
+// column, with the same Bresenham steps and fixed-point division as
+// the per-pixel code, so the results are identical.  The buffers don't
+// need to be padded.
+
+// Add a row of <n> samples to the sums in <acc>.
+void splashScaleAccumRow(unsigned *acc, const unsigned char *line, int n);
+
+// Average a row of sums -- <srcWidth> pixels with <nComps> components
+// each, every one the sum of <yStep> source rows -- down to
+// <scaledWidth> pixels, and store the results in <dest>.  <scale> is 1
+// for 8-bit samples, and 255 for (0 or 1) mask samples.  Exact 1x, 2x,
+// 4x, and 8x horizontal reductions take a faster path.
+void splashScaleBoxRow(const unsigned *acc, int nComps, int srcWidth,
+                       int scaledWidth, int yStep, int scale,
+                       unsigned char *dest);
+
+// Divide a row of <n> sums of <yStep> source rows (with <scale> as for
+// splashScaleBoxRow), and store the results in <dest>.
+void splashScaleDivRow(const unsigned *acc, int yStep, int scale,
+                       unsigned char *dest, int n);
+
+#endif // XPDF_SPLASH_SPLASHSCALEKERNELS_HH
@@ -0,0 +1,155 @@
+// -*- mode: c++; -*-
+// Copyright 2003-2013 Glyph & Cog, LLC
+
+#include <defs.hh>
+
+#include <splash/SplashSpanKernels.hh>
+
+//------------------------------------------------------------------------
+
+// Divide a 16-bit value (in [0, 255*255]) by 255, returning an 8-bit result.
+static inline unsigned char div255(int x)
+{
+    return (unsigned char)((x + (x >> 8) + 0x80) >> 8);
+}
+
+//------------------------------------------------------------------------
+// span kernels
+//------------------------------------------------------------------------
+
+SPLASH_SPAN_KERNEL
+void splashSpanSrcAlpha(unsigned char aInput, const unsigned char *softMask,
+                        const unsigned char *shape, unsigned char *aSrc, int n)
+{
+    SplashVecI32 a, aIn;
+    int          i;
+
+    aIn = splashVecSplat(aInput);
+    for (i = 0; i < n; i += splashVecSize) {
+        if (softMask) {
+            a = splashVecDiv255(aIn * splashVecLoad(softMask + i));
+        } else {
+            a = aIn;
+        }
+        splashVecStore(aSrc + i, splashVecDiv255(a * splashVecLoad(shape + i)));
+    }
+}
+
+SPLASH_SPAN_KERNEL
+void splashSpanAlpha(const unsigned char *aSrc, const unsigned char *aDest,
+                     const unsigned char *alpha0, unsigned char *aResult,
+                     unsigned char *alphaI, unsigned char *alphaIm1, int n)
+{
+    SplashVecI32 aS, aD, aR, a0;
+    int          i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        aS = splashVecLoad(aSrc + i);
+        aD = splashVecLoad(aDest + i);
+        aR = aS + aD - splashVecDiv255(aS * aD);
+        splashVecStore(aResult + i, aR);
+        if (alpha0) {
+            // non-isolated, non-knockout
+            a0 = splashVecLoad(alpha0 + i);
+            splashVecStore(alphaI + i, aR + a0 - splashVecDiv255(aR * a0));
+            splashVecStore(alphaIm1 + i, a0 + aD - splashVecDiv255(a0 * aD));
+        } else {
+            // isolated, non-knockout
+            splashVecStore(alphaI + i, aR);
+            splashVecStore(alphaIm1 + i, aD);
+        }
+    }
+}
+
+SPLASH_SPAN_KERNEL
+void splashSpanNonIsolated(unsigned char *cSrc, const unsigned char *cDest,
+                           const unsigned char *shape,
+                           const unsigned char *aDest, int n)
+{
+    SplashVecI32 cS, aD, t;
+    int          i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        cS = splashVecLoad(cSrc + i);
+        aD = splashVecLoad(aDest + i);
+        t = splashVecDiv(aD * 255, splashVecLoad(shape + i)) - aD;
+        cS = cS + splashVecDivT255((cS - splashVecLoad(cDest + i)) * t);
+        splashVecStore(cSrc + i, splashVecMin(splashVecMax(cS, splashVecSplat(0)),
+                                              splashVecSplat(255)));
+    }
+}
+
+SPLASH_SPAN_KERNEL
+void splashSpanResultColor(const unsigned char *cSrc, const unsigned char *cDest,
+                           const unsigned char *cBlend,
+                           const unsigned char *aSrc,
+                           const unsigned char *alphaI,
+                           const unsigned char *alphaIm1,
+                           unsigned char *cResult, int n)
+{
+    SplashVecI32 cS, aS, aI, aIm1, num;
+    int          i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        cS = splashVecLoad(cSrc + i);
+        aS = splashVecLoad(aSrc + i);
+        aI = alphaI ? splashVecLoad(alphaI + i) : splashVecSplat(255);
+        if (cBlend) {
+            aIm1 = splashVecLoad(alphaIm1 + i);
+            cS = splashVecDivT255(aS * ((255 - aIm1) * cS +
+                                        aIm1 * splashVecLoad(cBlend + i)));
+        } else {
+            cS = aS * cS;
+        }
+        num = (aI - aS) * splashVecLoad(cDest + i) + cS;
+        if (alphaI) {
+            splashVecStore(cResult + i, splashVecDiv(num, aI));
+        } else {
+            splashVecStore(cResult + i, splashVecDivT255(num));
+        }
+    }
+}
+
+SPLASH_SPAN_KERNEL
+void splashSpanBlendOpaque(const unsigned char *cSrc,
+                           const unsigned char *cBlend,
+                           const unsigned char *aDest, unsigned char *cResult,
+                           int n)
+{
+    SplashVecI32 aD;
+    int          i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        aD = splashVecLoad(aDest + i);
+        splashVecStore(cResult + i,
+                       splashVecDiv255((255 - aD) * splashVecLoad(cSrc + i) +
+                                       aD * splashVecLoad(cBlend + i)));
+    }
+}
+
+SPLASH_SPAN_KERNEL
+void splashSpanCompositeBackground(unsigned char *data,
+                                   const unsigned char *alpha,
+                                   unsigned char color, int nComps, int n)
+{
+    unsigned char buf[splashVecSize];
+    SplashVecI32  a, col;
+    int           i, j;
+
+    col = splashVecSplat(color);
+    for (i = 0; i + splashVecSize <= n; i += splashVecSize) {
+        for (j = 0; j < splashVecSize; ++j) {
+            buf[j] = data[(i + j) * nComps];
+        }
+        a = splashVecLoad(alpha + i);
+        splashVecStore(buf, splashVecDiv255((255 - a) * col +
+                                            a * splashVecLoad(buf)));
+        for (j = 0; j < splashVecSize; ++j) {
+            data[(i + j) * nComps] = buf[j];
+        }
+    }
+    for (; i < n; ++i) {
+        data[i * nComps] =
+            div255((255 - alpha[i]) * color + alpha[i] * data[i * nComps]);
+    }
+}
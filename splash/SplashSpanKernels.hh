@@ -0,0 +1,62 @@
+// -*- mode: c++; -*-
+// Copyright 2003-2013 Glyph & Cog, LLC
+
+#ifndef XPDF_SPLASH_SPLASHSPANKERNELS_HH
+#define XPDF_SPLASH_SPLASHSPANKERNELS_HH
+
+#include <defs.hh>
+
+#include <splash/SplashSIMD.hh>
+
+//------------------------------------------------------------------------
+// Span kernels for the general (transparent) pipe
+//------------------------------------------------------------------------
+
+// Each kernel computes one stage of Splash::pipeRun for <n> pixels, on
+// planar buffers (one buffer per color component).  The results are
+// the same as those of the per-pixel code.  The buffers must be padded
+// to a multiple of splashVecSize: padding lanes are computed too.
+
+// Source alpha: aSrc = aInput * softMask * shape.  <softMask> may be
+// NULL.
+void splashSpanSrcAlpha(unsigned char aInput, const unsigned char *softMask,
+                        const unsigned char *shape, unsigned char *aSrc, int n);
+
+// Result alpha, along with alpha_i and alpha_(i-1) of the compositing
+// formula.  <alpha0> is the backdrop alpha of a non-isolated group, or
+// NULL in an isolated group.
+void splashSpanAlpha(const unsigned char *aSrc, const unsigned char *aDest,
+                     const unsigned char *alpha0, unsigned char *aResult,
+                     unsigned char *alphaI, unsigned char *alphaIm1, int n);
+
+// Non-isolated group correction of one source color component, used
+// when compositing a non-isolated group (whose alpha is <shape>) onto
+// its backdrop.
+void splashSpanNonIsolated(unsigned char *cSrc, const unsigned char *cDest,
+                           const unsigned char *shape,
+                           const unsigned char *aDest, int n);
+
+// Result color, for one color component.  <cBlend> is the output of
+// the blend function, or NULL if there is none.  <alphaI> may be NULL
+// if it is 255 for all pixels (i.e., the destination is opaque).
+void splashSpanResultColor(const unsigned char *cSrc, const unsigned char *cDest,
+                           const unsigned char *cBlend,
+                           const unsigned char *aSrc,
+                           const unsigned char *alphaI,
+                           const unsigned char *alphaIm1,
+                           unsigned char *cResult, int n);
+
+// Result color, for one color component, of an opaque source with a
+// blend function.
+void splashSpanBlendOpaque(const unsigned char *cSrc,
+                           const unsigned char *cBlend,
+                           const unsigned char *aDest, unsigned char *cResult,
+                           int n);
+
+// Composite <n> pixels of one color component (<nComps> apart in
+// <data>) over a background color component.
+void splashSpanCompositeBackground(unsigned char *data,
+                                   const unsigned char *alpha,
+                                   unsigned char color, int nComps, int n);
+
+#endif // XPDF_SPLASH_SPLASHSPANKERNELS_HH
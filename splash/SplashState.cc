@@ -19,13 +19,21 @@
 //------------------------------------------------------------------------
 
 // number of components in each color mode
-int splashColorModeNComps[] = { 1, 1, 3, 3
+int splashColorModeNComps[] = { 1, 1, 3, 3, 3
 #if SPLASH_CMYK
                                 ,
                                 4
 #endif
 };
 
+// number of bytes per pixel in each color mode
+int splashColorModePixelSize[] = { 1, 1, 3, 3, 4
+#if SPLASH_CMYK
+                                   ,
+                                   4
+#endif
+};
+
 SplashState::SplashState(int width, int height, bool vectorAntialias,
                          SplashScreenParams *screenParams)
 {
@@ -43,6 +51,7 @@ SplashState::SplashState(int width, int height, bool vectorAntialias,
     fillPattern = new SplashSolidColor(color);
     screen = new SplashScreen(screenParams);
     blendFunc = NULL;
+    blendSpanFunc = NULL;
     strokeAlpha = 1;
     fillAlpha = 1;
     lineWidth = 1;
@@ -91,6 +100,7 @@ SplashState::SplashState(int width, int height, bool vectorAntialias,
     fillPattern = new SplashSolidColor(color);
     screen = screenA->copy();
     blendFunc = NULL;
+    blendSpanFunc = NULL;
     strokeAlpha = 1;
     fillAlpha = 1;
     lineWidth = 1;
@@ -129,6 +139,7 @@ SplashState::SplashState(SplashState *state)
     fillPattern = state->fillPattern->copy();
     screen = state->screen->copy();
     blendFunc = state->blendFunc;
+    blendSpanFunc = state->blendSpanFunc;
     strokeAlpha = state->strokeAlpha;
     fillAlpha = state->fillAlpha;
     lineWidth = state->lineWidth;
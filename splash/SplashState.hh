@@ -82,6 +82,7 @@ private:
     SplashPattern * fillPattern;
     SplashScreen *  screen;
     SplashBlendFunc blendFunc;
+    SplashBlendSpanFunc blendSpanFunc; // NULL for non-separable blend modes
     SplashCoord     strokeAlpha;
     SplashCoord     fillAlpha;
     SplashCoord     lineWidth;
@@ -108,6 +109,8 @@ private:
     SplashState *next; // used by Splash class
 
     friend class Splash;
+    friend class SplashBands;
+    friend class SplashThinStroke;
 };
 
 #endif // XPDF_SPLASH_SPLASHSTATE_HH
@@ -0,0 +1,685 @@
+// -*- mode: c++; -*-
+// Copyright 2003-2013 Glyph & Cog, LLC
+
+#include <defs.hh>
+
+#include <climits>
+#include <cstring>
+
+#include <splash/SplashMath.hh>
+#include <splash/SplashPath.hh>
+#include <splash/SplashState.hh>
+#include <splash/SplashThinStroke.hh>
+
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/action/remove_if.hpp>
+using namespace ranges;
+
+//------------------------------------------------------------------------
+
+// A round cap (or dot) is drawn as a square of the same area.
+#define splashThinRoundCap 0.7853981634 // pi / 4
+#define splashThinRoundDot 0.8862269255 // sqrt(pi) / 2
+
+// The kinds of segment ends passed to addSegment.
+#define splashThinEndCap 0 // end of an open subpath
+#define splashThinEndJoin 1 // join, turning by 90 degrees or more
+#define splashThinEndSmoothJoin 2 // join, turning by less than 90 degrees
+
+// Transform a point from user space to device space.
+static inline void splashThinTransform(SplashCoord *matrix, SplashCoord xi,
+                                       SplashCoord yi, SplashCoord *xo,
+                                       SplashCoord *yo)
+{
+    //                          [ m[0] m[1] 0 ]
+    // [xo yo 1] = [xi yi 1] *  [ m[2] m[3] 0 ]
+    //                          [ m[4] m[5] 1 ]
+    *xo = xi * matrix[0] + yi * matrix[2] + matrix[4];
+    *yo = xi * matrix[1] + yi * matrix[3] + matrix[5];
+}
+
+// The mean of clamp(u, 0, 1), as u goes linearly from <u0> to <u1>:
+// this is the part of a pixel, in a band one pixel wide, that is on the
+// inside of an edge crossing the band.
+static inline SplashCoord splashThinEdgeCover(SplashCoord u0, SplashCoord u1)
+{
+    SplashCoord t;
+
+    if (u0 > u1) {
+        t = u0;
+        u0 = u1;
+        u1 = t;
+    }
+    if (u1 <= 0) {
+        return 0;
+    }
+    if (u0 >= 1) {
+        return 1;
+    }
+    if (u1 - u0 < (SplashCoord)0.01) {
+        t = (SplashCoord)0.5 * (u0 + u1);
+        if (t < 0) {
+            t = 0;
+        } else if (t > 1) {
+            t = 1;
+        }
+        return t;
+    }
+    // the integral of clamp(u, 0, 1) is 0, u^2 / 2, and u - 1/2, below,
+    // inside, and above [0, 1]
+    t = u1 >= 1 ? u1 - (SplashCoord)0.5 : (SplashCoord)0.5 * u1 * u1;
+    if (u0 > 0) {
+        t -= (SplashCoord)0.5 * u0 * u0;
+    }
+    return t / (u1 - u0);
+}
+
+// Store coverage <a>, in [0, 1], at line[x], unless the pixel is
+// already covered more by another segment of the stroke.
+static inline void splashThinAddCoverage(unsigned char *line, int x,
+                                         SplashCoord a)
+{
+    int t;
+
+    if (a > 0) {
+        t = splashRound(a * 255);
+        if (t > 255) {
+            t = 255;
+        }
+        if (t > line[x]) {
+            line[x] = (unsigned char)t;
+        }
+    }
+}
+
+//------------------------------------------------------------------------
+// SplashThinStroke
+//------------------------------------------------------------------------
+
+SplashThinStroke::SplashThinStroke(SplashPath *path, SplashState *state,
+                                   SplashCoord lineWidthA)
+{
+    SplashPathPoint pt;
+    SplashCoord     lineDashTotal, lineDashStartPhase, lineDashDist, segLen;
+    SplashCoord     x0, y0, x1, y1, xa, ya;
+    bool            lineDashStartOn, lineDashOn;
+    int             lineDashStartIdx, lineDashIdx;
+    int             i, j, k;
+
+    matrix = state->matrix;
+    lineWidth = lineWidthA;
+    lineCap = state->lineCap;
+    lineJoin = state->lineJoin;
+    miterLimit = state->miterLimit;
+    strokeAdjust = state->strokeAdjust;
+    det = splashAbs(matrix[0] * matrix[3] - matrix[1] * matrix[2]);
+
+    switch (lineCap) {
+    case splashLineCapRound:
+        capExt = (SplashCoord)splashThinRoundCap * (SplashCoord)0.5 * lineWidth;
+        break;
+    case splashLineCapProjecting:
+        capExt = (SplashCoord)0.5 * lineWidth;
+        break;
+    default:
+        capExt = 0;
+        break;
+    }
+
+    nextSeg = 0;
+    xMin = yMin = INT_MAX;
+    xMax = yMax = INT_MIN;
+
+    // set up the dash pattern, as in Splash::makeDashedPath
+    lineDashStartOn = true;
+    lineDashStartIdx = 0;
+    lineDashStartPhase = 0;
+    if (state->lineDashLength > 0) {
+        lineDashTotal = 0;
+        for (i = 0; i < state->lineDashLength; ++i) {
+            lineDashTotal += state->lineDash[i];
+        }
+        // Acrobat simply draws nothing if the dash array is [0]
+        if (lineDashTotal == 0) {
+            return;
+        }
+        lineDashStartPhase = state->lineDashPhase;
+        i = splashFloor(lineDashStartPhase / lineDashTotal);
+        lineDashStartPhase -= (SplashCoord)i * lineDashTotal;
+        if (lineDashStartPhase > 0) {
+            while (lineDashStartPhase >= state->lineDash[lineDashStartIdx]) {
+                lineDashStartOn = !lineDashStartOn;
+                lineDashStartPhase -= state->lineDash[lineDashStartIdx];
+                ++lineDashStartIdx;
+            }
+        }
+    }
+
+    // process each subpath
+    i = 0;
+    while (i < path->length) {
+        // find the end of the subpath
+        for (j = i; j < path->length - 1 && !(path->flags[j] & splashPathLast);
+             ++j)
+            ;
+
+        pts.clear();
+
+        if (state->lineDashLength == 0) {
+            for (k = i; k <= j; ++k) {
+                pts.push_back(path->pts[k]);
+            }
+            addSubpath(path->flags[i] & splashPathClosed);
+            i = j + 1;
+            continue;
+        }
+
+        // each dash is drawn as an open subpath
+        lineDashOn = lineDashStartOn;
+        lineDashIdx = lineDashStartIdx;
+        lineDashDist = state->lineDash[lineDashIdx] - lineDashStartPhase;
+
+        for (k = i; k < j; ++k) {
+            x0 = path->pts[k].x;
+            y0 = path->pts[k].y;
+            x1 = path->pts[k + 1].x;
+            y1 = path->pts[k + 1].y;
+            segLen = splashDist(x0, y0, x1, y1);
+
+            while (segLen > 0) {
+                if (lineDashDist >= segLen) {
+                    xa = x1;
+                    ya = y1;
+                    lineDashDist -= segLen;
+                    segLen = 0;
+                } else {
+                    xa = x0 + (lineDashDist / segLen) * (x1 - x0);
+                    ya = y0 + (lineDashDist / segLen) * (y1 - y0);
+                    segLen -= lineDashDist;
+                    lineDashDist = 0;
+                }
+                if (lineDashOn) {
+                    if (pts.empty()) {
+                        pt.x = x0;
+                        pt.y = y0;
+                        pts.push_back(pt);
+                    }
+                    pt.x = xa;
+                    pt.y = ya;
+                    pts.push_back(pt);
+                }
+                x0 = xa;
+                y0 = ya;
+
+                // get the next entry in the dash array
+                if (lineDashDist <= 0) {
+                    if (lineDashOn) {
+                        addSubpath(false);
+                        pts.clear();
+                    }
+                    lineDashOn = !lineDashOn;
+                    if (++lineDashIdx == state->lineDashLength) {
+                        lineDashIdx = 0;
+                    }
+                    lineDashDist = state->lineDash[lineDashIdx];
+                }
+            }
+        }
+        if (!pts.empty()) {
+            addSubpath(false);
+        }
+
+        i = j + 1;
+    }
+
+    sort(segs, [](const SplashThinSeg &lhs, const SplashThinSeg &rhs) {
+        return lhs.yMin < rhs.yMin;
+    });
+
+    for (auto &seg : segs) {
+        if (seg.xMin < xMin) {
+            xMin = seg.xMin;
+        }
+        if (seg.xMax > xMax) {
+            xMax = seg.xMax;
+        }
+        if (seg.yMin < yMin) {
+            yMin = seg.yMin;
+        }
+        if (seg.yMax > yMax) {
+            yMax = seg.yMax;
+        }
+    }
+}
+
+// Add the segments of the polyline in pts.  The ends of an open
+// subpath get caps, and the segments overlap at the joins.
+void SplashThinStroke::addSubpath(bool closed)
+{
+    SplashCoord ext0, ext1;
+    int         end0, end1;
+    size_t      n, i;
+
+    // drop repeated points
+    n = 1;
+    for (i = 1; i < pts.size(); ++i) {
+        if (pts[i].x != pts[n - 1].x || pts[i].y != pts[n - 1].y) {
+            pts[n++] = pts[i];
+        }
+    }
+
+    // zero-length subpath with round line caps --> draw a dot
+    if (n == 1) {
+        if (lineCap == splashLineCapRound) {
+            addDot(&pts[0]);
+        }
+        return;
+    }
+
+    closed = closed && n > 2 && pts[0].x == pts[n - 1].x &&
+             pts[0].y == pts[n - 1].y;
+
+    for (i = 0; i + 1 < n; ++i) {
+        if (i > 0) {
+            ext0 = getJoinExt(&pts[i - 1], &pts[i], &pts[i + 1], &end0);
+        } else if (closed) {
+            ext0 = getJoinExt(&pts[n - 2], &pts[0], &pts[1], &end0);
+        } else {
+            ext0 = capExt;
+            end0 = splashThinEndCap;
+        }
+        if (i + 2 < n) {
+            ext1 = getJoinExt(&pts[i], &pts[i + 1], &pts[i + 2], &end1);
+        } else if (closed) {
+            ext1 = getJoinExt(&pts[n - 2], &pts[0], &pts[1], &end1);
+        } else {
+            ext1 = capExt;
+            end1 = splashThinEndCap;
+        }
+        addSegment(&pts[i], &pts[i + 1], ext0, ext1, end0, end1);
+    }
+}
+
+// Returns the length (in user space) by which the two segments meeting
+// at <p1> are extended to draw the join: to the tip of a miter join
+// (computed as in Splash::makeStrokePath), half the line width for a
+// round join, and not at all for a bevel join.  Sets *<end> to the kind
+// of join.
+SplashCoord SplashThinStroke::getJoinExt(SplashPathPoint *p0,
+                                         SplashPathPoint *p1,
+                                         SplashPathPoint *p2, int *end)
+{
+    SplashCoord d0, d1, dotprod, miter;
+
+    d0 = splashDist(p0->x, p0->y, p1->x, p1->y);
+    d1 = splashDist(p1->x, p1->y, p2->x, p2->y);
+    dotprod = -((p1->x - p0->x) * (p2->x - p1->x) +
+                (p1->y - p0->y) * (p2->y - p1->y)) /
+              (d0 * d1);
+    *end = dotprod < 0 ? splashThinEndSmoothJoin : splashThinEndJoin;
+
+    switch (lineJoin) {
+    case splashLineJoinRound:
+        return (SplashCoord)0.5 * lineWidth;
+    case splashLineJoinMiter:
+        if (dotprod > 0.9999) {
+            return 0;
+        }
+        miter = (SplashCoord)2 / ((SplashCoord)1 - dotprod);
+        if (miter < 1 || splashSqrt(miter) > miterLimit) {
+            return 0;
+        }
+        return (SplashCoord)0.25 * lineWidth * splashSqrt(miter - 1);
+    default:
+        return 0;
+    }
+}
+
+// Add the segment from <p0> to <p1>, extended by <ext0> and <ext1>.
+// The ends at smooth joins (<end0>, <end1>) are also extended to the
+// pixel boundary, so that the pixel that contains the joint is covered
+// by one of the segments, not shared between them.
+void SplashThinStroke::addSegment(SplashPathPoint *p0, SplashPathPoint *p1,
+                                  SplashCoord ext0, SplashCoord ext1, int end0,
+                                  int end1)
+{
+    SplashThinSeg seg;
+    SplashCoord   vx0, vy0, vx1, vy1, x0, y0, x1, y1, dx, dy, len, scale, w, t;
+    SplashCoord   ux, uy, wdx, wdy;
+    int           xi0, xi1, yi0, yi1;
+
+    splashThinTransform(matrix, p0->x, p0->y, &vx0, &vy0);
+    splashThinTransform(matrix, p1->x, p1->y, &vx1, &vy1);
+    dx = vx1 - vx0;
+    dy = vy1 - vy0;
+    len = splashDist(vx0, vy0, vx1, vy1);
+    if (len == 0) {
+        return;
+    }
+
+    // the device space width of the segment is the user space width
+    // scaled by the determinant of the matrix, over the scaling along
+    // the segment
+    scale = len / splashDist(p0->x, p0->y, p1->x, p1->y);
+    w = lineWidth * det / scale;
+    if (w <= 0) {
+        return;
+    }
+
+    if (strokeAdjust && (dx == 0 || dy == 0)) {
+        // build the corners of the segment rectangle in user space, as
+        // makeStrokePath does, so the edges round to the same pixels
+        t = (SplashCoord)1 / splashDist(p0->x, p0->y, p1->x, p1->y);
+        ux = t * (p1->x - p0->x);
+        uy = t * (p1->y - p0->y);
+        wdx = (SplashCoord)0.5 * lineWidth * ux;
+        wdy = (SplashCoord)0.5 * lineWidth * uy;
+        splashThinTransform(matrix, p0->x - ext0 * ux - wdy,
+                            p0->y - ext0 * uy + wdx, &x0, &y0);
+        splashThinTransform(matrix, p1->x + ext1 * ux + wdy,
+                            p1->y + ext1 * uy - wdx, &x1, &y1);
+        if (x0 > x1) {
+            t = x0;
+            x0 = x1;
+            x1 = t;
+        }
+        if (y0 > y1) {
+            t = y0;
+            y0 = y1;
+            y1 = t;
+        }
+        splashStrokeAdjust(x0, x1, &xi0, &xi1);
+        splashStrokeAdjust(y0, y1, &yi0, &yi1);
+        seg.a0 = seg.a1 = seg.b0 = seg.slope = seg.h = 0;
+        seg.xMin = xi0;
+        seg.xMax = xi1 - 1;
+        seg.yMin = yi0;
+        seg.yMax = yi1 - 1;
+        seg.mode = splashThinSegRect;
+        segs.push_back(seg);
+        return;
+    }
+
+    // extend the segment by the caps or joins -- the ends of the strip
+    // are cut along the minor axis, so at smooth joins it is also
+    // extended to cover the end of the line squared off: otherwise the
+    // outer corner is lost where the next segment has the other major
+    // axis (at sharper joins, this would stick out of the join)
+    ext0 *= scale / len;
+    ext1 *= scale / len;
+    if (splashAbs(dx) >= splashAbs(dy)) {
+        t = (SplashCoord)0.5 * w * splashAbs(dy) / (splashAbs(dx) * len);
+    } else {
+        t = (SplashCoord)0.5 * w * splashAbs(dx) / (splashAbs(dy) * len);
+    }
+    if (end0 == splashThinEndSmoothJoin) {
+        ext0 += t;
+    }
+    if (end1 == splashThinEndSmoothJoin) {
+        ext1 += t;
+    }
+    x0 = vx0 - ext0 * dx;
+    y0 = vy0 - ext0 * dy;
+    x1 = vx1 + ext1 * dx;
+    y1 = vy1 + ext1 * dy;
+
+    if (splashAbs(dx) >= splashAbs(dy)) {
+        seg.slope = dy / dx;
+        if (end0 == splashThinEndSmoothJoin) {
+            t = dx > 0 ? (SplashCoord)splashFloor(vx0)
+                       : (SplashCoord)(splashFloor(vx0) + 1);
+            if (dx > 0 ? t < x0 : t > x0) {
+                x0 = t;
+                y0 = vy0 + (x0 - vx0) * seg.slope;
+            }
+        }
+        if (end1 == splashThinEndSmoothJoin) {
+            t = dx > 0 ? (SplashCoord)(splashFloor(vx1) + 1)
+                       : (SplashCoord)splashFloor(vx1);
+            if (dx > 0 ? t > x1 : t < x1) {
+                x1 = t;
+                y1 = vy1 + (x1 - vx1) * seg.slope;
+            }
+        }
+        if (x0 <= x1) {
+            seg.a0 = x0;
+            seg.a1 = x1;
+            seg.b0 = y0;
+        } else {
+            seg.a0 = x1;
+            seg.a1 = x0;
+            seg.b0 = y1;
+        }
+        seg.h = (SplashCoord)0.5 * w * len / splashAbs(dx);
+        t = seg.b0 + (seg.a1 - seg.a0) * seg.slope;
+        seg.yMin = splashFloor((seg.b0 < t ? seg.b0 : t) - seg.h);
+        seg.yMax = splashFloor((seg.b0 < t ? t : seg.b0) + seg.h);
+        seg.xMin = splashFloor(seg.a0);
+        seg.xMax = splashFloor(seg.a1);
+        seg.mode = splashThinSegXMajor;
+    } else {
+        seg.slope = dx / dy;
+        if (end0 == splashThinEndSmoothJoin) {
+            t = dy > 0 ? (SplashCoord)splashFloor(vy0)
+                       : (SplashCoord)(splashFloor(vy0) + 1);
+            if (dy > 0 ? t < y0 : t > y0) {
+                y0 = t;
+                x0 = vx0 + (y0 - vy0) * seg.slope;
+            }
+        }
+        if (end1 == splashThinEndSmoothJoin) {
+            t = dy > 0 ? (SplashCoord)(splashFloor(vy1) + 1)
+                       : (SplashCoord)splashFloor(vy1);
+            if (dy > 0 ? t > y1 : t < y1) {
+                y1 = t;
+                x1 = vx1 + (y1 - vy1) * seg.slope;
+            }
+        }
+        if (y0 <= y1) {
+            seg.a0 = y0;
+            seg.a1 = y1;
+            seg.b0 = x0;
+        } else {
+            seg.a0 = y1;
+            seg.a1 = y0;
+            seg.b0 = x1;
+        }
+        seg.h = (SplashCoord)0.5 * w * len / splashAbs(dy);
+        t = seg.b0 + (seg.a1 - seg.a0) * seg.slope;
+        seg.xMin = splashFloor((seg.b0 < t ? seg.b0 : t) - seg.h);
+        seg.xMax = splashFloor((seg.b0 < t ? t : seg.b0) + seg.h);
+        seg.yMin = splashFloor(seg.a0);
+        seg.yMax = splashFloor(seg.a1);
+        seg.mode = splashThinSegYMajor;
+    }
+
+    segs.push_back(seg);
+}
+
+void SplashThinStroke::addDot(SplashPathPoint *p)
+{
+    SplashThinSeg seg;
+    SplashCoord   x, y, r;
+
+    splashThinTransform(matrix, p->x, p->y, &x, &y);
+    r = (SplashCoord)0.5 * (SplashCoord)splashThinRoundDot * lineWidth *
+        splashSqrt(det);
+    if (r <= 0) {
+        return;
+    }
+
+    seg.a0 = x - r;
+    seg.a1 = x + r;
+    seg.b0 = y;
+    seg.slope = 0;
+    seg.h = r;
+    seg.xMin = splashFloor(seg.a0);
+    seg.xMax = splashFloor(seg.a1);
+    seg.yMin = splashFloor(y - r);
+    seg.yMax = splashFloor(y + r);
+    seg.mode = splashThinSegXMajor;
+
+    segs.push_back(seg);
+}
+
+bool SplashThinStroke::getSpan(unsigned char *line, int y, int x0, int x1,
+                               int *xa, int *xb)
+{
+    SplashThinSeg *seg;
+    int            sa, sb, lo, hi;
+    size_t         i;
+
+    // update the active segments
+    for (; nextSeg < segs.size() && segs[nextSeg].yMin <= y; ++nextSeg) {
+        if (segs[nextSeg].yMax >= y) {
+            activeSegs.push_back(&segs[nextSeg]);
+        }
+    }
+    actions::remove_if(activeSegs, [=](auto p) { return p->yMax < y; });
+
+    // find the span of each segment, and of the scan line
+    activeSpans.clear();
+    lo = INT_MAX;
+    hi = INT_MIN;
+    for (i = 0; i < activeSegs.size(); ++i) {
+        getSegSpan(activeSegs[i], y, &sa, &sb);
+        if (sa < x0) {
+            sa = x0;
+        }
+        if (sb > x1) {
+            sb = x1;
+        }
+        activeSpans.push_back(sa);
+        activeSpans.push_back(sb);
+        if (sa <= sb) {
+            if (sa < lo) {
+                lo = sa;
+            }
+            if (sb > hi) {
+                hi = sb;
+            }
+        }
+    }
+    if (lo > hi) {
+        return false;
+    }
+
+    memset(line + lo, 0, hi - lo + 1);
+    for (i = 0; i < activeSegs.size(); ++i) {
+        seg = activeSegs[i];
+        sa = activeSpans[2 * i];
+        sb = activeSpans[2 * i + 1];
+        if (sa <= sb) {
+            drawSeg(seg, line, y, sa, sb);
+        }
+    }
+
+    *xa = lo;
+    *xb = hi;
+    return true;
+}
+
+// Compute the columns [*xa, *xb] that <seg> may touch in scan line <y>.
+void SplashThinStroke::getSegSpan(SplashThinSeg *seg, int y, int *xa, int *xb)
+{
+    SplashCoord lo, hi, t0, t1, t;
+
+    switch (seg->mode) {
+    case splashThinSegRect:
+        *xa = seg->xMin;
+        *xb = seg->xMax;
+        break;
+
+    case splashThinSegYMajor:
+        // the center line, over the part of the row covered
+        lo = (SplashCoord)y > seg->a0 ? (SplashCoord)y : seg->a0;
+        hi = (SplashCoord)(y + 1) < seg->a1 ? (SplashCoord)(y + 1) : seg->a1;
+        if (hi <= lo) {
+            *xa = 1;
+            *xb = 0;
+            break;
+        }
+        t0 = seg->b0 + (lo - seg->a0) * seg->slope;
+        t1 = seg->b0 + (hi - seg->a0) * seg->slope;
+        if (t0 > t1) {
+            t = t0;
+            t0 = t1;
+            t1 = t;
+        }
+        *xa = splashFloor(t0 - seg->h);
+        *xb = splashFloor(t1 + seg->h);
+        break;
+
+    case splashThinSegXMajor:
+    default:
+        // the columns whose center line is less than h away from the row
+        if (seg->slope == 0) {
+            *xa = seg->xMin;
+            *xb = seg->xMax;
+            break;
+        }
+        t0 = ((SplashCoord)y - seg->h - seg->b0) / seg->slope;
+        t1 = ((SplashCoord)(y + 1) + seg->h - seg->b0) / seg->slope;
+        if (t0 > t1) {
+            t = t0;
+            t0 = t1;
+            t1 = t;
+        }
+        lo = t0 > 0 ? seg->a0 + t0 : seg->a0;
+        hi = t1 < seg->a1 - seg->a0 ? seg->a0 + t1 : seg->a1;
+        if (hi < lo) {
+            *xa = 1;
+            *xb = 0;
+            break;
+        }
+        *xa = splashFloor(lo);
+        *xb = splashFloor(hi);
+        break;
+    }
+}
+
+// Draw the part of <seg> in scan line <y>, columns [xa, xb].  The
+// coverage of a pixel is the area of the strip inside it: the strip
+// edges are linear across the pixel, so it is integrated exactly.
+void SplashThinStroke::drawSeg(SplashThinSeg *seg, unsigned char *line, int y,
+                               int xa, int xb)
+{
+    SplashCoord lo, hi, t0, t1, t, c;
+    int         x;
+
+    switch (seg->mode) {
+    case splashThinSegRect:
+        memset(line + xa, 0xff, xb - xa + 1);
+        break;
+
+    case splashThinSegYMajor:
+        lo = (SplashCoord)y > seg->a0 ? (SplashCoord)y : seg->a0;
+        hi = (SplashCoord)(y + 1) < seg->a1 ? (SplashCoord)(y + 1) : seg->a1;
+        t0 = seg->b0 + (lo - seg->a0) * seg->slope;
+        t1 = seg->b0 + (hi - seg->a0) * seg->slope;
+        for (x = xa; x <= xb; ++x) {
+            t = (SplashCoord)x;
+            c = splashThinEdgeCover(t0 + seg->h - t, t1 + seg->h - t) -
+                splashThinEdgeCover(t0 - seg->h - t, t1 - seg->h - t);
+            splashThinAddCoverage(line, x, c * (hi - lo));
+        }
+        break;
+
+    case splashThinSegXMajor:
+    default:
+        t = (SplashCoord)y;
+        for (x = xa; x <= xb; ++x) {
+            lo = (SplashCoord)x > seg->a0 ? (SplashCoord)x : seg->a0;
+            hi = (SplashCoord)(x + 1) < seg->a1 ? (SplashCoord)(x + 1) : seg->a1;
+            if (hi <= lo) {
+                continue;
+            }
+            t0 = seg->b0 + (lo - seg->a0) * seg->slope;
+            t1 = seg->b0 + (hi - seg->a0) * seg->slope;
+            c = splashThinEdgeCover(t0 + seg->h - t, t1 + seg->h - t) -
+                splashThinEdgeCover(t0 - seg->h - t, t1 - seg->h - t);
+            splashThinAddCoverage(line, x, c * (hi - lo));
+        }
+        break;
+    }
+}
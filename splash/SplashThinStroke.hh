@@ -0,0 +1,110 @@
+// -*- mode: c++; -*-
+// Copyright 2003-2013 Glyph & Cog, LLC
+
+#ifndef XPDF_SPLASH_SPLASHTHINSTROKE_HH
+#define XPDF_SPLASH_SPLASHTHINSTROKE_HH
+
+#include <defs.hh>
+
+#include <splash/SplashPath.hh>
+#include <splash/SplashTypes.hh>
+
+#include <vector>
+
+class SplashState;
+
+//------------------------------------------------------------------------
+
+// Strokes up to this width (in device pixels) are drawn by
+// SplashThinStroke, instead of being converted to a fill path.
+#define splashMaxThinStrokeWidth 2
+
+//------------------------------------------------------------------------
+// SplashThinSeg
+//------------------------------------------------------------------------
+
+struct SplashThinSeg
+{
+    //
+    // a0, a1       : extent along the major axis, caps included (a0 <= a1)
+    // b0           : minor coordinate of the center line at a0
+    // slope        : delta-minor / delta-major
+    // h            : half thickness, along the minor axis
+    // yMin, yMax   : rows touched
+    // xMin, xMax   : columns of a stroke adjusted segment
+    // mode         : one of the splashThinSeg* constants
+    //
+    SplashCoord a0, a1, b0, slope, h;
+    int         yMin, yMax, xMin, xMax;
+    int         mode;
+};
+
+#define splashThinSegXMajor 0 // |dx| >= |dy|
+#define splashThinSegYMajor 1 // |dy| > |dx|
+#define splashThinSegRect 2 // stroke adjusted, covers [xMin, xMax] fully
+
+//------------------------------------------------------------------------
+// SplashThinStroke
+//------------------------------------------------------------------------
+
+// Draws thin strokes without building the outline of the stroke: each
+// segment of the (flattened) path is a strip of constant width, and the
+// coverage of a pixel is the area of the strip inside it, scan line by
+// scan line, as in Wu's line drawing algorithm.  Caps and joins are
+// drawn by extending the strips, and the segments of a path are
+// combined by taking the largest coverage of each pixel -- which is
+// close to the outline fill for lines up to splashMaxThinStrokeWidth
+// pixels wide.
+class SplashThinStroke
+{
+public:
+    // Expands the flattened path <path> into device space segments,
+    // with the matrix, line cap, line join, and dash pattern of <state>.
+    // <lineWidthA> and the dash lengths are in user space.  If stroke
+    // adjustment is on, horizontal and vertical segments are aligned to
+    // the pixel grid, as SplashXPath does for stroke adjusted outlines.
+    SplashThinStroke(SplashPath *path, SplashState *state,
+                     SplashCoord lineWidthA);
+
+    // Bounding box of the touched pixels.  xMin > xMax if the stroke is
+    // empty.
+    int getXMin() { return xMin; }
+    int getXMax() { return xMax; }
+    int getYMin() { return yMin; }
+    int getYMax() { return yMax; }
+
+    // Compute shape values for scan line <y>, clipped to [x0, x1].  Sets
+    // [*xa, *xb] to the touched span, fills line[*xa .. *xb] with shape
+    // values in [0, 255], and returns true -- or returns false if the
+    // scan line is empty.  The scan lines must be visited in increasing
+    // order.
+    bool getSpan(unsigned char *line, int y, int x0, int x1, int *xa, int *xb);
+
+private:
+    void addSubpath(bool closed);
+    SplashCoord getJoinExt(SplashPathPoint *p0, SplashPathPoint *p1,
+                           SplashPathPoint *p2, int *end);
+    void addSegment(SplashPathPoint *p0, SplashPathPoint *p1, SplashCoord ext0,
+                    SplashCoord ext1, int end0, int end1);
+    void addDot(SplashPathPoint *p);
+    void getSegSpan(SplashThinSeg *seg, int y, int *xa, int *xb);
+    void drawSeg(SplashThinSeg *seg, unsigned char *line, int y, int xa,
+                 int xb);
+
+    SplashCoord *matrix;
+    SplashCoord  lineWidth, capExt, miterLimit, det;
+    int          lineCap, lineJoin;
+    bool         strokeAdjust;
+
+    // the points of the current subpath (or dash), in user space
+    std::vector< SplashPathPoint > pts;
+
+    std::vector< SplashThinSeg >   segs;
+    std::vector< SplashThinSeg * > activeSegs;
+    std::vector< int >             activeSpans;
+    size_t                         nextSeg;
+
+    int xMin, xMax, yMin, yMax;
+};
+
+#endif // XPDF_SPLASH_SPLASHTHINSTROKE_HH
@@ -10,7 +10,25 @@
 // coordinates
 //------------------------------------------------------------------------
 
+// The rasterizer computes in double precision by default.  Building
+// with USE_FLOAT switches it to single precision -- see the
+// splash_coord build option.
+#if USE_FLOAT
+typedef float SplashCoord;
+#else
 typedef double SplashCoord;
+#endif
+
+// Device-space coordinates of the expanded path segments (see
+// SplashXPathSeg).  Building with USE_FIXEDPOINT stores them in 24.8
+// fixed point, once the matrix has been applied; paths, matrices, and
+// the scan conversion arithmetic stay in SplashCoord.
+#if USE_FIXEDPOINT
+#include <utils/FixedPoint.hh>
+typedef FixedPoint SplashXCoord;
+#else
+typedef SplashCoord SplashXCoord;
+#endif
 
 //------------------------------------------------------------------------
 // antialiasing
@@ -28,8 +46,13 @@ enum SplashColorMode {
     splashModeMono8, // 1 byte per component, 1 byte per pixel
     splashModeRGB8, // 1 byte per component, 3 bytes per pixel:
     //   RGBRGB...
-    splashModeBGR8 // 1 byte per component, 3 bytes per pixel:
-//   BGRBGR...
+    splashModeBGR8, // 1 byte per component, 3 bytes per pixel:
+    //   BGRBGR...
+    splashModeXBGR8 // 1 byte per component, 4 bytes per pixel:
+//   BGRXBGRX... (X = 255), i.e., 32-bit
+//   0xXXRRGGBB words on little-endian
+//   machines; rows are aligned to
+//   splashBitmapRowAlign bytes
 
 #if SPLASH_CMYK
     ,
@@ -42,6 +65,11 @@ enum SplashColorMode {
 // (defined in SplashState.cc)
 extern int splashColorModeNComps[];
 
+// number of bytes per pixel in each color mode -- this is the number
+// of components, except for XBGR8 (and Mono1, which is listed as 1)
+// (defined in SplashState.cc)
+extern int splashColorModePixelSize[];
+
 // max number of components in any SplashColor
 #define splashMaxColorComps 3
 #if SPLASH_CMYK
@@ -80,6 +108,20 @@ static inline unsigned char splashBGR8B(SplashColorPtr bgr8)
     return bgr8[0];
 }
 
+// XBGR8
+static inline unsigned char splashXBGR8R(SplashColorPtr xbgr8)
+{
+    return xbgr8[2];
+}
+static inline unsigned char splashXBGR8G(SplashColorPtr xbgr8)
+{
+    return xbgr8[1];
+}
+static inline unsigned char splashXBGR8B(SplashColorPtr xbgr8)
+{
+    return xbgr8[0];
+}
+
 #if SPLASH_CMYK
 // CMYK8
 static inline unsigned char splashCMYK8C(SplashColorPtr cmyk8)
@@ -127,6 +169,13 @@ static inline void splashColorXor(SplashColorPtr dest, SplashColorPtr src)
 typedef void (*SplashBlendFunc)(SplashColorPtr src, SplashColorPtr dest,
                                 SplashColorPtr blend, SplashColorMode cm);
 
+// Span version of a separable blend function: blends <n> values of one
+// color component.  The buffers are padded to a multiple of
+// splashVecSize (see SplashSIMD.hh), so the function may process the
+// padding as well.
+typedef void (*SplashBlendSpanFunc)(unsigned char *src, unsigned char *dest,
+                                    unsigned char *blend, int n);
+
 //------------------------------------------------------------------------
 // screen parameters
 //------------------------------------------------------------------------
@@ -378,29 +378,34 @@ void SplashXPath::addCurve(SplashCoord x0, SplashCoord y0, SplashCoord x1,
 void SplashXPath::addSegment(SplashCoord x0, SplashCoord y0, SplashCoord x1,
                              SplashCoord y1)
 {
+    SplashXPathSeg *seg;
+
     grow(1);
+    seg = &segs[length];
     if (y0 <= y1) {
-        segs[length].x0 = x0;
-        segs[length].y0 = y0;
-        segs[length].x1 = x1;
-        segs[length].y1 = y1;
-        segs[length].count = 1;
+        seg->x0 = x0;
+        seg->y0 = y0;
+        seg->x1 = x1;
+        seg->y1 = y1;
+        seg->count = 1;
     } else {
-        segs[length].x0 = x1;
-        segs[length].y0 = y1;
-        segs[length].x1 = x0;
-        segs[length].y1 = y0;
-        segs[length].count = -1;
+        seg->x0 = x1;
+        seg->y0 = y1;
+        seg->x1 = x0;
+        seg->y1 = y0;
+        seg->count = -1;
     }
-    if (y0 == y1 || x0 == x1) {
-        segs[length].dxdy = 0;
-        segs[length].dydx = 0;
+    // the slopes come from the stored endpoints, which may have been
+    // narrowed to SplashXCoord
+    if (seg->y0 == seg->y1 || seg->x0 == seg->x1) {
+        seg->dxdy = 0;
+        seg->dydx = 0;
     } else {
-        segs[length].dxdy = (x1 - x0) / (y1 - y0);
-        if (segs[length].dxdy == 0) {
-            segs[length].dydx = 0;
+        seg->dxdy = (seg->x1 - seg->x0) / (seg->y1 - seg->y0);
+        if (seg->dxdy == 0) {
+            seg->dydx = 0;
         } else {
-            segs[length].dydx = 1 / segs[length].dxdy;
+            seg->dydx = 1 / seg->dxdy;
         }
     }
     ++length;
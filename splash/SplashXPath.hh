@@ -23,13 +23,14 @@ struct SplashPathHint;
 struct SplashXPathSeg
 {
     //
-    // x0, y0       : first endpoint (y0 <= y1)
-    // x1, y1       : second endpoint
+    // x0, y0       : first endpoint (y0 <= y1), in device space
+    // x1, y1       : second endpoint, in device space
     // dxdy         : slope: delta-x / delta-y
     // dydx         : slope: delta-y / delta-x
     // xCur0, xCur1 : current x values
     //
-    SplashCoord x0, y0, x1, y1, dxdy, dydx, xCur0, xCur1;
+    SplashXCoord x0, y0, x1, y1;
+    SplashCoord  dxdy, dydx, xCur0, xCur1;
 
     //
     // EO/NZWN counter increment
@@ -25,7 +25,9 @@ using namespace ranges;
 struct indirect_cmp_t
 {
     //
-    // Increasing order of xCur0, or dxdy:
+    // Increasing order of xCur0, or dxdy, or position in the path. The
+    // order is total, so the result of a scan does not depend on the
+    // scan lines visited before (see SplashBands):
     //
     bool operator()(const SplashXPathSeg *plhs, const SplashXPathSeg *prhs)
     {
@@ -37,6 +39,10 @@ struct indirect_cmp_t
             x = lhs.dxdy - rhs.dxdy;
         }
 
+        if (0 == x) {
+            return plhs < prhs;
+        }
+
         return x < 0;
     }
 };
@@ -0,0 +1,174 @@
+// -*- mode: c++ -*-
+// Copyright 2019-2020 Thinkoid, LLC.
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE xpdf
+
+#include <defs.hh>
+
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+#include <xpdf/config_cache.hh>
+
+BOOST_AUTO_TEST_SUITE(config_cache)
+
+namespace {
+
+struct fixture_type
+{
+    fixture_type()
+        : dir(fs::temp_directory_path() /
+              ("xpdf-config-cache-" + std::to_string(getpid())))
+    {
+        fs::remove_all(dir);
+        fs::create_directories(dir / "fonts");
+    }
+
+    ~fixture_type() { fs::remove_all(dir); }
+
+    void write(const fs::path &path, const std::string &s) const
+    {
+        std::ofstream(path, std::ios::binary) << s;
+    }
+
+    //
+    // Rewrites a file, keeping its size and modification time:
+    //
+    void overwrite(const fs::path &path, const std::string &s) const
+    {
+        const auto t = fs::last_write_time(path);
+        write(path, s);
+        fs::last_write_time(path, t);
+    }
+
+    fs::path dir;
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(tokenize)
+{
+    using tokens_type = std::vector< std::string >;
+
+    BOOST_TEST(xpdf::tokenize_config_line("") == tokens_type{ });
+    BOOST_TEST(xpdf::tokenize_config_line(" \t ") == tokens_type{ });
+
+    BOOST_TEST(xpdf::tokenize_config_line("  fontDir  /a/b ") ==
+               (tokens_type{ "fontDir", "/a/b" }));
+
+    BOOST_TEST(xpdf::tokenize_config_line("fontFile A \"/x y/a.pfb\"") ==
+               (tokens_type{ "fontFile", "A", "/x y/a.pfb" }));
+
+    BOOST_TEST(xpdf::tokenize_config_line("bind x any 'a b' c") ==
+               (tokens_type{ "bind", "x", "any", "a b", "c" }));
+}
+
+BOOST_FIXTURE_TEST_CASE(read, fixture_type)
+{
+    write(dir / "xpdfrc", "# comment\n"
+                          "\n"
+                          "psLevel level3\n"
+                          "  # indented comment\n"
+                          "fontFile A \"/x y/a.pfb\"\n");
+
+    write(dir / "names", "0041 A1\nbad\n0042 B1\n");
+    write(dir / "fonts" / "b.ttf", "");
+    write(dir / "fonts" / "a.pfb", "");
+
+    xpdf::config_cache_t cache;
+
+    auto lines = cache.config_file(dir / "xpdfrc");
+    BOOST_TEST_REQUIRE(lines);
+    BOOST_TEST(lines->size() == 2U);
+    BOOST_TEST((*lines)[0].first == 3);
+    BOOST_TEST((*lines)[1].first == 5);
+    BOOST_TEST((*lines)[1].second.back() == "/x y/a.pfb");
+
+    auto names = cache.name_to_unicode_file(dir / "names");
+    BOOST_TEST_REQUIRE(names);
+    BOOST_TEST(names->entries.size() == 2U);
+    BOOST_TEST(names->entries[1].first == "B1");
+    BOOST_TEST(names->entries[1].second == 0x42U);
+    BOOST_TEST(names->badLines == std::vector< int >{ 2 });
+
+    auto files = cache.font_dir(dir / "fonts");
+    BOOST_TEST_REQUIRE(files);
+    BOOST_TEST(*files == (std::vector< std::string >{ "a.pfb", "b.ttf" }));
+
+    BOOST_TEST(!cache.config_file(dir / "missing"));
+    BOOST_TEST(!cache.font_dir(dir / "missing"));
+}
+
+BOOST_FIXTURE_TEST_CASE(snapshot, fixture_type)
+{
+    const auto cacheFile = dir / "cache" / "config";
+
+    write(dir / "xpdfrc", "psLevel level3\n");
+    write(dir / "names", "0041 A1\n");
+    write(dir / "fonts" / "a.pfb", "");
+
+    {
+        xpdf::config_cache_t cache(cacheFile);
+
+        cache.config_file(dir / "xpdfrc");
+        cache.name_to_unicode_file(dir / "names");
+        cache.font_dir(dir / "fonts");
+        cache.save();
+    }
+
+    BOOST_TEST_REQUIRE(fs::exists(cacheFile));
+
+    // same size and time: the snapshot wins over the file contents
+    overwrite(dir / "xpdfrc", "psLevel level1\n");
+    overwrite(dir / "names", "0061 A1\n");
+
+    {
+        xpdf::config_cache_t cache(cacheFile);
+
+        auto lines = cache.config_file(dir / "xpdfrc");
+        BOOST_TEST_REQUIRE(lines);
+        BOOST_TEST((*lines)[0].second[1] == "level3");
+
+        auto names = cache.name_to_unicode_file(dir / "names");
+        BOOST_TEST_REQUIRE(names);
+        BOOST_TEST(names->entries[0].second == 0x41U);
+
+        auto files = cache.font_dir(dir / "fonts");
+        BOOST_TEST_REQUIRE(files);
+        BOOST_TEST(files->size() == 1U);
+    }
+
+    // a changed file is read again
+    write(dir / "xpdfrc", "psLevel level2\nrasterThreads 2\n");
+
+    {
+        xpdf::config_cache_t cache(cacheFile);
+
+        auto lines = cache.config_file(dir / "xpdfrc");
+        BOOST_TEST_REQUIRE(lines);
+        BOOST_TEST(lines->size() == 2U);
+        BOOST_TEST((*lines)[0].second[1] == "level2");
+
+        cache.save();
+    }
+
+    // a corrupt snapshot is ignored
+    write(cacheFile, "XCC1 and then some");
+
+    {
+        xpdf::config_cache_t cache(cacheFile);
+
+        auto names = cache.name_to_unicode_file(dir / "names");
+        BOOST_TEST_REQUIRE(names);
+        BOOST_TEST(names->entries[0].second == 0x61U);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,375 @@
+// -*- mode: c++ -*-
+// Copyright 2019-2020 Thinkoid, LLC.
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE xpdf
+
+#include <defs.hh>
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+#include <fofi/FoFiTrueType.hh>
+#include <fofi/FoFiType1C.hh>
+
+BOOST_AUTO_TEST_SUITE(fofi_truetype)
+
+namespace {
+
+using bytes_type = std::vector< char >;
+
+void put16(bytes_type &s, int x)
+{
+    s.push_back((char)(x >> 8));
+    s.push_back((char)x);
+}
+
+void put32(bytes_type &s, unsigned x)
+{
+    put16(s, (int)(x >> 16));
+    put16(s, (int)(x & 0xffff));
+}
+
+struct segment_type
+{
+    int start, end, delta;
+    std::vector< int > gids; // non-empty -> mapped through glyphIdArray
+};
+
+//
+// A format 4 cmap subtable (inside a cmap table with one encoding record):
+//
+bytes_type make_cmap(const std::vector< segment_type > &segs)
+{
+    const int segCnt = (int)segs.size();
+
+    bytes_type s;
+
+    put16(s, 0); // version
+    put16(s, 1); // number of subtables
+    put16(s, 3); // platform: Microsoft
+    put16(s, 1); // encoding: Unicode
+    put32(s, 12); // offset
+
+    bytes_type sub;
+
+    put16(sub, 4); // format
+    put16(sub, 0); // length, patched below
+    put16(sub, 0); // language
+    put16(sub, segCnt * 2);
+    put16(sub, 0); // searchRange, entrySelector, rangeShift -- unused
+    put16(sub, 0);
+    put16(sub, 0);
+
+    for (auto &seg : segs)
+        put16(sub, seg.end);
+
+    put16(sub, 0); // reservedPad
+
+    for (auto &seg : segs)
+        put16(sub, seg.start);
+
+    for (auto &seg : segs)
+        put16(sub, seg.delta);
+
+    // idRangeOffset is a byte offset from its own position to the
+    // segment's first entry in glyphIdArray
+    int glyphIdx = 0;
+
+    for (int i = 0; i < segCnt; ++i) {
+        if (segs[i].gids.empty()) {
+            put16(sub, 0);
+        } else {
+            put16(sub, 2 * (segCnt - i) + 2 * glyphIdx);
+            glyphIdx += (int)segs[i].gids.size();
+        }
+    }
+
+    for (auto &seg : segs)
+        for (int gid : seg.gids)
+            put16(sub, gid);
+
+    sub[2] = (char)(sub.size() >> 8);
+    sub[3] = (char)sub.size();
+
+    s.insert(s.end(), sub.begin(), sub.end());
+
+    return s;
+}
+
+//
+// A format 2 post table; glyph i is named names[indexes[i]]:
+//
+bytes_type make_post(const std::vector< std::string > &names,
+                     const std::vector< int > &indexes)
+{
+    bytes_type s;
+
+    put32(s, 0x00020000);
+    s.resize(32, 0);
+
+    put16(s, (int)indexes.size());
+
+    for (int i : indexes)
+        put16(s, 258 + i);
+
+    for (auto &name : names) {
+        s.push_back((char)name.size());
+        s.insert(s.end(), name.begin(), name.end());
+    }
+
+    return s;
+}
+
+//
+// A minimal TrueType font with <nGlyphs> empty glyphs; the table
+// directory is deliberately not sorted by tag:
+//
+bytes_type make_font(int nGlyphs, const bytes_type &cmap, const bytes_type &post)
+{
+    std::vector< std::pair< std::string, bytes_type > > tables;
+
+    bytes_type head(54, 0);
+    head[12] = 0x5f; // magic number
+    head[13] = 0x0f;
+    head[14] = 0x3c;
+    head[15] = 0xf5;
+
+    bytes_type maxp;
+    put32(maxp, 0x00005000);
+    put16(maxp, nGlyphs);
+
+    bytes_type hhea(36, 0);
+    hhea[35] = 1; // numberOfHMetrics
+
+    tables.emplace_back("post", post);
+    tables.emplace_back("maxp", maxp);
+    tables.emplace_back("loca", bytes_type((nGlyphs + 1) * 2, 0));
+    tables.emplace_back("hmtx", bytes_type(4, 0));
+    tables.emplace_back("hhea", hhea);
+    tables.emplace_back("head", head);
+    tables.emplace_back("glyf", bytes_type(4, 0));
+    tables.emplace_back("cmap", cmap);
+
+    bytes_type s;
+
+    put32(s, 0x00010000);
+    put16(s, (int)tables.size());
+    put16(s, 0);
+    put16(s, 0);
+    put16(s, 0);
+
+    unsigned offset = 12 + 16 * tables.size();
+
+    for (auto &[tag, data] : tables) {
+        s.insert(s.end(), tag.begin(), tag.end());
+        put32(s, 0);
+        put32(s, offset);
+        put32(s, (unsigned)data.size());
+        offset += (data.size() + 3) & ~3;
+    }
+
+    for (auto &[tag, data] : tables) {
+        s.insert(s.end(), data.begin(), data.end());
+        s.resize((s.size() + 3) & ~3, 0);
+    }
+
+    return s;
+}
+
+//
+// What a format 4 lookup must return, straight from the segment list:
+//
+int reference_gid(const std::vector< segment_type > &segs, int c)
+{
+    for (auto &seg : segs) {
+        if (c > seg.end)
+            continue;
+
+        if (c < seg.start)
+            return 0;
+
+        if (seg.gids.empty())
+            return (c + seg.delta) & 0xffff;
+
+        int gid = seg.gids[c - seg.start];
+        return gid ? (gid + seg.delta) & 0xffff : 0;
+    }
+
+    return 0;
+}
+
+const std::vector< segment_type > cjk_segments = {
+    { 0x20, 0x7e, 0x10000 - 0x1f, {} },
+    { 0xa0, 0xa7, 0, { 200, 0, 201, 202, 203, 204, 205, 206 } },
+    { 0x3000, 0x303f, 0x10000 - 0x3000 + 300, {} },
+    { 0x4e00, 0x9fa5, 0x10000 - 0x4e00 + 400, {} },
+    { 0xffff, 0xffff, 1, {} }
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(cmap_format4)
+{
+    const auto font = make_font(
+        21400, make_cmap(cjk_segments), make_post({ "a" }, { 0 }));
+
+    FoFiTrueType *ff = FoFiTrueType::make(font.data(), (int)font.size(), 0);
+    BOOST_TEST_REQUIRE(ff);
+
+    const int cmap = ff->findCmap(3, 1);
+    BOOST_TEST_REQUIRE(cmap == 0);
+
+    // the first pass goes through the binary search until the lookup
+    // array is built, the second one is served entirely from the array
+    for (int pass = 0; pass < 2; ++pass) {
+        int bad = 0;
+
+        for (int c = -1; c <= 0x10000; ++c)
+            bad += ff->mapCodeToGID(cmap, c) != reference_gid(cjk_segments, c);
+
+        BOOST_TEST(bad == 0);
+    }
+
+    delete ff;
+}
+
+BOOST_AUTO_TEST_CASE(cmap_format4_unsorted)
+{
+    // segment ends out of order: no lookup array, and the answers must
+    // not change from one pass to the next
+    const std::vector< segment_type > segs = {
+        { 0x4e00, 0x9fa5, 0, {} },
+        { 0x20, 0x7e, 0, {} },
+        { 0xffff, 0xffff, 1, {} }
+    };
+
+    const auto font =
+        make_font(100, make_cmap(segs), make_post({ "a" }, { 0 }));
+
+    FoFiTrueType *ff = FoFiTrueType::make(font.data(), (int)font.size(), 0);
+    BOOST_TEST_REQUIRE(ff);
+
+    std::vector< int > a, b;
+
+    for (int c = 0; c <= 0xffff; ++c)
+        a.push_back(ff->mapCodeToGID(0, c));
+
+    for (int c = 0; c <= 0xffff; ++c)
+        b.push_back(ff->mapCodeToGID(0, c));
+
+    BOOST_TEST(a == b);
+
+    delete ff;
+}
+
+BOOST_AUTO_TEST_CASE(post_names)
+{
+    // glyph names that refer to the post strings out of order, and a
+    // duplicate name (the last glyph wins)
+    const auto font = make_font(
+        5, make_cmap(cjk_segments),
+        make_post({ "alpha", "beta", "gamma", "delta" }, { 3, 2, 0, 1, 2 }));
+
+    FoFiTrueType *ff = FoFiTrueType::make(font.data(), (int)font.size(), 0);
+    BOOST_TEST_REQUIRE(ff);
+
+    BOOST_TEST(ff->mapNameToGID((char *)"alpha") == 2);
+    BOOST_TEST(ff->mapNameToGID((char *)"beta") == 3);
+    BOOST_TEST(ff->mapNameToGID((char *)"gamma") == 4);
+    BOOST_TEST(ff->mapNameToGID((char *)"delta") == 0);
+    BOOST_TEST(ff->mapNameToGID((char *)"epsilon") == 0);
+
+    delete ff;
+}
+
+namespace {
+
+void count_output(void *stream, const char *, int n)
+{
+    *static_cast< size_t * >(stream) += n;
+}
+
+} // anonymous namespace
+
+//
+// Loads and converts every TrueType/OpenType font under $FOFI_CORPUS
+// (default /usr/share/fonts); run with --run_test=fofi_truetype/benchmark_:
+//
+BOOST_AUTO_TEST_CASE(benchmark_, *utf::disabled())
+{
+    namespace fs = std::filesystem;
+    using clock_type = std::chrono::steady_clock;
+
+    const char *dir = getenv("FOFI_CORPUS");
+    if (!dir)
+        dir = "/usr/share/fonts";
+
+    double tload = 0, tcmap = 0, tconv = 0;
+    size_t nfonts = 0, nbytes = 0;
+
+    for (auto &entry : fs::recursive_directory_iterator(dir)) {
+        const auto ext = entry.path().extension().string();
+
+        if (ext != ".ttf" && ext != ".otf" && ext != ".TTF" && ext != ".OTF")
+            continue;
+
+        auto t0 = clock_type::now();
+
+        FoFiTrueType *ff = FoFiTrueType::load(entry.path().c_str(), 0);
+        if (!ff)
+            continue;
+
+        auto t1 = clock_type::now();
+
+        int cmap = ff->findCmap(3, 1);
+        if (cmap < 0)
+            cmap = ff->findCmap(3, 10);
+
+        std::vector< int > cidMap;
+        for (int c = 0; c <= 0xffff; ++c)
+            cidMap.push_back(ff->mapCodeToGID(cmap, c));
+
+        auto t2 = clock_type::now();
+
+        if (ff->isOpenTypeCFF()) {
+            char *start;
+            int   length;
+
+            if (ff->getCFFBlock(&start, &length)) {
+                if (FoFiType1C *cff = FoFiType1C::make(start, length)) {
+                    cff->convertToCIDType0("F", cidMap.data(),
+                                           (int)cidMap.size(), count_output,
+                                           &nbytes);
+                    cff->convertToType0("F", cidMap.data(), (int)cidMap.size(),
+                                        count_output, &nbytes);
+                    delete cff;
+                }
+            }
+        } else {
+            ff->convertToCIDType2("F", cidMap.data(), (int)cidMap.size(), false,
+                                  count_output, &nbytes);
+        }
+
+        auto t3 = clock_type::now();
+
+        tload += std::chrono::duration< double >(t1 - t0).count();
+        tcmap += std::chrono::duration< double >(t2 - t1).count();
+        tconv += std::chrono::duration< double >(t3 - t2).count();
+        ++nfonts;
+
+        delete ff;
+    }
+
+    std::cout << nfonts << " fonts: load " << tload << " s, cmap " << tcmap
+              << " s, convert " << tconv << " s (" << nbytes / 1e6 << " MB)\n";
+}
+
+BOOST_AUTO_TEST_SUITE_END()
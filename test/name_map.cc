@@ -0,0 +1,135 @@
+// -*- mode: c++ -*-
+// Copyright 2019-2020 Thinkoid, LLC.
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE xpdf
+
+#include <defs.hh>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+#include <xpdf/CharTypes.hh>
+#include <xpdf/FontEncodingTables.hh>
+#include <xpdf/name_map.hh>
+#include <xpdf/NameToUnicodeTable.cc>
+
+BOOST_AUTO_TEST_SUITE(name_map)
+
+static constexpr xpdf::name_map_t nameToUnicodeMap(nameToUnicodeTab);
+
+BOOST_AUTO_TEST_CASE(pairs)
+{
+    static constexpr std::pair< std::string_view, int > arr[] = {
+        { "space", 250 }, { "A", 722 }, { "B", 667 }, { "A", 1 }, { "a", 444 }
+    };
+
+    static constexpr xpdf::name_map_t m(arr);
+
+    static_assert(m.find("A") && *m.find("A") == 722);
+    static_assert(!m.find("C"));
+
+    BOOST_TEST(*m.find("space") == 250);
+    BOOST_TEST(*m.find("a") == 444);
+    BOOST_TEST(*m.find("B") == 667);
+    BOOST_TEST(!m.find(""));
+    BOOST_TEST(!m.find("spac"));
+    BOOST_TEST(!m.find("spacex"));
+
+    xpdf::name_map_view_t< int > v = m;
+    BOOST_TEST(*v.find("A") == 722);
+}
+
+BOOST_AUTO_TEST_CASE(encoding)
+{
+    static constexpr const char *enc[8] = { nullptr, "space", "A",     nullptr,
+                                            "B",     "space", nullptr, "C" };
+
+    static constexpr xpdf::name_map_t< CharCode, 8 > m(enc);
+
+    BOOST_TEST(*m.find("space") == 1U);
+    BOOST_TEST(*m.find("A") == 2U);
+    BOOST_TEST(*m.find("C") == 7U);
+    BOOST_TEST(!m.find(""));
+
+    BOOST_TEST(macRomanCharCode("space") == 32U);
+    BOOST_TEST(macRomanCharCode("A") == 65U);
+    BOOST_TEST(macRomanCharCode("caron") == 255U);
+    BOOST_TEST(macRomanCharCode("nonesuch") == 0U);
+}
+
+BOOST_AUTO_TEST_CASE(name_to_unicode)
+{
+    std::map< std::string_view, Unicode > ref;
+
+    for (auto &[name, u] : nameToUnicodeTab)
+        ref.emplace(name, u);
+
+    int bad = 0;
+
+    for (auto &[name, u] : ref) {
+        auto p = nameToUnicodeMap.find(name);
+        bad += !p || *p != u;
+
+        // near misses
+        for (auto s : { std::string(name) + "x",
+                        std::string(name.substr(0, name.size() - 1)) }) {
+            bad += (nameToUnicodeMap.find(s) != nullptr) != (ref.count(s) > 0);
+        }
+    }
+
+    BOOST_TEST(bad == 0);
+}
+
+//
+// --run_test=name_map/benchmark_:
+//
+BOOST_AUTO_TEST_CASE(benchmark_, *utf::disabled())
+{
+    using clock_type = std::chrono::steady_clock;
+
+    std::map< std::string, Unicode > ref;
+
+    for (auto &[name, u] : nameToUnicodeTab)
+        ref.emplace(name, u);
+
+    const int n = 100;
+    Unicode   a = 0, b = 0;
+
+    auto t0 = clock_type::now();
+
+    for (int i = 0; i < n; ++i) {
+        for (auto &entry : nameToUnicodeTab) {
+            auto iter = ref.find(std::string(entry.first));
+            a += iter == ref.end() ? 0 : iter->second;
+        }
+    }
+
+    auto t1 = clock_type::now();
+
+    for (int i = 0; i < n; ++i) {
+        for (auto &entry : nameToUnicodeTab) {
+            auto p = nameToUnicodeMap.find(entry.first);
+            b += p ? *p : 0;
+        }
+    }
+
+    auto t2 = clock_type::now();
+
+    const double m = n * (sizeof nameToUnicodeTab / sizeof *nameToUnicodeTab);
+
+    const double ta = std::chrono::duration< double >(t1 - t0).count();
+    const double tb = std::chrono::duration< double >(t2 - t1).count();
+
+    std::cout << "std::map " << ta / m * 1e9 << " ns, name_map_t "
+              << tb / m * 1e9 << " ns per lookup\n";
+
+    BOOST_TEST(a == b);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
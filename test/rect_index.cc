@@ -0,0 +1,75 @@
+// -*- mode: c++ -*-
+// Copyright 2019-2020 Thinkoid, LLC.
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE xpdf
+
+#include <defs.hh>
+
+#include <iostream>
+#include <exception>
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+#include <xpdf/bbox.hh>
+#include <xpdf/rect_index.hh>
+
+BOOST_AUTO_TEST_SUITE(rect_index)
+
+BOOST_AUTO_TEST_CASE(empty_)
+{
+    xpdf::rect_index_t index;
+
+    BOOST_TEST(index.empty());
+    BOOST_TEST(index.find(0, 0).empty());
+    BOOST_TEST(index.find_last(0, 0) == -1);
+}
+
+BOOST_AUTO_TEST_CASE(point_)
+{
+    //
+    // A 10x10 grid of unit boxes, overlapped by one large box:
+    //
+    std::vector< xpdf::bbox_t > boxes;
+
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            boxes.push_back({ double(j), double(i), j + .5, i + .5 });
+        }
+    }
+
+    boxes.push_back({ 9.75, 9.75, 2, 2 });
+
+    const xpdf::rect_index_t index(boxes);
+
+    BOOST_TEST(index.size() == boxes.size());
+
+    BOOST_TEST(index.find_first(3.25, 4.25) == 43);
+    BOOST_TEST(index.find_last(3.25, 4.25) == 100);
+
+    BOOST_TEST(index.find_first(2.25, 2.25) == 22);
+    BOOST_TEST(index.find_last(2.25, 2.25) == 100);
+
+    BOOST_TEST(index.find_first(2.75, 2.75) == 100);
+    BOOST_TEST(index.find_first(.75, .75) == -1);
+    BOOST_TEST(index.find_first(-1, -1) == -1);
+
+    // Edges are inclusive:
+    BOOST_TEST(index.find_first(9.5, 9.5) == 99);
+    BOOST_TEST(index.find(2, 2) == std::vector< size_t >({ 22, 100 }));
+}
+
+BOOST_AUTO_TEST_CASE(box_)
+{
+    const xpdf::rect_index_t index(std::vector< xpdf::bbox_t >{
+        { 0, 0, 1, 1 }, { 10, 10, 11, 11 }, { 0, 0, 20, 1 }, { 5, 5, 6, 6 } });
+
+    BOOST_TEST(index.find(xpdf::bbox_t{ 4, 0, 12, 12 }) ==
+               std::vector< size_t >({ 1, 2, 3 }));
+
+    BOOST_TEST(index.find(xpdf::bbox_t{ 2, 2, 4, 4 }).empty());
+    BOOST_TEST(index.find(xpdf::bbox_t{ 30, 30, 40, 40 }).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
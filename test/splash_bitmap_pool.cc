@@ -0,0 +1,94 @@
+// -*- mode: c++ -*-
+// Copyright 2019-2020 Thinkoid, LLC.
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE xpdf
+
+#include <defs.hh>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+#include <splash/SplashBitmap.hh>
+#include <splash/SplashBitmapPool.hh>
+
+BOOST_AUTO_TEST_SUITE(splash_bitmap_pool)
+
+BOOST_AUTO_TEST_CASE(reuse_)
+{
+    SplashBitmapPool pool;
+
+    unsigned char *p = pool.alloc(1000);
+    BOOST_TEST(p);
+    BOOST_TEST((uintptr_t)p % splashBitmapRowAlign == 0);
+
+    memset(p, 0xff, 1000);
+    pool.release(p, 1000);
+    BOOST_TEST(pool.getCachedSize() >= 1000U);
+
+    //
+    // A size in the same class gets the same, zero-filled, buffer:
+    //
+    unsigned char *q = pool.alloc(990);
+    BOOST_TEST(q == p);
+
+    for (int i = 0; i < 990; ++i) {
+        BOOST_TEST(q[i] == 0);
+    }
+
+    BOOST_TEST(pool.getCachedSize() == 0U);
+    pool.release(q, 990);
+
+    pool.clear();
+    BOOST_TEST(pool.getCachedSize() == 0U);
+}
+
+BOOST_AUTO_TEST_CASE(limit_)
+{
+    SplashBitmapPool pool(4096);
+
+    unsigned char *p = pool.alloc(3000);
+    unsigned char *q = pool.alloc(3000);
+
+    pool.release(p, 3000);
+    pool.release(q, 3000);
+
+    BOOST_TEST(pool.getCachedSize() <= 4096U);
+}
+
+BOOST_AUTO_TEST_CASE(xbgr8_bitmap_)
+{
+    auto pool = std::make_shared< SplashBitmapPool >();
+
+    {
+        SplashBitmap bitmap(33, 7, 1, splashModeXBGR8, true, true, pool);
+
+        BOOST_TEST(bitmap.getRowSize() % splashBitmapRowAlign == 0);
+        BOOST_TEST(bitmap.getRowSize() >= 33 * 4);
+        BOOST_TEST((uintptr_t)bitmap.getDataPtr() % splashBitmapRowAlign == 0);
+
+        SplashColorPtr p = bitmap.getDataPtr() + 5 * bitmap.getRowSize() + 4 * 9;
+        p[0] = 1; // B
+        p[1] = 2; // G
+        p[2] = 3; // R
+        p[3] = 255;
+
+        SplashColor c;
+        bitmap.getPixel(9, 5, c);
+
+        BOOST_TEST(c[0] == 3);
+        BOOST_TEST(c[1] == 2);
+        BOOST_TEST(c[2] == 1);
+    }
+
+    //
+    // The data and alpha buffers went back to the pool:
+    //
+    BOOST_TEST(pool->getCachedSize() > 0U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,293 @@
+// -*- mode: c++ -*-
+// Copyright 2019-2020 Thinkoid, LLC.
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE xpdf
+
+#include <defs.hh>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+#include <utils/FixedPoint.hh>
+
+#include <splash/Splash.hh>
+#include <splash/SplashBitmap.hh>
+#include <splash/SplashPath.hh>
+#include <splash/SplashPattern.hh>
+#include <splash/SplashTypes.hh>
+
+//
+// The rasterizer is built with double or float coordinates, and with
+// double, float, or 24.8 fixed point device-space segments (the
+// splash_coord build option).  The accuracy cases below hold for all
+// three; the benchmark renders a few vector-heavy pages and, with
+// SPLASH_COORD_OUT set, saves them so the renders of two builds can be
+// compared.
+//
+BOOST_AUTO_TEST_SUITE(splash_coord)
+
+namespace {
+
+struct page_t
+{
+    page_t(int w, int h)
+        : bitmap(w, h, 1, splashModeMono8, false), splash(&bitmap, true)
+    {
+        SplashColor white = { 0xff };
+        SplashColor black = { 0x00 };
+
+        splash.clear(white);
+        splash.setFillPattern(new SplashSolidColor(black));
+        splash.setStrokePattern(new SplashSolidColor(black));
+    }
+
+    //
+    // Area covered by the paint, in pixels:
+    //
+    double coverage()
+    {
+        double sum = 0;
+
+        for (int y = 0; y < bitmap.getHeight(); ++y) {
+            const unsigned char *p = bitmap.getDataPtr() + y * bitmap.getRowSize();
+            for (int x = 0; x < bitmap.getWidth(); ++x) {
+                sum += 0xff - p[x];
+            }
+        }
+
+        return sum / 0xff;
+    }
+
+    void save(const std::string &filename)
+    {
+        FILE *f = fopen(filename.c_str(), "wb");
+        BOOST_REQUIRE(f);
+
+        fprintf(f, "P5\n%d %d\n255\n", bitmap.getWidth(), bitmap.getHeight());
+        for (int y = 0; y < bitmap.getHeight(); ++y) {
+            fwrite(bitmap.getDataPtr() + y * bitmap.getRowSize(), 1,
+                   bitmap.getWidth(), f);
+        }
+
+        fclose(f);
+    }
+
+    SplashBitmap bitmap;
+    Splash       splash;
+};
+
+void rect(SplashPath &path, double x0, double y0, double x1, double y1)
+{
+    path.moveTo(x0, y0);
+    path.lineTo(x1, y0);
+    path.lineTo(x1, y1);
+    path.lineTo(x0, y1);
+    path.close();
+}
+
+void circle(SplashPath &path, double cx, double cy, double r)
+{
+    //
+    // Four Bezier arcs:
+    //
+    const double k = 0.55228475 * r;
+
+    path.moveTo(cx + r, cy);
+    path.curveTo(cx + r, cy + k, cx + k, cy + r, cx, cy + r);
+    path.curveTo(cx - k, cy + r, cx - r, cy + k, cx - r, cy);
+    path.curveTo(cx - r, cy - k, cx - k, cy - r, cx, cy - r);
+    path.curveTo(cx + k, cy - r, cx + r, cy - k, cx + r, cy);
+    path.close();
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(fixed_point_)
+{
+    FixedPoint a(1.5), b(-2.25);
+
+    BOOST_TEST(a.getRaw() == 384);
+    BOOST_TEST((double)b == -2.25);
+
+    //
+    // Values are rounded to 1/256, and the arithmetic is done in double:
+    //
+    BOOST_TEST((double)FixedPoint(0.3) == 77 / 256.0);
+    BOOST_TEST(a + b == -0.75);
+    BOOST_TEST(a * b == -3.375);
+    BOOST_TEST(b / a == -1.5);
+    BOOST_TEST(!(a < b));
+
+    //
+    // Saturation, instead of wrap-around:
+    //
+    BOOST_TEST((double)FixedPoint(1e9) > 8388607);
+    BOOST_TEST((double)FixedPoint(-1e9) < -8388607);
+    BOOST_TEST((double)FixedPoint(NAN) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(rect_coverage_)
+{
+    const double rects[][4] = {
+        { 10.25, 10.5, 90.75, 30.125 },
+        { 3.3, 40.6, 96.9, 41.4 },   // thinner than a pixel
+        { 50.1, 1.9, 50.9, 98.2 },
+    };
+
+    for (const auto &r : rects) {
+        page_t page(100, 100);
+
+        SplashPath path;
+        rect(path, r[0], r[1], r[2], r[3]);
+        page.splash.fill(&path, false);
+
+        //
+        // Anti-aliasing samples each pixel 4x4 (and gamma-corrects the
+        // partial coverage), so the edge pixels are approximate:
+        //
+        const double area = (r[2] - r[0]) * (r[3] - r[1]);
+        const double edge = 2 * ((r[2] - r[0]) + (r[3] - r[1]));
+
+        BOOST_TEST(std::fabs(page.coverage() - area) <= edge / 4 + 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(circle_coverage_)
+{
+    for (double r : { 2.5, 17.3, 45.0 }) {
+        page_t page(100, 100);
+
+        SplashPath path;
+        circle(path, 50.2, 49.7, r);
+        page.splash.fill(&path, false);
+
+        const double area = M_PI * r * r;
+        BOOST_TEST(std::fabs(page.coverage() - area) <= M_PI * r / 4 + 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(large_coordinates_)
+{
+    //
+    // A shape that extends far outside the bitmap, with a large
+    // translation in the matrix: the part inside is still filled
+    // exactly, even where the fixed point device coordinates saturate.
+    //
+    for (double offset : { 0.0, 1000.0, 20000.0 }) {
+        page_t page(100, 100);
+
+        SplashCoord mat[6] = { 1, 0, 0, 1, -offset, -offset };
+        page.splash.setMatrix(mat);
+
+        SplashPath path;
+        rect(path, offset - 1e7, offset + 20.5, offset + 1e7, offset + 60.5);
+        page.splash.fill(&path, false);
+
+        BOOST_TEST(std::fabs(page.coverage() - 100 * 40) <= 100 / 2 + 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(scaled_coordinates_)
+{
+    //
+    // Large user space coordinates, scaled down by the matrix into the
+    // bitmap: only the device space coordinates are narrowed.
+    //
+    SplashCoord mat[6] = { 0.01, 0, 0, 0.01, -450, -450 };
+
+    {
+        page_t page(100, 100);
+        page.splash.setMatrix(mat);
+
+        SplashPath path;
+        rect(path, 45000, 45000, 55000, 55000);
+        page.splash.fill(&path, false);
+
+        BOOST_TEST(page.coverage() == 100 * 100);
+    }
+
+    {
+        page_t page(100, 100);
+        page.splash.setMatrix(mat);
+
+        SplashPath path;
+        circle(path, 50000, 50000, 4000);
+        page.splash.fill(&path, false);
+
+        BOOST_TEST(std::fabs(page.coverage() - M_PI * 40 * 40) <= M_PI * 40 / 4 + 1);
+    }
+}
+
+//
+// Renders a few generated, vector-heavy pages and reports the time --
+// run with --run_test=splash_coord/benchmark_ in the builds to compare.
+// With SPLASH_COORD_OUT set, the pages are saved as
+// $SPLASH_COORD_OUT-<n>.pgm:
+//
+BOOST_AUTO_TEST_CASE(benchmark_, *utf::disabled())
+{
+    using clock_type = std::chrono::steady_clock;
+
+    const char *out = getenv("SPLASH_COORD_OUT");
+
+    for (int n = 0; n < 3; ++n) {
+        page_t page(1700, 2200);
+
+        std::mt19937                             gen(n);
+        std::uniform_real_distribution< double > pos(-100, 1800);
+        std::uniform_real_distribution< double > width(0.1, 4);
+
+        auto t0 = clock_type::now();
+
+        for (int i = 0; i < 1000; ++i) {
+            SplashPath path;
+
+            switch (n) {
+            case 0:
+                // curves, stroked at various widths
+                path.moveTo(pos(gen), pos(gen));
+                path.curveTo(pos(gen), pos(gen), pos(gen), pos(gen), pos(gen),
+                             pos(gen));
+                page.splash.setLineWidth(width(gen));
+                page.splash.stroke(&path);
+                break;
+
+            case 1:
+                // small filled circles, as in a scatter plot
+                circle(path, pos(gen), pos(gen), width(gen) * 2);
+                page.splash.fill(&path, false);
+                break;
+
+            default:
+                // long polylines, as in a map or a chart
+                path.moveTo(pos(gen), pos(gen));
+                for (int j = 0; j < 10; ++j) {
+                    path.lineTo(pos(gen), pos(gen));
+                }
+                page.splash.setLineWidth(width(gen) / 4);
+                page.splash.stroke(&path);
+                break;
+            }
+        }
+
+        auto t1 = clock_type::now();
+
+        std::cout << "page " << n << ": "
+                  << std::chrono::duration< double >(t1 - t0).count() << " s\n";
+
+        if (out) {
+            page.save(std::string(out) + "-" + std::to_string(n) + ".pgm");
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,224 @@
+// -*- mode: c++ -*-
+// Copyright 2019-2020 Thinkoid, LLC.
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE xpdf
+
+#include <defs.hh>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+#include <splash/SplashScaleKernels.hh>
+
+BOOST_AUTO_TEST_SUITE(splash_scale_kernels)
+
+namespace {
+
+//
+// The per-pixel downscaler, as in Splash::scaleImageYdXd:
+//
+void reference_scale(const std::vector< unsigned char > &src, int nComps,
+                     int srcWidth, int srcHeight, int scaledWidth,
+                     int scaledHeight, int scale,
+                     std::vector< unsigned char > &dest)
+{
+    std::vector< unsigned > pixBuf(srcWidth * nComps);
+    unsigned                pix[4];
+
+    const int yp = srcHeight / scaledHeight, yq = srcHeight % scaledHeight;
+    const int xp = srcWidth / scaledWidth, xq = srcWidth % scaledWidth;
+
+    dest.resize(scaledWidth * scaledHeight * nComps);
+
+    unsigned char *destPtr = dest.data();
+    const unsigned char *srcPtr = src.data();
+
+    for (int y = 0, yt = 0; y < scaledHeight; ++y) {
+        int yStep = yp;
+        if ((yt += yq) >= scaledHeight) {
+            yt -= scaledHeight;
+            ++yStep;
+        }
+
+        std::fill(pixBuf.begin(), pixBuf.end(), 0);
+        for (int i = 0; i < yStep; ++i) {
+            for (int j = 0; j < srcWidth * nComps; ++j) {
+                pixBuf[j] += *srcPtr++;
+            }
+        }
+
+        const int d0 = (scale << 23) / (yStep * xp);
+        const int d1 = (scale << 23) / (yStep * (xp + 1));
+
+        for (int x = 0, xt = 0, xx = 0; x < scaledWidth; ++x) {
+            int xStep = xp, d = d0;
+            if ((xt += xq) >= scaledWidth) {
+                xt -= scaledWidth;
+                ++xStep;
+                d = d1;
+            }
+            for (int j = 0; j < nComps; ++j) {
+                pix[j] = 0;
+            }
+            for (int i = 0; i < xStep; ++i) {
+                for (int j = 0; j < nComps; ++j) {
+                    pix[j] += pixBuf[xx++];
+                }
+            }
+            for (int j = 0; j < nComps; ++j) {
+                *destPtr++ = (unsigned char)((pix[j] * d) >> 23);
+            }
+        }
+    }
+}
+
+//
+// The same, with the row kernels:
+//
+void kernel_scale(const std::vector< unsigned char > &src, int nComps,
+                  int srcWidth, int srcHeight, int scaledWidth,
+                  int scaledHeight, int scale, std::vector< unsigned char > &dest)
+{
+    std::vector< unsigned > pixBuf(srcWidth * nComps);
+
+    const int yp = srcHeight / scaledHeight, yq = srcHeight % scaledHeight;
+
+    dest.resize(scaledWidth * scaledHeight * nComps);
+
+    unsigned char *destPtr = dest.data();
+    const unsigned char *srcPtr = src.data();
+
+    for (int y = 0, yt = 0; y < scaledHeight; ++y) {
+        int yStep = yp;
+        if ((yt += yq) >= scaledHeight) {
+            yt -= scaledHeight;
+            ++yStep;
+        }
+
+        std::fill(pixBuf.begin(), pixBuf.end(), 0);
+        for (int i = 0; i < yStep; ++i) {
+            splashScaleAccumRow(pixBuf.data(), srcPtr, srcWidth * nComps);
+            srcPtr += srcWidth * nComps;
+        }
+
+        splashScaleBoxRow(pixBuf.data(), nComps, srcWidth, scaledWidth, yStep,
+                          scale, destPtr);
+        destPtr += scaledWidth * nComps;
+    }
+}
+
+std::vector< unsigned char > make_image(int n, int maxValue)
+{
+    std::mt19937                         gen(n);
+    std::uniform_int_distribution< int > dist(0, maxValue);
+    std::vector< unsigned char >         v(n);
+
+    for (auto &x : v) {
+        x = (unsigned char)dist(gen);
+    }
+
+    return v;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(box_row_)
+{
+    const int sizes[][4] = {
+        { 64, 48, 32, 24 },  // 2x
+        { 64, 48, 16, 12 },  // 4x
+        { 72, 40, 9, 5 },    // 8x
+        { 61, 37, 61, 20 },  // 1x horizontally
+        { 100, 90, 33, 29 }, // uneven
+        { 17, 9, 5, 4 },     // short rows
+        { 8, 8, 1, 1 },      // one pixel
+    };
+
+    for (const auto &sz : sizes) {
+        for (int nComps : { 1, 3, 4 }) {
+            for (int scale : { 1, 255 }) {
+                const auto src = make_image(sz[0] * sz[1] * nComps,
+                                            scale == 1 ? 255 : 1);
+
+                std::vector< unsigned char > a, b;
+                reference_scale(src, nComps, sz[0], sz[1], sz[2], sz[3], scale,
+                                a);
+                kernel_scale(src, nComps, sz[0], sz[1], sz[2], sz[3], scale, b);
+
+                BOOST_TEST(a == b);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(div_row_)
+{
+    std::vector< unsigned > acc(103);
+    std::vector< unsigned char > dest(acc.size());
+
+    // 8-bit samples, and (0 or 1) mask samples
+    for (int scale : { 1, 255 }) {
+        for (int yStep : { 1, 3, 8 }) {
+            const unsigned max = 255 / scale * yStep;
+
+            for (size_t i = 0; i < acc.size(); ++i) {
+                acc[i] = (unsigned)((i * 37) % (max + 1));
+            }
+
+            splashScaleDivRow(acc.data(), yStep, scale, dest.data(),
+                              (int)acc.size());
+
+            const unsigned d = ((unsigned)scale << 23) / yStep;
+            for (size_t i = 0; i < acc.size(); ++i) {
+                BOOST_TEST(dest[i] == (unsigned char)((acc[i] * d) >> 23));
+            }
+        }
+    }
+}
+
+//
+// Throughput of the per-pixel and the kernel scalers, on a page scan
+// downscaled from 600 to 75 and 100 dpi -- run with
+// --run_test=splash_scale_kernels/benchmark_:
+//
+BOOST_AUTO_TEST_CASE(benchmark_, *utf::disabled())
+{
+    using clock_type = std::chrono::steady_clock;
+
+    const int srcWidth = 5100, srcHeight = 6600;
+
+    for (int nComps : { 1, 3 }) {
+        const auto src = make_image(srcWidth * srcHeight * nComps, 255);
+
+        for (int factor : { 8, 6 }) {
+            std::vector< unsigned char > a, b;
+
+            auto t0 = clock_type::now();
+            reference_scale(src, nComps, srcWidth, srcHeight, srcWidth / factor,
+                            srcHeight / factor, 1, a);
+
+            auto t1 = clock_type::now();
+            kernel_scale(src, nComps, srcWidth, srcHeight, srcWidth / factor,
+                         srcHeight / factor, 1, b);
+
+            auto t2 = clock_type::now();
+
+            const double mb = src.size() / 1e6;
+            const double ta = std::chrono::duration< double >(t1 - t0).count();
+            const double tb = std::chrono::duration< double >(t2 - t1).count();
+
+            std::cout << nComps << " comps, 1/" << factor << ": per-pixel "
+                      << mb / ta << " MB/s, kernels " << mb / tb << " MB/s\n";
+
+            BOOST_TEST(a == b);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,205 @@
+// -*- mode: c++ -*-
+// Copyright 2019-2020 Thinkoid, LLC.
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE xpdf
+
+#include <defs.hh>
+
+#include <iostream>
+#include <exception>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+#include <splash/SplashSpanKernels.hh>
+
+BOOST_AUTO_TEST_SUITE(splash_span_kernels)
+
+namespace {
+
+//
+// Reference formulas, as in Splash::pipeRun:
+//
+inline int div255(int x) { return (x + (x >> 8) + 0x80) >> 8; }
+
+//
+// All pairs of 8-bit values, in two planes padded to splashVecSize:
+//
+struct pairs_t
+{
+    pairs_t() : a(n), b(n)
+    {
+        for (int i = 0; i < n; ++i) {
+            a[i] = i >> 8;
+            b[i] = i & 0xff;
+        }
+    }
+
+    static const int n = 256 * 256;
+    std::vector< unsigned char > a, b;
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(src_alpha_)
+{
+    pairs_t                      p;
+    std::vector< unsigned char > aSrc(p.n);
+
+    for (int aInput = 0; aInput < 256; aInput += 51) {
+        splashSpanSrcAlpha(aInput, p.a.data(), p.b.data(), aSrc.data(), p.n);
+
+        for (int i = 0; i < p.n; ++i) {
+            BOOST_TEST(aSrc[i] == div255(div255(aInput * p.a[i]) * p.b[i]));
+        }
+
+        splashSpanSrcAlpha(aInput, 0, p.b.data(), aSrc.data(), p.n);
+
+        for (int i = 0; i < p.n; ++i) {
+            BOOST_TEST(aSrc[i] == div255(aInput * p.b[i]));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(alpha_)
+{
+    pairs_t                      p;
+    std::vector< unsigned char > aResult(p.n), alphaI(p.n), alphaIm1(p.n);
+    std::vector< unsigned char > alpha0(p.n, 100);
+
+    splashSpanAlpha(p.a.data(), p.b.data(), alpha0.data(), aResult.data(),
+                    alphaI.data(), alphaIm1.data(), p.n);
+
+    for (int i = 0; i < p.n; ++i) {
+        const int aS = p.a[i], aD = p.b[i], a0 = alpha0[i];
+        const int aR = aS + aD - div255(aS * aD);
+
+        BOOST_TEST(aResult[i] == aR);
+        BOOST_TEST(alphaI[i] == aR + a0 - div255(aR * a0));
+        BOOST_TEST(alphaIm1[i] == a0 + aD - div255(a0 * aD));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(non_isolated_)
+{
+    pairs_t                      p;
+    std::vector< unsigned char > cSrc(p.n), cDest(p.n, 200);
+
+    for (int cS = 0; cS < 256; cS += 15) {
+        std::fill(cSrc.begin(), cSrc.end(), cS);
+
+        splashSpanNonIsolated(cSrc.data(), cDest.data(), p.a.data(), p.b.data(),
+                              p.n);
+
+        for (int i = 0; i < p.n; ++i) {
+            const int shape = p.a[i], aD = p.b[i];
+
+            int t = shape ? (aD * 255) / shape - aD : -aD;
+            int c = cS + ((cS - cDest[i]) * t) / 255;
+
+            c = c < 0 ? 0 : c > 255 ? 255 : c;
+            BOOST_TEST(cSrc[i] == c);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(result_color_)
+{
+    pairs_t                      p;
+    std::vector< unsigned char > aResult(p.n), alphaI(p.n), alphaIm1(p.n);
+    std::vector< unsigned char > cSrc(p.n, 30), cDest(p.n, 220),
+        cBlend(p.n, 90), cResult(p.n);
+
+    splashSpanAlpha(p.a.data(), p.b.data(), 0, aResult.data(), alphaI.data(),
+                    alphaIm1.data(), p.n);
+
+    splashSpanResultColor(cSrc.data(), cDest.data(), cBlend.data(), p.a.data(),
+                          alphaI.data(), alphaIm1.data(), cResult.data(), p.n);
+
+    for (int i = 0; i < p.n; ++i) {
+        const int aS = p.a[i], aI = alphaI[i], aIm1 = alphaIm1[i];
+
+        const int c = aI == 0 ?
+                          0 :
+                          ((aI - aS) * cDest[i] +
+                           (aS * ((255 - aIm1) * cSrc[i] + aIm1 * cBlend[i])) /
+                               255) /
+                              aI;
+
+        BOOST_TEST(cResult[i] == c);
+    }
+
+    splashSpanResultColor(cSrc.data(), cDest.data(), 0, p.a.data(),
+                          alphaI.data(), alphaIm1.data(), cResult.data(), p.n);
+
+    for (int i = 0; i < p.n; ++i) {
+        const int aS = p.a[i], aI = alphaI[i];
+
+        const int c =
+            aI == 0 ? 0 : ((aI - aS) * cDest[i] + aS * cSrc[i]) / aI;
+
+        BOOST_TEST(cResult[i] == c);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(result_color_opaque_dest_)
+{
+    pairs_t                      p;
+    std::vector< unsigned char > aDest(p.n, 255), aResult(p.n), alphaI(p.n),
+        alphaIm1(p.n), cResult(p.n);
+
+    splashSpanAlpha(p.a.data(), aDest.data(), 0, aResult.data(), alphaI.data(),
+                    alphaIm1.data(), p.n);
+
+    splashSpanResultColor(p.b.data(), p.a.data(), p.b.data(), p.a.data(), 0,
+                          alphaIm1.data(), cResult.data(), p.n);
+
+    for (int i = 0; i < p.n; ++i) {
+        const int aS = p.a[i], cS = p.b[i], cD = p.a[i];
+
+        BOOST_TEST(alphaI[i] == 255);
+        BOOST_TEST(cResult[i] == ((255 - aS) * cD + (aS * (255 * cS)) / 255) /
+                                     255);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(blend_opaque_)
+{
+    pairs_t                      p;
+    std::vector< unsigned char > aDest(p.n, 77), cResult(p.n);
+
+    splashSpanBlendOpaque(p.a.data(), p.b.data(), aDest.data(), cResult.data(),
+                          p.n);
+
+    for (int i = 0; i < p.n; ++i) {
+        BOOST_TEST(cResult[i] == div255((255 - 77) * p.a[i] + 77 * p.b[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(composite_background_)
+{
+    pairs_t p;
+
+    //
+    // An odd length, to exercise the scalar tail:
+    //
+    const int                    n = p.n - 3;
+    std::vector< unsigned char > data(3 * n);
+
+    for (int i = 0; i < n; ++i) {
+        data[3 * i + 1] = p.b[i];
+    }
+
+    splashSpanCompositeBackground(data.data() + 1, p.a.data(), 123, 3, n);
+
+    for (int i = 0; i < n; ++i) {
+        BOOST_TEST(data[3 * i] == 0);
+        BOOST_TEST(data[3 * i + 1] ==
+                   div255((255 - p.a[i]) * 123 + p.a[i] * p.b[i]));
+        BOOST_TEST(data[3 * i + 2] == 0);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
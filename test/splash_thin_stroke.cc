@@ -0,0 +1,278 @@
+// -*- mode: c++ -*-
+// Copyright 2019-2020 Thinkoid, LLC.
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE xpdf
+
+#include <defs.hh>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <initializer_list>
+#include <iostream>
+#include <random>
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+#include <splash/Splash.hh>
+#include <splash/SplashBitmap.hh>
+#include <splash/SplashPath.hh>
+#include <splash/SplashPattern.hh>
+#include <splash/SplashState.hh>
+#include <splash/SplashTypes.hh>
+
+BOOST_AUTO_TEST_SUITE(splash_thin_stroke)
+
+namespace {
+
+struct page_t
+{
+    page_t(int w, int h)
+        : bitmap(w, h, 1, splashModeMono8, false), splash(&bitmap, true)
+    {
+        SplashColor white = { 0xff };
+        SplashColor black = { 0x00 };
+
+        splash.clear(white);
+        splash.setFillPattern(new SplashSolidColor(black));
+        splash.setStrokePattern(new SplashSolidColor(black));
+    }
+
+    unsigned char at(int x, int y)
+    {
+        return bitmap.getDataPtr()[y * bitmap.getRowSize() + x];
+    }
+
+    //
+    // Area covered by the paint, in pixels:
+    //
+    double coverage()
+    {
+        double sum = 0;
+
+        for (int y = 0; y < bitmap.getHeight(); ++y) {
+            for (int x = 0; x < bitmap.getWidth(); ++x) {
+                sum += 0xff - at(x, y);
+            }
+        }
+
+        return sum / 0xff;
+    }
+
+    SplashBitmap bitmap;
+    Splash       splash;
+};
+
+//
+// A line of width w, from (x0, y0) to (x1, y1), with butt caps -- as
+// a stroke, and as the fill of its outline:
+//
+void stroke_line(page_t &page, double x0, double y0, double x1, double y1,
+                 double w)
+{
+    SplashPath path;
+
+    path.moveTo(x0, y0);
+    path.lineTo(x1, y1);
+
+    page.splash.setLineWidth(w);
+    page.splash.stroke(&path);
+}
+
+void fill_line(page_t &page, double x0, double y0, double x1, double y1,
+               double w)
+{
+    const double len = std::hypot(x1 - x0, y1 - y0);
+    const double nx = -(y1 - y0) / len * w / 2, ny = (x1 - x0) / len * w / 2;
+
+    SplashPath path;
+
+    path.moveTo(x0 + nx, y0 + ny);
+    path.lineTo(x1 + nx, y1 + ny);
+    path.lineTo(x1 - nx, y1 - ny);
+    path.lineTo(x0 - nx, y0 - ny);
+    path.close();
+
+    page.splash.fill(&path, false);
+}
+
+//
+// The largest difference between two pages, away from the given points:
+//
+int max_diff(page_t &a, page_t &b, std::initializer_list< double > ends)
+{
+    int result = 0;
+
+    for (int y = 0; y < a.bitmap.getHeight(); ++y) {
+        for (int x = 0; x < a.bitmap.getWidth(); ++x) {
+            bool near = false;
+
+            for (auto p = ends.begin(); p != ends.end(); p += 2) {
+                near |= std::hypot(x + 0.5 - p[0], y + 0.5 - p[1]) < 2.5;
+            }
+
+            if (!near) {
+                result = std::max(result, std::abs(a.at(x, y) - b.at(x, y)));
+            }
+        }
+    }
+
+    return result;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(line_vs_outline_)
+{
+    for (double angle : { 0., 7., 30., 45., 60., 90., 135., 200. }) {
+        for (double w : { 0.2, 0.5, 1.0, 1.8 }) {
+            const double a = angle * M_PI / 180;
+            const double x0 = 50.3 - 30 * cos(a), y0 = 49.6 - 30 * sin(a);
+            const double x1 = 50.3 + 30 * cos(a), y1 = 49.6 + 30 * sin(a);
+
+            page_t stroked(100, 100), filled(100, 100);
+
+            stroke_line(stroked, x0, y0, x1, y1, w);
+            fill_line(filled, x0, y0, x1, y1, w);
+
+            const double a0 = stroked.coverage(), a1 = filled.coverage();
+            BOOST_TEST(std::fabs(a0 - a1) <= 0.01 * a1 + 0.1);
+
+            //
+            // The strips are cut along the minor axis, not square to the
+            // line, so only the pixels at the ends may differ much:
+            //
+            BOOST_TEST(max_diff(stroked, filled, { x0, y0, x1, y1 }) <= 8);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(polyline_joins_)
+{
+    //
+    // A finely flattened arc, and the fill of its outline: the joints
+    // must not show as lighter (or darker) beads along the line.
+    //
+    for (double w : { 0.5, 1.0, 1.5 }) {
+        page_t stroked(100, 100), filled(100, 100);
+
+        SplashPath line, outline;
+
+        for (int i = 0; i <= 64; ++i) {
+            const double a = i * M_PI / 64, x = cos(a), y = sin(a);
+
+            if (i == 0) {
+                line.moveTo(50.3 + 40 * x, 50.6 + 40 * y);
+                outline.moveTo(50.3 + (40 + w / 2) * x, 50.6 + (40 + w / 2) * y);
+            } else {
+                line.lineTo(50.3 + 40 * x, 50.6 + 40 * y);
+                outline.lineTo(50.3 + (40 + w / 2) * x, 50.6 + (40 + w / 2) * y);
+            }
+        }
+
+        for (int i = 64; i >= 0; --i) {
+            const double a = i * M_PI / 64, x = cos(a), y = sin(a);
+            outline.lineTo(50.3 + (40 - w / 2) * x, 50.6 + (40 - w / 2) * y);
+        }
+
+        outline.close();
+
+        stroked.splash.setLineWidth(w);
+        stroked.splash.stroke(&line);
+        filled.splash.fill(&outline, false);
+
+        const double a0 = stroked.coverage(), a1 = filled.coverage();
+        BOOST_TEST(std::fabs(a0 - a1) <= 0.02 * a1);
+
+        BOOST_TEST(
+            max_diff(stroked, filled, { 90.3, 50.6, 10.3, 50.6 }) <= 48);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dash_)
+{
+    page_t page(100, 20);
+
+    SplashCoord dash[2] = { 4, 4 };
+    page.splash.setLineDash(dash, 2, 0);
+
+    stroke_line(page, 10, 10.5, 90, 10.5, 1);
+
+    //
+    // Ten dashes, 4 pixels each:
+    //
+    BOOST_TEST(std::fabs(page.coverage() - 40) <= 1);
+
+    for (int i = 0; i < 10; ++i) {
+        BOOST_TEST(page.at(12 + 8 * i, 10) == 0);
+        BOOST_TEST(page.at(16 + 8 * i, 10) == 0xff);
+    }
+
+    //
+    // Zero-length dashes with round caps are dots:
+    //
+    page_t dots(100, 20);
+
+    SplashCoord dotDash[2] = { 0, 10 };
+    dots.splash.setLineDash(dotDash, 2, 0);
+    dots.splash.setLineCap(splashLineCapRound);
+
+    stroke_line(dots, 10.5, 10.5, 90.5, 10.5, 1.5);
+
+    const double dot = M_PI * 0.75 * 0.75;
+    BOOST_TEST(dots.coverage() > 9 * dot);
+    BOOST_TEST(dots.coverage() < 9 * dot * 1.5);
+}
+
+BOOST_AUTO_TEST_CASE(stroke_adjust_)
+{
+    //
+    // Stroke adjusted horizontal and vertical lines cover whole pixels:
+    //
+    page_t page(40, 40);
+
+    page.splash.setStrokeAdjust(true);
+    stroke_line(page, 5.2, 10.3, 30.6, 10.3, 0.4);
+    stroke_line(page, 20.4, 15.1, 20.4, 35.7, 0.7);
+
+    for (int y = 0; y < 40; ++y) {
+        for (int x = 0; x < 40; ++x) {
+            const unsigned char c = page.at(x, y);
+            BOOST_TEST((c == 0 || c == 0xff));
+        }
+    }
+
+    BOOST_TEST(page.at(10, 10) == 0);
+    BOOST_TEST(page.at(20, 25) == 0);
+}
+
+//
+// Strokes a page of short thin lines, as in a CAD drawing -- run with
+// --run_test=splash_thin_stroke/benchmark_:
+//
+BOOST_AUTO_TEST_CASE(benchmark_, *utf::disabled())
+{
+    using clock_type = std::chrono::steady_clock;
+
+    page_t page(2550, 3300);
+
+    std::mt19937                             gen(0);
+    std::uniform_real_distribution< double > pos(0, 3300);
+    std::uniform_real_distribution< double > delta(-80, 80);
+    std::uniform_real_distribution< double > width(0.3, 2);
+
+    auto t0 = clock_type::now();
+
+    for (int i = 0; i < 100000; ++i) {
+        const double x = pos(gen), y = pos(gen);
+        stroke_line(page, x, y, x + delta(gen), y + delta(gen), width(gen));
+    }
+
+    auto t1 = clock_type::now();
+
+    std::cout << std::chrono::duration< double >(t1 - t0).count() << " s\n";
+}
+
+BOOST_AUTO_TEST_SUITE_END()
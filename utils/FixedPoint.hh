@@ -0,0 +1,72 @@
+// -*- mode: c++; -*-
+// Copyright 2004 Glyph & Cog, LLC
+
+#ifndef XPDF_UTILS_FIXEDPOINT_HH
+#define XPDF_UTILS_FIXEDPOINT_HH
+
+#include <defs.hh>
+
+#include <cmath>
+#include <cstdint>
+
+#include <type_traits>
+
+//------------------------------------------------------------------------
+// FixedPoint
+//------------------------------------------------------------------------
+
+// A 24.8 fixed point number, stored in 32 bits.  It holds device-space
+// coordinates: a value is rounded to the nearest 1/256 when it is
+// stored, and saturates to the representable range (about +/-8388608)
+// instead of wrapping around.  FixedPoint has no arithmetic of its own
+// -- it reads back as a double, so expressions are computed in double
+// precision and only narrowed when they are stored again.
+class FixedPoint
+{
+public:
+    static const int fixptShift = 8;
+    static const int fixptOne = 1 << fixptShift;
+
+    static const int32_t fixptMax = INT32_MAX;
+    static const int32_t fixptMin = -INT32_MAX;
+
+    FixedPoint() : val(0) { }
+
+    template< typename T, typename std::enable_if<
+                              std::is_arithmetic< T >::value, int >::type = 0 >
+    FixedPoint(T x) : val(fromDouble((double)x))
+    {
+    }
+
+    operator double() const { return val * (1.0 / fixptOne); }
+
+    // Raw access to the 24.8 value.
+    static FixedPoint fromRaw(int32_t x)
+    {
+        FixedPoint r;
+        r.val = x;
+        return r;
+    }
+
+    int32_t getRaw() const { return val; }
+
+private:
+    static int32_t fromDouble(double x)
+    {
+        x *= fixptOne;
+        if (x >= (double)fixptMax) {
+            return fixptMax;
+        }
+        if (x <= (double)fixptMin) {
+            return fixptMin;
+        }
+        if (x != x) { // NaN
+            return 0;
+        }
+        return (int32_t)lrint(x);
+    }
+
+    int32_t val;
+};
+
+#endif // XPDF_UTILS_FIXEDPOINT_HH
@@ -796,7 +796,7 @@ void AcroFormField::drawNewAppearance(Gfx *gfx, Dict *annot, double xMin,
 
     // build the font dictionary
     if (drObj.is_dict() && (obj1 = resolve(drObj.as_dict()["Font"])).is_dict()) {
-        fontDict = new GfxFontDict(acroForm->doc->getXRef(), 0, &obj1.as_dict());
+        fontDict = new GfxFontDict(acroForm->doc->getXRef(), 0, obj1);
     } else {
         fontDict = NULL;
     }
@@ -1040,6 +1040,41 @@ void Annots::generateAnnotAppearances()
     }
 }
 
+const xpdf::rect_index_t &Annots::getIndex()
+{
+    if (!index) {
+        std::vector< xpdf::bbox_t > boxes(nAnnots);
+
+        for (int i = 0; i < nAnnots; ++i) {
+            boxes[i] = { annots[i]->getXMin(), annots[i]->getYMin(),
+                         annots[i]->getXMax(), annots[i]->getYMax() };
+        }
+
+        index = std::make_unique< xpdf::rect_index_t >(std::move(boxes));
+    }
+
+    return *index;
+}
+
+Annot *Annots::find(double x, double y)
+{
+    // annotations are drawn in order, so the last one is on top
+    long i = getIndex().find_last(x, y);
+    return i < 0 ? NULL : annots[i];
+}
+
+std::vector< Annot * > Annots::findInRect(double xMin, double yMin, double xMax,
+                                          double yMax)
+{
+    std::vector< Annot * > result;
+
+    for (auto i : getIndex().find(xpdf::bbox_t{ xMin, yMin, xMax, yMax })) {
+        result.push_back(annots[i]);
+    }
+
+    return result;
+}
+
 Annot *Annots::findAnnot(Ref *ref)
 {
     int i;
@@ -6,7 +6,11 @@
 
 #include <defs.hh>
 
+#include <memory>
+#include <vector>
+
 #include <xpdf/obj_fwd.hh>
+#include <xpdf/rect_index.hh>
 #include <xpdf/XRef.hh>
 
 class Catalog;
@@ -145,6 +149,15 @@ public:
     int    getNumAnnots() { return nAnnots; }
     Annot *getAnnot(int i) { return annots[i]; }
 
+    // If point <x>,<y> is in an annotation rectangle, return the
+    // topmost such annotation; else return NULL.
+    Annot *find(double x, double y);
+
+    // Return the annotations whose rectangles intersect the rectangle
+    // <xMin>,<yMin>-<xMax>,<yMax>, in drawing order.
+    std::vector< Annot * > findInRect(double xMin, double yMin, double xMax,
+                                      double yMax);
+
     // Generate an appearance stream for any non-form-field annotation
     // that is missing it.
     void generateAnnotAppearances();
@@ -153,9 +166,14 @@ private:
     void scanFieldAppearances(Dict *node, Ref *ref, Dict *parent, Dict *acroForm);
     Annot *findAnnot(Ref *ref);
 
+    // Build the spatial index on first use.
+    const xpdf::rect_index_t &getIndex();
+
     PDFDoc *doc;
     Annot **annots;
     int     nAnnots;
+
+    std::unique_ptr< xpdf::rect_index_t > index; // annotation rectangles
 };
 
 #endif // XPDF_XPDF_ANNOT_HH
@@ -13,7 +13,7 @@ namespace xpdf {
 namespace detail {
 
 // clang-format off
-const std::pair< std::string_view, int > courier[] = {
+constexpr std::pair< std::string_view, int > courier[] = {
     { "Ntilde",         600 },
     { "rcaron",         600 },
     { "kcommaaccent",   600 },
@@ -331,7 +331,7 @@ const std::pair< std::string_view, int > courier[] = {
     { "onesuperior",    600 }
 };
 
-const std::pair< std::string_view, int > courier_bold[] = {
+constexpr std::pair< std::string_view, int > courier_bold[] = {
     { "Ntilde",         600 },
     { "rcaron",         600 },
     { "kcommaaccent",   600 },
@@ -649,7 +649,7 @@ const std::pair< std::string_view, int > courier_bold[] = {
     { "onesuperior",    600 }
 };
 
-const std::pair< std::string_view, int > courier_bold_oblique[] = {
+constexpr std::pair< std::string_view, int > courier_bold_oblique[] = {
     { "Ntilde",         600 },
     { "rcaron",         600 },
     { "kcommaaccent",   600 },
@@ -967,7 +967,7 @@ const std::pair< std::string_view, int > courier_bold_oblique[] = {
     { "onesuperior",    600 }
 };
 
-const std::pair< std::string_view, int > courier_oblique[] = {
+constexpr std::pair< std::string_view, int > courier_oblique[] = {
     { "Ntilde",         600 },
     { "rcaron",         600 },
     { "kcommaaccent",   600 },
@@ -1285,7 +1285,7 @@ const std::pair< std::string_view, int > courier_oblique[] = {
     { "onesuperior",    600 }
 };
 
-const std::pair< std::string_view, int > helvetica[]= {
+constexpr std::pair< std::string_view, int > helvetica[]= {
     {"Ntilde",          722 },
     { "rcaron",         333 },
     { "kcommaaccent",   500 },
@@ -1603,7 +1603,7 @@ const std::pair< std::string_view, int > helvetica[]= {
     { "onesuperior",    333 }
 };
 
-const std::pair< std::string_view, int > helvetica_bold[] = {
+constexpr std::pair< std::string_view, int > helvetica_bold[] = {
     { "Ntilde",          722 },
     { "rcaron",          389 },
     { "kcommaaccent",    556 },
@@ -1922,7 +1922,7 @@ const std::pair< std::string_view, int > helvetica_bold[] = {
     { "onesuperior",     333 }
 };
 
-const std::pair< std::string_view, int > helvetica_bold_oblique[] = {
+constexpr std::pair< std::string_view, int > helvetica_bold_oblique[] = {
     { "Ntilde",         722 },
     { "rcaron",         389 },
     { "kcommaaccent",   556 },
@@ -2240,7 +2240,7 @@ const std::pair< std::string_view, int > helvetica_bold_oblique[] = {
     { "onesuperior",    333 }
 };
 
-const std::pair< std::string_view, int > helvetica_oblique[] = {
+constexpr std::pair< std::string_view, int > helvetica_oblique[] = {
     { "Ntilde",         722 },
     { "rcaron",         333 },
     { "kcommaaccent",   500 },
@@ -2558,7 +2558,7 @@ const std::pair< std::string_view, int > helvetica_oblique[] = {
     { "onesuperior",    333 }
 };
 
-const std::pair< std::string_view, int > symbol[]= {
+constexpr std::pair< std::string_view, int > symbol[]= {
     {"bracketleftex",   384 },
     { "alpha",          631 },
     { "union",          768 },
@@ -2751,7 +2751,7 @@ const std::pair< std::string_view, int > symbol[]= {
     { "Beta",           667 }
 };
 
-const std::pair< std::string_view, int > times_bold[] = {
+constexpr std::pair< std::string_view, int > times_bold[] = {
     {"Ntilde",          722 },
     { "rcaron",         444 },
     { "kcommaaccent",   556 },
@@ -3069,7 +3069,7 @@ const std::pair< std::string_view, int > times_bold[] = {
     { "onesuperior",    300 }
 };
 
-const std::pair< std::string_view, int > times_bold_italic[] = {
+constexpr std::pair< std::string_view, int > times_bold_italic[] = {
     { "Ntilde",         722 },
     { "rcaron",         389 },
     { "kcommaaccent",   500 },
@@ -3387,7 +3387,7 @@ const std::pair< std::string_view, int > times_bold_italic[] = {
     { "onesuperior",    300 }
 };
 
-const std::pair< std::string_view, int > times_italic[] = {
+constexpr std::pair< std::string_view, int > times_italic[] = {
     { "Ntilde",         667 },
     { "rcaron",         389 },
     { "kcommaaccent",   444 },
@@ -3705,7 +3705,7 @@ const std::pair< std::string_view, int > times_italic[] = {
     { "onesuperior",    300 }
 };
 
-const std::pair< std::string_view, int > times_roman[] = {
+constexpr std::pair< std::string_view, int > times_roman[] = {
     { "Ntilde",         722 },
     { "rcaron",         333 },
     { "kcommaaccent",   500 },
@@ -4023,7 +4023,7 @@ const std::pair< std::string_view, int > times_roman[] = {
     { "onesuperior",    300 }
 };
 
-const std::pair< std::string_view, int > zapf_dingbats[] = {
+constexpr std::pair< std::string_view, int > zapf_dingbats[] = {
     { "a81",  438 }, { "a82",   138 }, { "a83",  277 },
     { "a84",  415 }, { "a85",   509 }, { "a86",  410 },
     { "a87",  234 }, { "a88",   234 }, { "a89",  390 },
@@ -4099,13 +4099,23 @@ inline constexpr auto sizeof_(const T (&)[N]) {
     return N;
 }
 
-template< typename T, size_t N >
-inline auto map_from(const T (&arr)[N]) {
-    return std::map< std::string_view, int >(arr, arr + N);
-}
+constexpr name_map_t courier_widths(courier);
+constexpr name_map_t courier_bold_widths(courier_bold);
+constexpr name_map_t courier_bold_oblique_widths(courier_bold_oblique);
+constexpr name_map_t courier_oblique_widths(courier_oblique);
+constexpr name_map_t helvetica_widths(helvetica);
+constexpr name_map_t helvetica_bold_widths(helvetica_bold);
+constexpr name_map_t helvetica_bold_oblique_widths(helvetica_bold_oblique);
+constexpr name_map_t helvetica_oblique_widths(helvetica_oblique);
+constexpr name_map_t symbol_widths(symbol);
+constexpr name_map_t times_bold_widths(times_bold);
+constexpr name_map_t times_bold_italic_widths(times_bold_italic);
+constexpr name_map_t times_italic_widths(times_italic);
+constexpr name_map_t times_roman_widths(times_roman);
+constexpr name_map_t zapf_dingbats_widths(zapf_dingbats);
 
 const builtin_font_t builtin_fonts[] = {
-#define MAP(xs) map_from(xs)
+#define MAP(xs) xs ## _widths
     {  "Courier",               { 0,  0, -1 },     standardEncoding, { 629,  -157, {  -23, -250,  715,  805 } }, MAP(courier)                },
     {  "Courier-Bold",          { 0,  1, -1 },     standardEncoding, { 629,  -157, { -113, -250,  749,  801 } }, MAP(courier_bold)           },
     {  "Courier-BoldOblique",   { 0,  2, -1 },     standardEncoding, { 629,  -157, {  -57, -250,  869,  801 } }, MAP(courier_bold_oblique)   },
@@ -7,11 +7,10 @@
 
 #include <defs.hh>
 
-#include <map>
 #include <string>
-#include <vector>
 
 #include <xpdf/bbox.hh>
+#include <xpdf/name_map.hh>
 #include <xpdf/obj.hh>
 
 namespace xpdf {
@@ -28,7 +27,7 @@ struct builtin_font_t
         bbox_t bbox;
     } metric;
 
-    std::map< std::string_view, int > widths;
+    name_map_view_t< int > widths;
 };
 
 const builtin_font_t *builtin_font(const char *);
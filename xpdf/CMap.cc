@@ -8,6 +8,12 @@
 #include <cstring>
 #include <cctype>
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <string>
+
 #include <utils/path.hh>
 #include <utils/string.hh>
 
@@ -21,16 +27,36 @@
 
 //------------------------------------------------------------------------
 
+// A CMap is a trie of 256-entry vectors, one level per code byte.  An
+// entry holds either a CID or, with cMapVectorFlag set, the index of
+// the vector for the next byte.  All of the vectors live in one array,
+// which is also the layout of a binary CMap file, so those can be used
+// straight from a memory mapping.
+#define cMapVectorFlag 0x80000000
+
 struct CMapVectorEntry
 {
-    bool isVector;
-    union
-    {
-        CMapVectorEntry *vector;
-        CID              cid;
-    };
+    unsigned val;
+
+    bool     isVector() const { return val & cMapVectorFlag; }
+    unsigned getVector() const { return val & ~cMapVectorFlag; }
+};
+
+// Header of a binary CMap file.  It is followed by <nVectors> * 256
+// CMapVectorEntry values; a vector entry always refers to a vector
+// after its own, so the trie has no cycles.
+struct CMapBinaryHeader
+{
+    char     magic[4]; // "XCM1"
+    unsigned byteOrder; // cMapBinaryByteOrder, in native byte order
+    unsigned wMode;
+    unsigned isIdent;
+    unsigned nVectors;
 };
 
+static const char cMapBinaryMagic[4] = { 'X', 'C', 'M', '1' };
+#define cMapBinaryByteOrder 0x01020304
+
 //------------------------------------------------------------------------
 
 static int getCharFromFile(void *data)
@@ -114,6 +140,91 @@ CMap *CMap::parse(CMapCache *cache, GString *collectionA, Stream *str)
     return cMap;
 }
 
+CMap *CMap::parseBinary(GString *collectionA, GString *cMapNameA)
+{
+    GString *               fileName;
+    FILE *                  f;
+    struct stat             st;
+    void *                  mapA;
+    size_t                  mapLenA, n, i;
+    const CMapBinaryHeader *hdr;
+    const CMapVectorEntry * vec;
+    CMap *                  cMap;
+
+    fileName = cMapNameA->copy();
+    fileName->append(".bin");
+    f = globalParams->findCMapFile(collectionA, fileName);
+    delete fileName;
+    if (!f) {
+        return NULL;
+    }
+    mapA = MAP_FAILED;
+    mapLenA = 0;
+    if (fstat(fileno(f), &st) == 0 && S_ISREG(st.st_mode) &&
+        (size_t)st.st_size >= sizeof(CMapBinaryHeader)) {
+        mapLenA = (size_t)st.st_size;
+        mapA = mmap(NULL, mapLenA, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+    }
+    fclose(f);
+    if (mapA == MAP_FAILED) {
+        error(errIO, -1, "Couldn't map binary CMap file for '{0:t}'", cMapNameA);
+        return NULL;
+    }
+
+    // check the header, and that the vector entries stay in bounds
+    hdr = (const CMapBinaryHeader *)mapA;
+    vec = (const CMapVectorEntry *)(hdr + 1);
+    n = hdr->nVectors;
+    if (memcmp(hdr->magic, cMapBinaryMagic, 4) ||
+        hdr->byteOrder != cMapBinaryByteOrder || hdr->wMode > 1 ||
+        n > (mapLenA - sizeof(CMapBinaryHeader)) / (256 * sizeof(*vec)) ||
+        mapLenA != sizeof(CMapBinaryHeader) + n * 256 * sizeof(*vec)) {
+        goto err;
+    }
+    for (i = 0; i < n * 256; ++i) {
+        if (vec[i].isVector() &&
+            (vec[i].getVector() <= i / 256 || vec[i].getVector() >= n)) {
+            goto err;
+        }
+    }
+
+    cMap = new CMap(collectionA->copy(), cMapNameA->copy(), (int)hdr->wMode);
+    cMap->isIdent = hdr->isIdent != 0;
+    cMap->vector = n ? vec : NULL;
+    cMap->nVectors = (int)n;
+    cMap->map = mapA;
+    cMap->mapLen = mapLenA;
+    return cMap;
+
+err:
+    error(errConfig, -1, "Invalid binary CMap file for '{0:t}'", cMapNameA);
+    munmap(mapA, mapLenA);
+    return NULL;
+}
+
+bool CMap::writeBinary(const char *fileName)
+{
+    CMapBinaryHeader hdr;
+    FILE *           f;
+    bool             ok;
+
+    memcpy(hdr.magic, cMapBinaryMagic, 4);
+    hdr.byteOrder = cMapBinaryByteOrder;
+    hdr.wMode = (unsigned)wMode;
+    hdr.isIdent = isIdent ? 1 : 0;
+    hdr.nVectors = (unsigned)nVectors;
+    if (!(f = fopen(fileName, "wb"))) {
+        return false;
+    }
+    ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1 &&
+         (nVectors == 0 || fwrite(vector, 256 * sizeof(CMapVectorEntry),
+                                  nVectors, f) == (size_t)nVectors);
+    if (fclose(f)) {
+        ok = false;
+    }
+    return ok;
+}
+
 void CMap::parse2(CMapCache *cache, int (*getCharFunc)(void *), void *data)
 {
     PSTokenizer *pst;
@@ -191,17 +302,14 @@ void CMap::parse2(CMapCache *cache, int (*getCharFunc)(void *), void *data)
 
 CMap::CMap(GString *collectionA, GString *cMapNameA)
 {
-    int i;
-
     collection = collectionA;
     cMapName = cMapNameA;
     isIdent = false;
     wMode = 0;
-    vector = (CMapVectorEntry *)calloc(256, sizeof(CMapVectorEntry));
-    for (i = 0; i < 256; ++i) {
-        vector[i].isVector = false;
-        vector[i].cid = 0;
-    }
+    nVectors = 0;
+    newVector();
+    map = NULL;
+    mapLen = 0;
     refCnt = 1;
 }
 
@@ -212,6 +320,9 @@ CMap::CMap(GString *collectionA, GString *cMapNameA, int wModeA)
     isIdent = true;
     wMode = wModeA;
     vector = NULL;
+    nVectors = 0;
+    map = NULL;
+    mapLen = 0;
     refCnt = 1;
 }
 
@@ -236,7 +347,7 @@ void CMap::useCMap(CMapCache *cache, char *useName)
     }
     isIdent = subCMap->isIdent;
     if (subCMap->vector) {
-        copyVector(vector, subCMap->vector);
+        copyVector(0, subCMap->vector, 0);
     }
     subCMap->decRefCnt();
 }
@@ -251,32 +362,39 @@ void CMap::useCMap(CMapCache *cache, Object *obj)
     }
     isIdent = subCMap->isIdent;
     if (subCMap->vector) {
-        copyVector(vector, subCMap->vector);
+        copyVector(0, subCMap->vector, 0);
     }
     subCMap->decRefCnt();
 }
 
-void CMap::copyVector(CMapVectorEntry *dest, CMapVectorEntry *src)
+// Append a vector of (CID 0) entries, and return its index.
+unsigned CMap::newVector()
+{
+    vectors.resize(vectors.size() + 256, CMapVectorEntry{ 0 });
+    vector = vectors.data();
+    return (unsigned)nVectors++;
+}
+
+void CMap::copyVector(unsigned dest, const CMapVectorEntry *srcVector,
+                      unsigned src)
 {
-    int i, j;
+    const CMapVectorEntry *srcVec;
+    unsigned               i, j;
 
+    srcVec = srcVector + 256 * (size_t)src;
     for (i = 0; i < 256; ++i) {
-        if (src[i].isVector) {
-            if (!dest[i].isVector) {
-                dest[i].isVector = true;
-                dest[i].vector =
-                    (CMapVectorEntry *)calloc(256, sizeof(CMapVectorEntry));
-                for (j = 0; j < 256; ++j) {
-                    dest[i].vector[j].isVector = false;
-                    dest[i].vector[j].cid = 0;
-                }
+        if (srcVec[i].isVector()) {
+            if (!vectors[256 * (size_t)dest + i].isVector()) {
+                j = newVector();
+                vectors[256 * (size_t)dest + i].val = cMapVectorFlag | j;
             }
-            copyVector(dest[i].vector, src[i].vector);
+            copyVector(vectors[256 * (size_t)dest + i].getVector(), srcVector,
+                       srcVec[i].getVector());
         } else {
-            if (dest[i].isVector) {
+            if (vectors[256 * (size_t)dest + i].isVector()) {
                 error(errSyntaxError, -1, "Collision in usecmap");
             } else {
-                dest[i].cid = src[i].cid;
+                vectors[256 * (size_t)dest + i].val = srcVec[i].val;
             }
         }
     }
@@ -284,35 +402,32 @@ void CMap::copyVector(CMapVectorEntry *dest, CMapVectorEntry *src)
 
 void CMap::addCIDs(unsigned start, unsigned end, unsigned nBytes, CID firstCID)
 {
-    CMapVectorEntry *vec;
+    CMapVectorEntry *entry;
+    unsigned         vec;
     int              byte, byte0, byte1;
     unsigned         start1, end1, i, j, k;
 
     start1 = start & 0xffffff00;
     end1 = end & 0xffffff00;
     for (i = start1; i <= end1; i += 0x100) {
-        vec = vector;
+        vec = 0;
         for (j = nBytes - 1; j >= 1; --j) {
             byte = (i >> (8 * j)) & 0xff;
-            if (!vec[byte].isVector) {
-                vec[byte].isVector = true;
-                vec[byte].vector =
-                    (CMapVectorEntry *)calloc(256, sizeof(CMapVectorEntry));
-                for (k = 0; k < 256; ++k) {
-                    vec[byte].vector[k].isVector = false;
-                    vec[byte].vector[k].cid = 0;
-                }
+            if (!vectors[256 * (size_t)vec + byte].isVector()) {
+                k = newVector();
+                vectors[256 * (size_t)vec + byte].val = cMapVectorFlag | k;
             }
-            vec = vec[byte].vector;
+            vec = vectors[256 * (size_t)vec + byte].getVector();
         }
         byte0 = (i < start) ? (start & 0xff) : 0;
         byte1 = (i + 0xff > end) ? (end & 0xff) : 0xff;
         for (byte = byte0; byte <= byte1; ++byte) {
-            if (vec[byte].isVector) {
+            entry = &vectors[256 * (size_t)vec + byte];
+            if (entry->isVector()) {
                 error(errSyntaxError, -1,
                       "Invalid CID ({0:x} [{1:d} bytes]) in CMap", i, nBytes);
             } else {
-                vec[byte].cid = firstCID + ((i + byte) - start);
+                entry->val = (firstCID + ((i + byte) - start)) & ~cMapVectorFlag;
             }
         }
     }
@@ -324,21 +439,9 @@ CMap::~CMap()
     if (cMapName) {
         delete cMapName;
     }
-    if (vector) {
-        freeCMapVector(vector);
-    }
-}
-
-void CMap::freeCMapVector(CMapVectorEntry *vec)
-{
-    int i;
-
-    for (i = 0; i < 256; ++i) {
-        if (vec[i].isVector) {
-            freeCMapVector(vec[i].vector);
-        }
+    if (map) {
+        munmap(map, mapLen);
     }
-    free(vec);
 }
 
 void CMap::incRefCnt()
@@ -364,9 +467,9 @@ bool CMap::match(GString *collectionA, GString *cMapNameA)
 
 CID CMap::getCID(const char *s, int len, CharCode *c, int *nUsed)
 {
-    CMapVectorEntry *vec;
-    CharCode         cc;
-    int              n, i;
+    const CMapVectorEntry *vec;
+    CharCode               cc;
+    int                    n, i;
 
     vec = vector;
     cc = 0;
@@ -374,12 +477,12 @@ CID CMap::getCID(const char *s, int len, CharCode *c, int *nUsed)
     while (vec && n < len) {
         i = s[n++] & 0xff;
         cc = (cc << 8) | i;
-        if (!vec[i].isVector) {
+        if (!vec[i].isVector()) {
             *c = cc;
             *nUsed = n;
-            return vec[i].cid;
+            return vec[i].val;
         }
-        vec = vec[i].vector;
+        vec = vector + 256 * (size_t)vec[i].getVector();
     }
     if (isIdent && len >= 2) {
         // identity CMap
@@ -394,56 +497,54 @@ CID CMap::getCID(const char *s, int len, CharCode *c, int *nUsed)
 
 //------------------------------------------------------------------------
 
-CMapCache::CMapCache()
-{
-    int i;
+CMapCache::CMapCache() { }
 
-    for (i = 0; i < cMapCacheSize; ++i) {
-        cache[i] = NULL;
+CMapCache::~CMapCache()
+{
+    for (CMap *cMap : cMaps) {
+        cMap->decRefCnt();
     }
 }
 
-CMapCache::~CMapCache()
+static std::string cMapKey(GString *collection, GString *cMapName)
 {
-    int i;
+    std::string key(*collection);
 
-    for (i = 0; i < cMapCacheSize; ++i) {
-        if (cache[i]) {
-            cache[i]->decRefCnt();
-        }
-    }
+    key += '\0';
+    key += *cMapName;
+    return key;
 }
 
 CMap *CMapCache::getCMap(GString *collection, GString *cMapName)
 {
-    CMap *cmap;
-    int   i, j;
+    CMap * cMap;
+    size_t maxSize;
+
+    std::string key = cMapKey(collection, cMapName);
+    auto        iter = index.find(key);
+    if (iter != index.end()) {
+        cMaps.splice(cMaps.begin(), cMaps, iter->second);
+        cMap = cMaps.front();
+        cMap->incRefCnt();
+        return cMap;
+    }
 
-    if (cache[0] && cache[0]->match(collection, cMapName)) {
-        cache[0]->incRefCnt();
-        return cache[0];
+    if (!(cMap = CMap::parseBinary(collection, cMapName)) &&
+        !(cMap = CMap::parse(this, collection, cMapName))) {
+        return NULL;
     }
-    for (i = 1; i < cMapCacheSize; ++i) {
-        if (cache[i] && cache[i]->match(collection, cMapName)) {
-            cmap = cache[i];
-            for (j = i; j >= 1; --j) {
-                cache[j] = cache[j - 1];
-            }
-            cache[0] = cmap;
-            cmap->incRefCnt();
-            return cmap;
-        }
+    maxSize = (size_t)std::max(globalParams->getCMapCacheSize(), 0);
+    if (maxSize == 0) {
+        return cMap;
     }
-    if ((cmap = CMap::parse(this, collection, cMapName))) {
-        if (cache[cMapCacheSize - 1]) {
-            cache[cMapCacheSize - 1]->decRefCnt();
-        }
-        for (j = cMapCacheSize - 1; j >= 1; --j) {
-            cache[j] = cache[j - 1];
-        }
-        cache[0] = cmap;
-        cmap->incRefCnt();
-        return cmap;
+    while (cMaps.size() >= maxSize) {
+        index.erase(cMapKey(cMaps.back()->getCollection(),
+                            cMaps.back()->getCMapName()));
+        cMaps.back()->decRefCnt();
+        cMaps.pop_back();
     }
-    return NULL;
+    cMaps.push_front(cMap);
+    index[key] = cMaps.begin();
+    cMap->incRefCnt();
+    return cMap;
 }
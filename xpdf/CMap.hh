@@ -6,6 +6,11 @@
 
 #include <defs.hh>
 
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <xpdf/CharTypes.hh>
 #include <xpdf/obj_fwd.hh>
 
@@ -31,6 +36,16 @@ public:
     // Returns NULL on failure.
     static CMap *parse(CMapCache *cache, GString *collectionA, Stream *str);
 
+    // Map the precompiled (binary) form of the CMap specified by
+    // <collection> and <cMapName>, i.e., the file <cMapName>.bin in the
+    // CMap directories.  Sets the initial reference count to 1.
+    // Returns NULL if there is no such file, or if it is invalid.
+    static CMap *parseBinary(GString *collectionA, GString *cMapNameA);
+
+    // Write the precompiled form of this CMap to <fileName>.  Returns
+    // false on failure.
+    bool writeBinary(const char *fileName);
+
     ~CMap();
 
     void incRefCnt();
@@ -39,6 +54,9 @@ public:
     // Return collection name (<registry>-<ordering>).
     GString *getCollection() { return collection; }
 
+    // Return the CMap name (NULL for a CMap read from a stream).
+    GString *getCMapName() { return cMapName; }
+
     // Return true if this CMap matches the specified <collectionA>, and
     // <cMapNameA>.
     bool match(GString *collectionA, GString *cMapNameA);
@@ -57,24 +75,28 @@ private:
     CMap(GString *collectionA, GString *cMapNameA, int wModeA);
     void useCMap(CMapCache *cache, char *useName);
     void useCMap(CMapCache *cache, Object *obj);
-    void copyVector(CMapVectorEntry *dest, CMapVectorEntry *src);
+    unsigned newVector();
+    void     copyVector(unsigned dest, const CMapVectorEntry *srcVector,
+                        unsigned src);
     void addCIDs(unsigned start, unsigned end, unsigned nBytes, CID firstCID);
-    void freeCMapVector(CMapVectorEntry *vec);
 
     GString *collection;
     GString *cMapName;
     bool     isIdent; // true if this CMap is an identity mapping,
         //   or is based on one (via usecmap)
-    int              wMode; // writing mode (0=horizontal, 1=vertical)
-    CMapVectorEntry *vector; // vector for first byte (NULL for
-        //   identity CMap)
-    int refCnt;
+    int wMode; // writing mode (0=horizontal, 1=vertical)
+    std::vector< CMapVectorEntry > vectors; // 256-entry vectors, one
+        //   per code prefix; the first one is for the first byte
+    const CMapVectorEntry *vector; // vector for first byte (NULL for
+        //   identity CMap), in <vectors> or in <map>
+    int    nVectors; // number of 256-entry vectors
+    void * map; // memory-mapped binary CMap file, or NULL
+    size_t mapLen;
+    int    refCnt;
 };
 
 //------------------------------------------------------------------------
 
-#define cMapCacheSize 4
-
 class CMapCache
 {
 public:
@@ -84,11 +106,13 @@ public:
     // Get the <cMapName> CMap for the specified character collection.
     // Increments its reference count; there will be one reference for
     // the cache plus one for the caller of this function.  Returns NULL
-    // on failure.
+    // on failure.  The cache holds up to GlobalParams::getCMapCacheSize()
+    // CMaps, and drops the least recently used one first.
     CMap *getCMap(GString *collection, GString *cMapName);
 
 private:
-    CMap *cache[cMapCacheSize];
+    std::list< CMap * > cMaps; // MRU first
+    std::unordered_map< std::string, std::list< CMap * >::iterator > index;
 };
 
 #endif // XPDF_XPDF_CMAP_HH
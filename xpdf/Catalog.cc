@@ -35,7 +35,7 @@ public:
     ~PageTreeNode();
 
     Ref           ref;
-    int           count;
+    int           count; // number of pages, or -1 if not read yet
     PageTreeNode *parent;
     GList *       kids; // [PageTreeNode]
     PageAttrs *   attrs;
@@ -102,6 +102,7 @@ Catalog::Catalog(PDFDoc *docA)
     baseURI = NULL;
     form = NULL;
     embeddedFiles = NULL;
+    embeddedFilesRead = false;
 
     xref->getCatalog(&catDict);
     if (!catDict.is_dict()) {
@@ -157,7 +158,7 @@ Catalog::Catalog(PDFDoc *docA)
     structTreeRoot = resolve(catDict.as_dict()["StructTreeRoot"]);
 
     // get the outline dictionary
-    outline = resolve(catDict.as_dict()["Outlines"]);
+    outline = catDict.as_dict()["Outlines"];
 
     // get the AcroForm dictionary
     acroForm = resolve(catDict.as_dict()["AcroForm"]);
@@ -169,9 +170,6 @@ Catalog::Catalog(PDFDoc *docA)
     // get the OCProperties dictionary
     ocProperties = resolve(catDict.as_dict()["OCProperties"]);
 
-    // get the list of embedded files
-    readEmbeddedFileList(&catDict.as_dict());
-
     return;
 
 err1:
@@ -217,8 +215,8 @@ Page *Catalog::getPage(int i)
 
 Ref *Catalog::getPageRef(int i)
 {
-    if (!pages[i - 1]) {
-        loadPage(i);
+    if (pageRefs[i - 1].num < 0) {
+        loadPage2(i, i - 1, pageTree, false);
     }
     return &pageRefs[i - 1];
 }
@@ -231,6 +229,14 @@ void Catalog::doneWithPage(int i)
     }
 }
 
+Object *Catalog::getOutline()
+{
+    if (outline.is_ref()) {
+        outline = resolve(outline);
+    }
+    return &outline;
+}
+
 GString *Catalog::readMetadata()
 {
     GString *s;
@@ -258,15 +264,108 @@ GString *Catalog::readMetadata()
 
 int Catalog::findPage(int num, int gen)
 {
-    int i;
+    Object pageObj;
+    Ref    ref;
+    int    pg, i;
+
+    ref.xref = NULL;
+    ref.num = num;
+    ref.gen = gen;
+
+    auto iter = pageIndex.find(ref);
+    if (iter != pageIndex.end()) {
+        return iter->second;
+    }
+
+    // only a leaf (Page) node can be a page
+    if (!(pageObj = xref->fetch(ref)).is_dict() ||
+        resolve(pageObj.as_dict()["Kids"]).is_array()) {
+        return 0;
+    }
+
+    // compute the page number from the /Parent chain, then check it
+    // against the page tree
+    if ((pg = locatePage(ref)) > 0) {
+        if (pageRefs[pg - 1].num < 0) {
+            loadPage2(pg, pg - 1, pageTree, false);
+        }
+        if (pageRefs[pg - 1] == ref) {
+            return pg;
+        }
+    }
 
+    // the /Parent links or /Count values are broken -- fall back to
+    // walking the page tree, which records every leaf it sees
     for (i = 0; i < numPages; ++i) {
-        if (!pages[i]) {
-            loadPage(i + 1);
+        if (pageRefs[i].num < 0) {
+            loadPage2(i + 1, i, pageTree, false);
+        }
+        if ((iter = pageIndex.find(ref)) != pageIndex.end()) {
+            return iter->second;
+        }
+    }
+    return 0;
+}
+
+// Compute the page number of a Page object by walking up its /Parent
+// chain, adding up the /Count values of the preceding siblings at
+// each level.  Returns 0 if the chain does not lead to the root of
+// the page tree.
+int Catalog::locatePage(const Ref &ref)
+{
+    Object nodeObj, parentRefObj, parentObj, kidsObj, kidRefObj, kidObj,
+        countObj;
+    Ref  nodeRef;
+    int  relPg, depth, i;
+    bool found;
+
+    nodeRef = ref;
+    relPg = 0;
+
+    // bound the walk, in case of a loop in the /Parent chain
+    for (depth = 0; depth < 256; ++depth) {
+        if (nodeRef == pageTree->ref) {
+            return relPg < numPages ? relPg + 1 : 0;
+        }
+
+        if (!(nodeObj = xref->fetch(nodeRef)).is_dict()) {
+            return 0;
+        }
+        if (!(parentRefObj = nodeObj.as_dict()["Parent"]).is_ref()) {
+            return 0;
+        }
+        if (!(parentObj = resolve(parentRefObj)).is_dict()) {
+            return 0;
+        }
+        if (!(kidsObj = resolve(parentObj.as_dict()["Kids"])).is_array()) {
+            return 0;
+        }
+
+        // count the kids the same way loadPage2 does
+        found = false;
+        for (i = 0; i < kidsObj.as_array().size(); ++i) {
+            if (!(kidRefObj = kidsObj[i]).is_ref()) {
+                continue;
+            }
+            if (kidRefObj.as_ref() == nodeRef) {
+                found = true;
+                break;
+            }
+            if ((kidObj = resolve(kidRefObj)).is_dict()) {
+                if ((countObj = resolve(kidObj.as_dict()["Count"])).is_int()) {
+                    relPg += countObj.as_int();
+                } else {
+                    relPg += 1;
+                }
+            }
         }
-        if (pageRefs[i].num == num && pageRefs[i].gen == gen)
-            return i + 1;
+        if (!found) {
+            return 0;
+        }
+
+        nodeRef = parentRefObj.as_ref();
     }
+
     return 0;
 }
 
@@ -433,19 +532,24 @@ int Catalog::countPageTree(Object *pagesObj)
 
 void Catalog::loadPage(int pg)
 {
-    loadPage2(pg, pg - 1, pageTree);
+    loadPage2(pg, pg - 1, pageTree, true);
 }
 
-void Catalog::loadPage2(int pg, int relPg, PageTreeNode *node)
+// Descend the page tree to page <pg>, reading any internal nodes on
+// the way, and record its object ID.  If <makePage> is set, also
+// create the Page object.
+void Catalog::loadPage2(int pg, int relPg, PageTreeNode *node, bool makePage)
 {
-    Object        pageObj, kidsObj, kidRefObj, kidObj, countObj;
+    Object        pageObj, kidsObj, kidRefObj;
     PageTreeNode *kidNode, *p;
     PageAttrs *   attrs;
-    int           count, i;
+    int           start, i;
 
     if (relPg >= node->count) {
         error(errSyntaxError, -1, "Internal error in page tree");
-        pages[pg - 1] = new Page(doc, pg);
+        if (makePage) {
+            pages[pg - 1] = new Page(doc, pg);
+        }
         return;
     }
 
@@ -456,7 +560,9 @@ void Catalog::loadPage2(int pg, int relPg, PageTreeNode *node)
         for (p = node->parent; p; p = p->parent) {
             if (node->ref.num == p->ref.num && node->ref.gen == p->ref.gen) {
                 error(errSyntaxError, -1, "Loop in Pages tree");
-                pages[pg - 1] = new Page(doc, pg);
+                if (makePage) {
+                    pages[pg - 1] = new Page(doc, pg);
+                }
                 return;
             }
         }
@@ -467,40 +573,29 @@ void Catalog::loadPage2(int pg, int relPg, PageTreeNode *node)
         if (!pageObj.is_dict()) {
             error(errSyntaxError, -1, "Page tree object is wrong type ({0:s})",
                   pageObj.getTypeName());
-            pages[pg - 1] = new Page(doc, pg);
+            if (makePage) {
+                pages[pg - 1] = new Page(doc, pg);
+            }
             return;
         }
 
-        // merge the PageAttrs
-        attrs =
-            new PageAttrs(node->parent ? node->parent->attrs : (PageAttrs *)NULL,
-                          &pageObj.as_dict());
-
         // if "Kids" exists, it's an internal node
         if ((kidsObj = resolve(pageObj.as_dict()["Kids"])).is_array()) {
-            // save the PageAttrs
-            node->attrs = attrs;
-
-            // read the kids
+            // merge and save the PageAttrs
+            node->attrs = new PageAttrs(
+                node->parent ? node->parent->attrs : (PageAttrs *)NULL,
+                &pageObj.as_dict());
+
+            // list the kids -- each one is only read (for its page
+            // count) when the descent below gets to it, so loading a
+            // page reads none of the kids that follow its path
             node->kids = new GList();
             for (i = 0; i < kidsObj.as_array().size(); ++i) {
                 kidRefObj = kidsObj[i];
 
                 if (kidRefObj.is_ref()) {
-                    if ((kidObj = resolve(kidRefObj)).is_dict()) {
-                        if ((countObj = resolve(kidObj.as_dict()["Count"]))
-                                .is_int()) {
-                            count = countObj.as_int();
-                        } else {
-                            count = 1;
-                        }
-                        node->kids->append(
-                            new PageTreeNode(kidRefObj.as_ref(), count, node));
-                    } else {
-                        error(errSyntaxError, -1,
-                              "Page tree object is wrong type ({0:s})",
-                              kidObj.getTypeName());
-                    }
+                    node->kids->append(
+                        new PageTreeNode(kidRefObj.as_ref(), -1, node));
                 } else {
                     error(errSyntaxError, -1,
                           "Page tree reference is wrong type ({0:s})",
@@ -508,42 +603,87 @@ void Catalog::loadPage2(int pg, int relPg, PageTreeNode *node)
                 }
             }
         } else {
-            // create the Page object
             pageRefs[pg - 1] = node->ref;
-            pages[pg - 1] = new Page(doc, pg, &pageObj.as_dict(), attrs);
-            if (!pages[pg - 1]->isOk()) {
-                delete pages[pg - 1];
-                pages[pg - 1] = new Page(doc, pg);
+            pageIndex[node->ref] = pg;
+
+            // create the Page object
+            if (makePage) {
+                attrs = new PageAttrs(node->parent ? node->parent->attrs :
+                                                     (PageAttrs *)NULL,
+                                      &pageObj.as_dict());
+                pages[pg - 1] = new Page(doc, pg, &pageObj.as_dict(), attrs);
+                if (!pages[pg - 1]->isOk()) {
+                    delete pages[pg - 1];
+                    pages[pg - 1] = new Page(doc, pg);
+                }
             }
         }
     }
 
     // recursively descend the tree
     if (node->kids) {
+        start = pg - relPg;
         for (i = 0; i < node->kids->getLength(); ++i) {
             kidNode = (PageTreeNode *)node->kids->get(i);
+            if (kidNode->count < 0) {
+                readPageTreeKid(kidNode, start);
+            }
             if (relPg < kidNode->count) {
-                loadPage2(pg, relPg, kidNode);
+                loadPage2(pg, relPg, kidNode, makePage);
                 break;
             }
             relPg -= kidNode->count;
+            start += kidNode->count;
         }
 
         // this will only happen if the page tree is invalid
         // (i.e., parent count > sum of children counts)
         if (i == node->kids->getLength()) {
             error(errSyntaxError, -1, "Invalid page count in page tree");
-            pages[pg - 1] = new Page(doc, pg);
+            if (makePage) {
+                pages[pg - 1] = new Page(doc, pg);
+            }
         }
     }
 }
 
-void Catalog::readEmbeddedFileList(Dict *catDict)
+// Read the page count of a kid in the page tree, whose first page is
+// page number <start>.  If the kid is a leaf, record its page number --
+// this lets findPage skip most of the tree walks.
+void Catalog::readPageTreeKid(PageTreeNode *kidNode, int start)
 {
-    Object obj1, obj2;
+    Object kidObj, countObj;
+
+    if (!(kidObj = xref->fetch(kidNode->ref)).is_dict()) {
+        error(errSyntaxError, -1, "Page tree object is wrong type ({0:s})",
+              kidObj.getTypeName());
+        kidNode->count = 0;
+        return;
+    }
+    if ((countObj = resolve(kidObj.as_dict()["Count"])).is_int()) {
+        // (a negative count would read as "not read yet")
+        kidNode->count = countObj.as_int() < 0 ? 0 : countObj.as_int();
+    } else {
+        kidNode->count = 1;
+    }
+    if (!kidObj.as_dict().has_key("Kids") && start <= numPages) {
+        pageIndex.emplace(kidNode->ref, start);
+    }
+}
+
+void Catalog::readEmbeddedFileList()
+{
+    Object catDict, obj1, obj2;
+
+    embeddedFilesRead = true;
+
+    xref->getCatalog(&catDict);
+    if (!catDict.is_dict()) {
+        return;
+    }
 
     // read the embedded file name tree
-    if ((obj1 = resolve((*catDict)["Names"])).is_dict()) {
+    if ((obj1 = resolve(catDict.as_dict()["Names"])).is_dict()) {
         if ((obj2 = resolve(obj1.as_dict()["EmbeddedFiles"])).is_dict()) {
             readEmbeddedFileTree(&obj2);
         }
@@ -551,7 +691,7 @@ void Catalog::readEmbeddedFileList(Dict *catDict)
 
     // look for file attachment annotations
     auto touchedObjs = std::vector< char >(size_t(xref->getNumObjects()), 0);
-    readFileAttachmentAnnots((*catDict)["Pages"], touchedObjs.data());
+    readFileAttachmentAnnots(catDict.as_dict()["Pages"], touchedObjs.data());
 }
 
 void Catalog::readEmbeddedFileTree(Object *node)
@@ -663,6 +803,9 @@ void Catalog::readEmbeddedFile(const Object &fileSpec, const Object &name1)
 
 int Catalog::getNumEmbeddedFiles()
 {
+    if (!embeddedFilesRead) {
+        readEmbeddedFileList();
+    }
     return embeddedFiles ? embeddedFiles->getLength() : 0;
 }
 
@@ -6,6 +6,8 @@
 
 #include <defs.hh>
 
+#include <unordered_map>
+
 #include <xpdf/CharTypes.hh>
 #include <xpdf/obj.hh>
 
@@ -58,7 +60,8 @@ public:
     Object *getStructTreeRoot() { return &structTreeRoot; }
 
     // Find a page, given its object ID.  Returns page number, or 0 if
-    // not found.
+    // not found.  Only walks the page tree nodes on the path to the
+    // page, without loading any Page objects.
     int findPage(int num, int gen);
 
     // Find a named destination.  Returns the link destination, or
@@ -69,7 +72,10 @@ public:
 
     Object *getNameTree() { return &nameTree; }
 
-    Object *getOutline() { return &outline; }
+    // Return the outline dictionary.  It is fetched on first use, as
+    // it is often not among the first-page objects of a linearized
+    // file.
+    Object *getOutline();
 
     Object *getAcroForm() { return &acroForm; }
 
@@ -91,24 +97,32 @@ private:
     Page **       pages; // array of pages
     Ref *         pageRefs; // object ID for each page
     int           numPages; // number of pages
+    std::unordered_map< Ref, int, xpdf::ref_hash_t >
+        pageIndex; // page number for each page object ID
+        //   seen so far while walking the page tree
     Object        dests; // named destination dictionary
     Object        nameTree; // name tree
     GString *     baseURI; // base URI for URI-type links
     Object        metadata; // metadata stream
     Object        structTreeRoot; // structure tree root dictionary
-    Object        outline; // outline dictionary
+    Object        outline; // outline dictionary, or a reference to
+        //   it until getOutline is called
     Object        acroForm; // AcroForm dictionary
     Form *        form; // parsed form
     Object        ocProperties; // OCProperties dictionary
     GList *       embeddedFiles; // embedded file list [EmbeddedFile]
+    bool          embeddedFilesRead; // true once embeddedFiles has
+        //   been filled in (this walks the whole page tree)
     bool          ok; // true if catalog is valid
 
     Object *findDestInTree(Object *tree, GString *name, Object *obj);
     bool    readPageTree(Object *catDict);
     int     countPageTree(Object *pagesObj);
     void    loadPage(int pg);
-    void    loadPage2(int pg, int relPg, PageTreeNode *node);
-    void    readEmbeddedFileList(Dict *catDict);
+    void    loadPage2(int pg, int relPg, PageTreeNode *node, bool makePage);
+    void    readPageTreeKid(PageTreeNode *kidNode, int start);
+    int     locatePage(const Ref &ref);
+    void    readEmbeddedFileList();
     void    readEmbeddedFileTree(Object *node);
     void readFileAttachmentAnnots(const Object &pageNodeRef, char *touchedObjs);
     void readEmbeddedFile(const Object &fileSpec, const Object &name1);
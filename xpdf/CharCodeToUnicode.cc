@@ -6,6 +6,9 @@
 #include <cstdio>
 #include <cstring>
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #include <fstream>
 #include <vector>
 
@@ -29,6 +32,18 @@ struct CharCodeToUnicodeString
     int      len;
 };
 
+// Header of a binary CID-to-Unicode file.  It is followed by <mapLen>
+// Unicode values.
+struct CIDToUnicodeBinaryHeader
+{
+    char     magic[4]; // "XCU1"
+    unsigned byteOrder; // cidToUnicodeBinaryByteOrder, in native order
+    unsigned mapLen;
+};
+
+static const char cidToUnicodeBinaryMagic[4] = { 'X', 'C', 'U', '1' };
+#define cidToUnicodeBinaryByteOrder 0x01020304
+
 //------------------------------------------------------------------------
 
 static int getCharFromString(void *data)
@@ -117,6 +132,84 @@ CharCodeToUnicode *CharCodeToUnicode::parseCIDToUnicode(GString *fileName,
         collection->copy(), mapA.data(), mapA.size(), true, 0, 0, 0);
 }
 
+CharCodeToUnicode *
+CharCodeToUnicode::parseBinaryCIDToUnicode(GString *fileName,
+                                           GString *collection)
+{
+    GString *                       binFileName;
+    FILE *                          f;
+    struct stat                     st;
+    void *                          mapA;
+    size_t                          mapLenA;
+    const CIDToUnicodeBinaryHeader *hdr;
+    CharCodeToUnicode *             ctu;
+
+    binFileName = fileName->copy();
+    binFileName->append(".bin");
+    f = fopen(binFileName->c_str(), "rb");
+    delete binFileName;
+    if (!f) {
+        return NULL;
+    }
+    mapA = MAP_FAILED;
+    mapLenA = 0;
+    if (fstat(fileno(f), &st) == 0 && S_ISREG(st.st_mode) &&
+        (size_t)st.st_size >= sizeof(CIDToUnicodeBinaryHeader)) {
+        mapLenA = (size_t)st.st_size;
+        // the mapping is private and writable: setMapping() may patch
+        // the (shared) map, and those pages are then copied on write
+        mapA = mmap(NULL, mapLenA, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                    fileno(f), 0);
+    }
+    fclose(f);
+    if (mapA == MAP_FAILED) {
+        error(errIO, -1, "Couldn't map binary cidToUnicode file for '{0:t}'",
+              fileName);
+        return NULL;
+    }
+
+    hdr = (const CIDToUnicodeBinaryHeader *)mapA;
+    if (memcmp(hdr->magic, cidToUnicodeBinaryMagic, 4) ||
+        hdr->byteOrder != cidToUnicodeBinaryByteOrder ||
+        hdr->mapLen > (mapLenA - sizeof(*hdr)) / sizeof(Unicode) ||
+        mapLenA != sizeof(*hdr) + hdr->mapLen * sizeof(Unicode)) {
+        error(errConfig, -1, "Invalid binary cidToUnicode file for '{0:t}'",
+              fileName);
+        munmap(mapA, mapLenA);
+        return NULL;
+    }
+
+    ctu = new CharCodeToUnicode(collection->copy(), (Unicode *)(hdr + 1),
+                                hdr->mapLen, false, NULL, 0, 0);
+    ctu->mapFile = mapA;
+    ctu->mapFileLen = mapLenA;
+    return ctu;
+}
+
+bool CharCodeToUnicode::writeBinary(const char *fileName)
+{
+    CIDToUnicodeBinaryHeader hdr;
+    FILE *                   f;
+    bool                     ok;
+
+    // multi-char mappings aren't part of the binary format
+    if (!map || sMapLen > 0) {
+        return false;
+    }
+    memcpy(hdr.magic, cidToUnicodeBinaryMagic, 4);
+    hdr.byteOrder = cidToUnicodeBinaryByteOrder;
+    hdr.mapLen = mapLen;
+    if (!(f = fopen(fileName, "wb"))) {
+        return false;
+    }
+    ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1 &&
+         fwrite(map, sizeof(Unicode), mapLen, f) == mapLen;
+    if (fclose(f)) {
+        ok = false;
+    }
+    return ok;
+}
+
 CharCodeToUnicode *CharCodeToUnicode::parseUnicodeToUnicode(GString *fileName)
 {
     Unicode *                mapA;
@@ -420,6 +513,8 @@ CharCodeToUnicode::CharCodeToUnicode()
     mapLen = 0;
     sMap = NULL;
     sMapLen = sMapSize = 0;
+    mapFile = NULL;
+    mapFileLen = 0;
     refCnt = 1;
 }
 
@@ -435,6 +530,8 @@ CharCodeToUnicode::CharCodeToUnicode(GString *tagA)
     }
     sMap = NULL;
     sMapLen = sMapSize = 0;
+    mapFile = NULL;
+    mapFileLen = 0;
     refCnt = 1;
 }
 
@@ -454,6 +551,8 @@ CharCodeToUnicode::CharCodeToUnicode(GString *tagA, Unicode *mapA,
     sMap = sMapA;
     sMapLen = sMapLenA;
     sMapSize = sMapSizeA;
+    mapFile = NULL;
+    mapFileLen = 0;
     refCnt = 1;
 }
 
@@ -462,7 +561,11 @@ CharCodeToUnicode::~CharCodeToUnicode()
     if (tag) {
         delete tag;
     }
-    free(map);
+    if (mapFile) {
+        munmap(mapFile, mapFileLen);
+    } else {
+        free(map);
+    }
     free(sMap);
 }
 
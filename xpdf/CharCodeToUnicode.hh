@@ -24,6 +24,18 @@ public:
     static CharCodeToUnicode *parseCIDToUnicode(GString *fileName,
                                                 GString *collection);
 
+    // Map the precompiled (binary) form of the CID-to-Unicode file
+    // <fileName>, i.e., the file <fileName>.bin.  Sets the initial
+    // reference count to 1.  Returns NULL if there is no such file, or
+    // if it is invalid.
+    static CharCodeToUnicode *parseBinaryCIDToUnicode(GString *fileName,
+                                                      GString *collection);
+
+    // Write the precompiled form of this (CID-to-Unicode) mapping to
+    // <fileName>.  Returns false on failure, or if the mapping can't be
+    // stored that way.
+    bool writeBinary(const char *fileName);
+
     // Create a Unicode-to-Unicode mapping from the file specified by
     // <fileName>.  Sets the initial reference count to 1.  Returns NULL
     // on failure.
@@ -75,6 +87,9 @@ private:
     CharCode                 mapLen;
     CharCodeToUnicodeString *sMap;
     int                      sMapLen, sMapSize;
+    void *                   mapFile; // memory-mapped binary file holding
+        //   <map>, or NULL
+    size_t                   mapFileLen;
     int                      refCnt;
 };
 
@@ -4,8 +4,9 @@
 #include <defs.hh>
 #include <cstdlib>
 #include <xpdf/FontEncodingTables.hh>
+#include <xpdf/name_map.hh>
 
-const char *macRomanEncoding[256] = { NULL,
+constexpr const char *macRomanEncoding[256] = { NULL,
                                       NULL,
                                       NULL,
                                       NULL,
@@ -262,6 +263,17 @@ const char *macRomanEncoding[256] = { NULL,
                                       "ogonek",
                                       "caron" };
 
+// MacRomanEncoding, reversed; of duplicate names ('space' is encoded
+// twice) the lowest code is kept
+static constexpr xpdf::name_map_t< CharCode, 256 >
+    macRomanReverseMap(macRomanEncoding);
+
+CharCode macRomanCharCode(const char *name)
+{
+    const CharCode *p = macRomanReverseMap.find(name);
+    return p ? *p : 0;
+}
+
 const char *macExpertEncoding[256] = { NULL,
                                        NULL,
                                        NULL,
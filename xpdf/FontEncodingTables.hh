@@ -4,7 +4,9 @@
 #ifndef XPDF_XPDF_FONTENCODINGTABLES_HH
 #define XPDF_XPDF_FONTENCODINGTABLES_HH
 
-extern const char *macRomanEncoding[];
+#include <xpdf/CharTypes.hh>
+
+extern const char *const macRomanEncoding[];
 extern const char *macExpertEncoding[];
 extern const char *winAnsiEncoding[];
 extern const char *standardEncoding[];
@@ -12,4 +14,7 @@ extern const char *expertEncoding[];
 extern const char *symbolEncoding[];
 extern const char *zapfDingbatsEncoding[];
 
+// Return the lowest MacRomanEncoding code for a char name, or 0.
+CharCode macRomanCharCode(const char *name);
+
 #endif // XPDF_XPDF_FONTENCODINGTABLES_HH
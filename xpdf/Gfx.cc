@@ -229,23 +229,24 @@ using namespace ranges;
 // GfxResources
 //------------------------------------------------------------------------
 
-GfxResources::GfxResources(XRef *xref, Dict *resDict, GfxResources *nextA)
+GfxResources::GfxResources(XRef *xref, GfxFontCache *fontCache, Dict *resDict,
+                           GfxResources *nextA)
 {
     Object obj1, obj2;
     Ref    r;
 
     if (resDict) {
-        // build font dictionary
+        // build font dictionary (the fonts are made on first use)
         fonts = NULL;
         obj1 = (*resDict)["Font"];
         if (obj1.is_ref()) {
             obj2 = resolve(obj1);
             if (obj2.is_dict()) {
                 r = obj1.as_ref();
-                fonts = new GfxFontDict(xref, &r, &obj2.as_dict());
+                fonts = new GfxFontDict(xref, &r, obj2, fontCache);
             }
         } else if (obj1.is_dict()) {
-            fonts = new GfxFontDict(xref, NULL, &obj1.as_dict());
+            fonts = new GfxFontDict(xref, NULL, obj1, fontCache);
         }
 
         // get XObject dictionary
@@ -380,17 +381,49 @@ void GfxResources::lookupColorSpace(const char *name, Object *obj)
     *obj = {};
 }
 
-GfxPattern *GfxResources::lookupPattern(const char *name)
+std::shared_ptr< GfxColorSpace > GfxResources::lookupColorSpace(const char *name)
+{
+    GfxResources *resPtr;
+    Object        obj;
+
+    if (!strcmp(name, "DeviceGray") || !strcmp(name, "DeviceRGB") ||
+        !strcmp(name, "DeviceCMYK")) {
+        return NULL;
+    }
+    for (resPtr = this; resPtr; resPtr = resPtr->next) {
+        if (resPtr->colorSpaceDict.is_dict()) {
+            auto iter = resPtr->colorSpaces.find(name);
+            if (iter != resPtr->colorSpaces.end()) {
+                return iter->second;
+            }
+            if (!(obj = resolve(resPtr->colorSpaceDict.as_dict()[name]))
+                     .is_null()) {
+                std::shared_ptr< GfxColorSpace > colorSpace(
+                    GfxColorSpace::parse(&obj));
+                resPtr->colorSpaces[name] = colorSpace;
+                return colorSpace;
+            }
+        }
+    }
+    return NULL;
+}
+
+std::shared_ptr< GfxPattern > GfxResources::lookupPattern(const char *name)
 {
     GfxResources *resPtr;
-    GfxPattern *  pattern;
     Object        objRef, obj;
 
     for (resPtr = this; resPtr; resPtr = resPtr->next) {
         if (resPtr->patternDict.is_dict()) {
+            auto iter = resPtr->patterns.find(name);
+            if (iter != resPtr->patterns.end()) {
+                return iter->second;
+            }
             if (!(obj = resolve(resPtr->patternDict.as_dict()[name])).is_null()) {
                 objRef = resPtr->patternDict.as_dict()[name];
-                pattern = GfxPattern::parse(&objRef, &obj);
+                std::shared_ptr< GfxPattern > pattern(
+                    GfxPattern::parse(&objRef, &obj));
+                resPtr->patterns[name] = pattern;
                 return pattern;
             }
         }
@@ -399,16 +432,20 @@ GfxPattern *GfxResources::lookupPattern(const char *name)
     return NULL;
 }
 
-GfxShading *GfxResources::lookupShading(const char *name)
+std::shared_ptr< GfxShading > GfxResources::lookupShading(const char *name)
 {
     GfxResources *resPtr;
-    GfxShading *  shading;
     Object        obj;
 
     for (resPtr = this; resPtr; resPtr = resPtr->next) {
         if (resPtr->shadingDict.is_dict()) {
+            auto iter = resPtr->shadings.find(name);
+            if (iter != resPtr->shadings.end()) {
+                return iter->second;
+            }
             if (!(obj = resolve(resPtr->shadingDict.as_dict()[name])).is_null()) {
-                shading = GfxShading::parse(&obj);
+                std::shared_ptr< GfxShading > shading(GfxShading::parse(&obj));
+                resPtr->shadings[name] = shading;
                 return shading;
             }
         }
@@ -472,7 +509,7 @@ Gfx::Gfx(PDFDoc *docA, OutputDev *outA, int pageNum, Dict *resDict, double hDPI,
     printCommands = globalParams->getPrintCommands();
 
     // start the resource stack
-    res = new GfxResources(xref, resDict, NULL);
+    res = new GfxResources(xref, doc->getFontCache(), resDict, NULL);
 
     // initialize
     out = outA;
@@ -519,7 +556,7 @@ Gfx::Gfx(PDFDoc *docA, OutputDev *outA, Dict *resDict, PDFRectangle *box,
     printCommands = globalParams->getPrintCommands();
 
     // start the resource stack
-    res = new GfxResources(xref, resDict, NULL);
+    res = new GfxResources(xref, doc->getFontCache(), resDict, NULL);
 
     // initialize
     out = outA;
@@ -1307,16 +1344,12 @@ void Gfx::opSetStrokeRGBColor(Object args[], int numArgs)
 
 void Gfx::opSetFillColorSpace(Object args[], int numArgs)
 {
-    Object         obj;
-    GfxColorSpace *colorSpace;
-    GfxColor       color;
+    std::shared_ptr< GfxColorSpace > colorSpace;
+    GfxColor                         color;
 
     state->setFillPattern(NULL);
-    res->lookupColorSpace(args[0].as_name(), &obj);
-    if (obj.is_null()) {
-        colorSpace = GfxColorSpace::parse(&args[0]);
-    } else {
-        colorSpace = GfxColorSpace::parse(&obj);
+    if (!(colorSpace = res->lookupColorSpace(args[0].as_name()))) {
+        colorSpace.reset(GfxColorSpace::parse(&args[0]));
     }
     if (colorSpace) {
         state->setFillColorSpace(colorSpace);
@@ -1331,16 +1364,12 @@ void Gfx::opSetFillColorSpace(Object args[], int numArgs)
 
 void Gfx::opSetStrokeColorSpace(Object args[], int numArgs)
 {
-    Object         obj;
-    GfxColorSpace *colorSpace;
-    GfxColor       color;
+    std::shared_ptr< GfxColorSpace > colorSpace;
+    GfxColor                         color;
 
     state->setStrokePattern(NULL);
-    res->lookupColorSpace(args[0].as_name(), &obj);
-    if (obj.is_null()) {
-        colorSpace = GfxColorSpace::parse(&args[0]);
-    } else {
-        colorSpace = GfxColorSpace::parse(&obj);
+    if (!(colorSpace = res->lookupColorSpace(args[0].as_name()))) {
+        colorSpace.reset(GfxColorSpace::parse(&args[0]));
     }
     if (colorSpace) {
         state->setStrokeColorSpace(colorSpace);
@@ -1391,9 +1420,9 @@ void Gfx::opSetStrokeColor(Object args[], int numArgs)
 
 void Gfx::opSetFillColorN(Object args[], int numArgs)
 {
-    GfxColor    color;
-    GfxPattern *pattern;
-    int         i;
+    GfxColor                      color;
+    std::shared_ptr< GfxPattern > pattern;
+    int                           i;
 
     if (state->getFillColorSpace()->getMode() == csPattern) {
         if (numArgs > 1) {
@@ -1437,9 +1466,9 @@ void Gfx::opSetFillColorN(Object args[], int numArgs)
 
 void Gfx::opSetStrokeColorN(Object args[], int numArgs)
 {
-    GfxColor    color;
-    GfxPattern *pattern;
-    int         i;
+    GfxColor                      color;
+    std::shared_ptr< GfxPattern > pattern;
+    int                           i;
 
     if (state->getStrokeColorSpace()->getMode() == csPattern) {
         if (numArgs > 1) {
@@ -2188,9 +2217,9 @@ void Gfx::doShadingPatternFill(GfxShadingPattern *sPat, bool stroke, bool eoFill
 
 void Gfx::opShFill(Object args[], int numArgs)
 {
-    GfxShading *shading;
-    GfxState *  savedState;
-    double      xMin, yMin, xMax, yMax;
+    std::shared_ptr< GfxShading > shading;
+    GfxState *                    savedState;
+    double                        xMin, yMin, xMax, yMax;
 
     if (!out->needNonText()) {
         return;
@@ -2231,21 +2260,21 @@ void Gfx::opShFill(Object args[], int numArgs)
     // do shading type-specific operations
     switch (shading->getType()) {
     case 1:
-        doFunctionShFill((GfxFunctionShading *)shading);
+        doFunctionShFill((GfxFunctionShading *)shading.get());
         break;
     case 2:
-        doAxialShFill((GfxAxialShading *)shading);
+        doAxialShFill((GfxAxialShading *)shading.get());
         break;
     case 3:
-        doRadialShFill((GfxRadialShading *)shading);
+        doRadialShFill((GfxRadialShading *)shading.get());
         break;
     case 4:
     case 5:
-        doGouraudTriangleShFill((GfxGouraudTriangleShading *)shading);
+        doGouraudTriangleShFill((GfxGouraudTriangleShading *)shading.get());
         break;
     case 6:
     case 7:
-        doPatchMeshShFill((GfxPatchMeshShading *)shading);
+        doPatchMeshShFill((GfxPatchMeshShading *)shading.get());
         break;
     }
 
@@ -2255,8 +2284,6 @@ void Gfx::opShFill(Object args[], int numArgs)
 
     // restore graphics state
     restoreStateStack(savedState);
-
-    delete shading;
 }
 
 void Gfx::doFunctionShFill(GfxFunctionShading *shading)
@@ -4747,7 +4774,7 @@ void Gfx::restoreStateStack(GfxState *oldState)
 
 void Gfx::pushResources(Dict *resDict)
 {
-    res = new GfxResources(xref, resDict, res);
+    res = new GfxResources(xref, doc->getFontCache(), resDict, res);
 }
 
 void Gfx::popResources()
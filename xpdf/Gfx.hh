@@ -6,6 +6,9 @@
 
 #include <defs.hh>
 
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <utils/path.hh>
@@ -20,6 +23,7 @@ class Gfx;
 class GfxAxialShading;
 class GfxColorSpace;
 class GfxFont;
+class GfxFontCache;
 class GfxFontDict;
 class GfxFunctionShading;
 class GfxGouraudTriangleShading;
@@ -51,7 +55,8 @@ enum GfxClipType { clipNone, clipNormal, clipEO };
 class GfxResources
 {
 public:
-    GfxResources(XRef *xref, Dict *resDict, GfxResources *nextA);
+    GfxResources(XRef *xref, GfxFontCache *fontCache, Dict *resDict,
+                 GfxResources *nextA);
     ~GfxResources();
 
     GfxFont *   lookupFont(const char *name);
@@ -59,11 +64,17 @@ public:
     bool        lookupXObject(const char *name, Object *obj);
     bool        lookupXObjectNF(const char *name, Object *obj);
     void        lookupColorSpace(const char *name, Object *obj);
-    GfxPattern *lookupPattern(const char *name);
-    GfxShading *lookupShading(const char *name);
     bool        lookupGState(const char *name, Object *obj);
     bool        lookupPropertiesNF(const char *name, Object *obj);
 
+    // Parsed color spaces, patterns and shadings are cached in the
+    // resource dict that defines them, and shared with the caller.  The
+    // color space lookup returns NULL, without an error, for a name that
+    // is not in any of the resource dicts.
+    std::shared_ptr< GfxColorSpace > lookupColorSpace(const char *name);
+    std::shared_ptr< GfxPattern >    lookupPattern(const char *name);
+    std::shared_ptr< GfxShading >    lookupShading(const char *name);
+
     GfxResources *getNext() { return next; }
 
 private:
@@ -75,6 +86,11 @@ private:
     Object        gStateDict;
     Object        propsDict;
     GfxResources *next;
+
+    std::unordered_map< std::string, std::shared_ptr< GfxColorSpace > >
+        colorSpaces;
+    std::unordered_map< std::string, std::shared_ptr< GfxPattern > > patterns;
+    std::unordered_map< std::string, std::shared_ptr< GfxShading > > shadings;
 };
 
 //------------------------------------------------------------------------
@@ -216,6 +216,11 @@ GfxFont::~GfxFont()
     }
 }
 
+size_t GfxFont::getMemSize()
+{
+    return sizeof(GfxFont);
+}
+
 // This function extracts three pieces of information:
 // 1. the "expected" font type, i.e., the font type implied by
 //    Font.Subtype, DescendantFont.Subtype, and
@@ -837,7 +842,7 @@ Gfx8BitFont::Gfx8BitFont(XRef *xref, const char *tagA, Ref idA, GString *nameA,
     : GfxFont(tagA, idA, nameA, typeA, embFontIDA)
 {
     GString *          name2;
-    const char **      baseEnc;
+    const char *const *baseEnc;
     bool               baseEncFromFontFile;
     char *             buf;
     int                len;
@@ -1257,19 +1262,15 @@ Gfx8BitFont::Gfx8BitFont(XRef *xref, const char *tagA, Ref idA, GString *nameA,
         // This is a kludge for broken PDF files that encode character 32
         // as .notdef:
         //
-        try {
-            auto width = builtin_font->widths.at("space");
-            widths[32] = 0.001 * width;
-        } catch(...) { }
+        if (auto width = builtin_font->widths.find("space"))
+            widths[32] = 0.001 * *width;
 
         for (code = 0; code < 256; ++code) {
             if (0 == enc[code])
                 continue;
 
-            try {
-                auto width = builtin_font->widths.at(enc[code]);
-                widths[code] = 0.001 * width;
-            } catch(...) { }
+            if (auto width = builtin_font->widths.find(enc[code]))
+                widths[code] = 0.001 * *width;
         }
     } else {
         //
@@ -1298,19 +1299,15 @@ Gfx8BitFont::Gfx8BitFont(XRef *xref, const char *tagA, Ref idA, GString *nameA,
         // This is a kludge for broken PDF files that encode char 32
         // as .notdef:
         //
-        try {
-            auto width = builtin_font->widths.at("space");
-            widths[32] = 0.001 * width;
-        } catch(...) { }
+        if (auto width = builtin_font->widths.find("space"))
+            widths[32] = 0.001 * *width;
 
         for (code = 0; code < 256; ++code) {
             if (0 == enc[code])
                 continue;
 
-            try {
-                auto width = builtin_font->widths.at(enc[code]);
-                widths[code] = 0.001 * width;
-            } catch(...) { }
+            if (auto width = builtin_font->widths.find(enc[code]))
+                widths[code] = 0.001 * *width;
         }
     }
 
@@ -1329,6 +1326,20 @@ Gfx8BitFont::~Gfx8BitFont()
     ctu->decRefCnt();
 }
 
+size_t Gfx8BitFont::getMemSize()
+{
+    size_t n;
+    int    i;
+
+    n = sizeof(Gfx8BitFont);
+    for (i = 0; i < 256; ++i) {
+        if (encFree[i] && enc[i]) {
+            n += strlen(enc[i]) + 1;
+        }
+    }
+    return n;
+}
+
 int Gfx8BitFont::getNextChar(const char *s, int len, CharCode *code, Unicode *u,
                              int uSize, int *uLen, double *dx, double *dy,
                              double *ox, double *oy)
@@ -1916,6 +1927,14 @@ int GfxCIDFont::getWMode()
     return cMap ? cMap->getWMode() : 0;
 }
 
+size_t GfxCIDFont::getMemSize()
+{
+    return sizeof(GfxCIDFont) +
+           widths.nExceps * sizeof(GfxFontCIDWidthExcep) +
+           widths.nExcepsV * sizeof(GfxFontCIDWidthExcepV) +
+           cidToGIDLen * sizeof(int);
+}
+
 CharCodeToUnicode *GfxCIDFont::getToUnicode()
 {
     if (ctu) {
@@ -1933,63 +1952,83 @@ GString *GfxCIDFont::getCollection()
 // GfxFontDict
 //------------------------------------------------------------------------
 
-GfxFontDict::GfxFontDict(XRef *xref, Ref *fontDictRef, Dict *fontDict)
+GfxFontDict::GfxFontDict(XRef *xrefA, Ref *fontDictRef, const Object &fontDictA,
+                         GfxFontCache *fontCacheA)
 {
-    int    i;
-    Object obj2;
-    Ref    r;
-
-    numFonts = fontDict->size();
-    fonts = (GfxFont **)calloc(numFonts, sizeof(GfxFont *));
-    for (i = 0; i < numFonts; ++i) {
-        auto &obj1 = fontDict->val_at(i);
-        obj2 = resolve(obj1);
-        if (obj2.is_dict()) {
-            if (obj1.is_ref()) {
-                r = obj1.as_ref();
+    Dict *dict;
+    Ref   r;
+    int   i, n;
+
+    xref = xrefA;
+    fontDict = fontDictA;
+    fontCache = fontCacheA;
+
+    dict = &fontDict.as_dict();
+    n = dict->size();
+    ids.resize(n);
+    cacheable.resize(n);
+    fonts.resize(n);
+    made.resize(n);
+    for (i = 0; i < n; ++i) {
+        auto &obj1 = dict->val_at(i);
+        if (obj1.is_ref()) {
+            r = obj1.as_ref();
+            cacheable[i] = true;
+        } else {
+            // no indirect reference for this font, so invent a unique one
+            // (legal generation numbers are five digits, so any 6-digit
+            // number would be safe)
+            r.num = i;
+            if (fontDictRef) {
+                r.gen = 100000 + fontDictRef->num;
+                cacheable[i] = true;
             } else {
-                // no indirect reference for this font, so invent a unique one
-                // (legal generation numbers are five digits, so any 6-digit
-                // number would be safe)
-                r.num = i;
-                if (fontDictRef) {
-                    r.gen = 100000 + fontDictRef->num;
-                } else {
-                    r.gen = 999999;
-                }
-            }
-            fonts[i] = GfxFont::makeFont(xref, fontDict->key_at(i).c_str(), r,
-                                         &obj2.as_dict());
-            if (fonts[i] && !fonts[i]->isOk()) {
-                delete fonts[i];
-                fonts[i] = NULL;
+                r.gen = 999999;
+                cacheable[i] = false;
             }
-        } else {
-            error(errSyntaxError, -1, "font resource is not a dictionary");
-            fonts[i] = NULL;
         }
+        ids[i] = r;
     }
 }
 
-GfxFontDict::~GfxFontDict()
+// Get font <i>, making it on first use.
+GfxFont *GfxFontDict::getFont(int i)
 {
-    int i;
+    Dict * dict;
+    Object obj2;
 
-    for (i = 0; i < numFonts; ++i) {
-        if (fonts[i]) {
-            delete fonts[i];
+    if (made[i]) {
+        return fonts[i].get();
+    }
+    made[i] = true;
+    dict = &fontDict.as_dict();
+    obj2 = resolve(dict->val_at(i));
+    if (!obj2.is_dict()) {
+        error(errSyntaxError, -1, "font resource is not a dictionary");
+        return NULL;
+    }
+    if (fontCache && cacheable[i]) {
+        fonts[i] = fontCache->getFont(ids[i], dict->key_at(i).c_str(),
+                                      &obj2.as_dict());
+    } else {
+        fonts[i].reset(GfxFont::makeFont(xref, dict->key_at(i).c_str(), ids[i],
+                                         &obj2.as_dict()));
+        if (fonts[i] && !fonts[i]->isOk()) {
+            fonts[i].reset();
         }
     }
-    free(fonts);
+    return fonts[i].get();
 }
 
 GfxFont *GfxFontDict::lookup(const char *tag)
 {
-    int i;
+    Dict *dict;
+    int   i;
 
-    for (i = 0; i < numFonts; ++i) {
-        if (fonts[i] && fonts[i]->matches(tag)) {
-            return fonts[i];
+    dict = &fontDict.as_dict();
+    for (i = 0; i < (int)fonts.size(); ++i) {
+        if (dict->key_at(i) == tag) {
+            return getFont(i);
         }
     }
     return NULL;
@@ -1999,11 +2038,57 @@ GfxFont *GfxFontDict::lookupByRef(Ref ref)
 {
     int i;
 
-    for (i = 0; i < numFonts; ++i) {
-        if (fonts[i] && fonts[i]->getID()->num == ref.num &&
-            fonts[i]->getID()->gen == ref.gen) {
-            return fonts[i];
+    for (i = 0; i < (int)fonts.size(); ++i) {
+        if (ids[i].num == ref.num && ids[i].gen == ref.gen) {
+            return getFont(i);
         }
     }
     return NULL;
 }
+
+//------------------------------------------------------------------------
+// GfxFontCache
+//------------------------------------------------------------------------
+
+GfxFontCache::GfxFontCache(XRef *xrefA, size_t maxSizeA)
+{
+    xref = xrefA;
+    size = 0;
+    maxSize = maxSizeA;
+}
+
+std::shared_ptr< GfxFont > GfxFontCache::getFont(Ref id, const char *tag,
+                                                 Dict *fontDictA)
+{
+    std::shared_ptr< GfxFont > font;
+    size_t                     n;
+
+    auto iter = index.find(id);
+    if (iter != index.end()) {
+        fonts.splice(fonts.begin(), fonts, iter->second);
+        return fonts.front();
+    }
+
+    font.reset(GfxFont::makeFont(xref, tag, id, fontDictA));
+    if (!font || !font->isOk()) {
+        return NULL;
+    }
+
+    n = font->getMemSize();
+    while (!fonts.empty() && size + n > maxSize) {
+        size -= fonts.back()->getMemSize();
+        index.erase(*fonts.back()->getID());
+        fonts.pop_back();
+    }
+    size += n;
+    fonts.push_front(font);
+    index[id] = fonts.begin();
+    return font;
+}
+
+void GfxFontCache::clear()
+{
+    fonts.clear();
+    index.clear();
+    size = 0;
+}
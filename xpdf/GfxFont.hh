@@ -6,6 +6,11 @@
 
 #include <defs.hh>
 
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 #include <utils/string.hh>
 #include <xpdf/obj.hh>
 #include <xpdf/CharTypes.hh>
@@ -198,6 +203,9 @@ public:
                             int uSize, int *uLen, double *dx, double *dy,
                             double *ox, double *oy) = 0;
 
+    // Get the (approximate) memory used by this font, in bytes.
+    virtual size_t getMemSize();
+
 protected:
     static GfxFontType getFontType(XRef *xref, Dict *fontDict, Ref *embID);
     void               readFontDescriptor(XRef *xref, Dict *fontDict);
@@ -237,6 +245,8 @@ public:
                             int uSize, int *uLen, double *dx, double *dy,
                             double *ox, double *oy);
 
+    virtual size_t getMemSize();
+
     // Return the encoding.
     char **getEncoding() { return enc; }
 
@@ -304,6 +314,8 @@ public:
     // Return the writing mode (0=horizontal, 1=vertical).
     virtual int getWMode();
 
+    virtual size_t getMemSize();
+
     // Return the Unicode map.
     CharCodeToUnicode *getToUnicode();
 
@@ -331,26 +343,66 @@ private:
 // GfxFontDict
 //------------------------------------------------------------------------
 
+class GfxFontCache;
+
 class GfxFontDict
 {
 public:
-    // Build the font dictionary, given the PDF font dictionary.
-    GfxFontDict(XRef *xref, Ref *fontDictRef, Dict *fontDict);
-
-    // Destructor.
-    ~GfxFontDict();
+    // Build the font dictionary, given the PDF font dictionary object.
+    // The fonts are made on first use -- or taken from <fontCacheA>, if
+    // it is non-NULL.
+    GfxFontDict(XRef *xrefA, Ref *fontDictRef, const Object &fontDictA,
+                GfxFontCache *fontCacheA = NULL);
 
     // Get the specified font.
     GfxFont *lookup(const char *tag);
     GfxFont *lookupByRef(Ref ref);
 
     // Iterative access.
-    int      getNumFonts() { return numFonts; }
-    GfxFont *getFont(int i) { return fonts[i]; }
+    int      getNumFonts() { return (int)fonts.size(); }
+    GfxFont *getFont(int i);
+
+private:
+    XRef *        xref;
+    Object        fontDict; // the PDF font dictionary
+    GfxFontCache *fontCache; // document font cache, or NULL
+    std::vector< Ref > ids; // font IDs (invented ones for direct
+                            //   font dictionaries)
+    std::vector< bool > cacheable; // set if ids[i] is unique in the doc
+    std::vector< std::shared_ptr< GfxFont > > fonts; // list of fonts
+    std::vector< bool > made; // set once fonts[i] has been made
+};
+
+//------------------------------------------------------------------------
+// GfxFontCache
+//------------------------------------------------------------------------
+
+// The fonts of a document, shared by all pages and Gfx objects, and
+// indexed by font ID.  The least recently used fonts are dropped once
+// their total size exceeds the limit -- a dropped font stays alive as
+// long as a GfxFontDict uses it.
+class GfxFontCache
+{
+public:
+    // <maxSizeA> is the size limit, in bytes.
+    GfxFontCache(XRef *xrefA, size_t maxSizeA);
+
+    // Get the font with ID <id>, making it from <fontDictA> (with tag
+    // <tag>) if it isn't in the cache.  Returns NULL if the font can't
+    // be made.
+    std::shared_ptr< GfxFont > getFont(Ref id, const char *tag, Dict *fontDictA);
+
+    // Drop all fonts.
+    void clear();
 
 private:
-    GfxFont **fonts; // list of fonts
-    int       numFonts; // number of fonts
+    XRef *                                    xref;
+    std::list< std::shared_ptr< GfxFont > > fonts; // MRU first
+    std::unordered_map< Ref, std::list< std::shared_ptr< GfxFont > >::iterator,
+                        xpdf::ref_hash_t >
+           index;
+    size_t size; // total size of the cached fonts, in bytes
+    size_t maxSize;
 };
 
 #endif // XPDF_XPDF_GFXFONT_HH
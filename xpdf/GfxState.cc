@@ -3783,12 +3783,10 @@ GfxState::GfxState(double hDPIA, double vDPIA, PDFRectangle *pageBox, int rotate
         pageHeight = ky * (py2 - py1);
     }
 
-    fillColorSpace = GfxColorSpace::create(csDeviceGray);
-    strokeColorSpace = GfxColorSpace::create(csDeviceGray);
+    fillColorSpace.reset(GfxColorSpace::create(csDeviceGray));
+    strokeColorSpace.reset(GfxColorSpace::create(csDeviceGray));
     fillColor.c[0] = 0;
     strokeColor.c[0] = 0;
-    fillPattern = NULL;
-    strokePattern = NULL;
     blendMode = gfxBlendNormal;
     fillOpacity = 1;
     strokeOpacity = 1;
@@ -3837,19 +3835,6 @@ GfxState::GfxState(double hDPIA, double vDPIA, PDFRectangle *pageBox, int rotate
 
 GfxState::~GfxState()
 {
-    if (fillColorSpace) {
-        delete fillColorSpace;
-    }
-    if (strokeColorSpace) {
-        delete strokeColorSpace;
-    }
-    if (fillPattern) {
-        delete fillPattern;
-    }
-    if (strokePattern) {
-        delete strokePattern;
-    }
-
     free(lineDash);
 
     if (path) {
@@ -3916,21 +3901,8 @@ GfxState::GfxState(GfxState *other, bool copyPath)
     ::copy(other->ctm, other->ctm + 6, ctm);
     ::copy(other->textMat, other->textMat + 6, textMat);
 
-    if (fillColorSpace) {
-        fillColorSpace = other->fillColorSpace->copy();
-    }
-
-    if (strokeColorSpace) {
-        strokeColorSpace = other->strokeColorSpace->copy();
-    }
-
-    if (fillPattern) {
-        fillPattern = other->fillPattern->copy();
-    }
-
-    if (strokePattern) {
-        strokePattern = other->strokePattern->copy();
-    }
+    // Color spaces and patterns are immutable once parsed, so the copy
+    // shares them with the original instead of duplicating them.
 
     ::copy(other->transfer, other->transfer + 4, transfer);
 
@@ -4102,34 +4074,42 @@ void GfxState::shiftCTM(double tx, double ty)
 
 void GfxState::setFillColorSpace(GfxColorSpace *colorSpace)
 {
-    if (fillColorSpace) {
-        delete fillColorSpace;
-    }
-    fillColorSpace = colorSpace;
+    fillColorSpace.reset(colorSpace);
+}
+
+void GfxState::setFillColorSpace(std::shared_ptr< GfxColorSpace > colorSpace)
+{
+    fillColorSpace = std::move(colorSpace);
 }
 
 void GfxState::setStrokeColorSpace(GfxColorSpace *colorSpace)
 {
-    if (strokeColorSpace) {
-        delete strokeColorSpace;
-    }
-    strokeColorSpace = colorSpace;
+    strokeColorSpace.reset(colorSpace);
+}
+
+void GfxState::setStrokeColorSpace(std::shared_ptr< GfxColorSpace > colorSpace)
+{
+    strokeColorSpace = std::move(colorSpace);
 }
 
 void GfxState::setFillPattern(GfxPattern *pattern)
 {
-    if (fillPattern) {
-        delete fillPattern;
-    }
-    fillPattern = pattern;
+    fillPattern.reset(pattern);
+}
+
+void GfxState::setFillPattern(std::shared_ptr< GfxPattern > pattern)
+{
+    fillPattern = std::move(pattern);
 }
 
 void GfxState::setStrokePattern(GfxPattern *pattern)
 {
-    if (strokePattern) {
-        delete strokePattern;
-    }
-    strokePattern = pattern;
+    strokePattern.reset(pattern);
+}
+
+void GfxState::setStrokePattern(std::shared_ptr< GfxPattern > pattern)
+{
+    strokePattern = std::move(pattern);
 }
 
 void GfxState::setTransfer(Function *funcs)
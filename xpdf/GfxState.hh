@@ -6,6 +6,8 @@
 
 #include <defs.hh>
 
+#include <memory>
+
 #include <xpdf/array_fwd.hh>
 #include <xpdf/obj.hh>
 #include <xpdf/function.hh>
@@ -1093,10 +1095,10 @@ public:
     {
         strokeColorSpace->getCMYK(&strokeColor, cmyk);
     }
-    GfxColorSpace *getFillColorSpace() { return fillColorSpace; }
-    GfxColorSpace *getStrokeColorSpace() { return strokeColorSpace; }
-    GfxPattern *   getFillPattern() { return fillPattern; }
-    GfxPattern *   getStrokePattern() { return strokePattern; }
+    GfxColorSpace *getFillColorSpace() { return fillColorSpace.get(); }
+    GfxColorSpace *getStrokeColorSpace() { return strokeColorSpace.get(); }
+    GfxPattern *   getFillPattern() { return fillPattern.get(); }
+    GfxPattern *   getStrokePattern() { return strokePattern.get(); }
     GfxBlendMode   getBlendMode() { return blendMode; }
     double         getFillOpacity() { return fillOpacity; }
     double         getStrokeOpacity() { return strokeOpacity; }
@@ -1174,12 +1176,18 @@ public:
     void setCTM(double a, double b, double c, double d, double e, double f);
     void concatCTM(double a, double b, double c, double d, double e, double f);
     void shiftCTM(double tx, double ty);
+    // The color space and pattern setters take ownership of a plain
+    // pointer, or share a (parsed and cached) color space or pattern.
     void setFillColorSpace(GfxColorSpace *colorSpace);
+    void setFillColorSpace(std::shared_ptr< GfxColorSpace > colorSpace);
     void setStrokeColorSpace(GfxColorSpace *colorSpace);
+    void setStrokeColorSpace(std::shared_ptr< GfxColorSpace > colorSpace);
     void setFillColor(GfxColor *color) { fillColor = *color; }
     void setStrokeColor(GfxColor *color) { strokeColor = *color; }
     void setFillPattern(GfxPattern *pattern);
+    void setFillPattern(std::shared_ptr< GfxPattern > pattern);
     void setStrokePattern(GfxPattern *pattern);
+    void setStrokePattern(std::shared_ptr< GfxPattern > pattern);
     void setBlendMode(GfxBlendMode mode) { blendMode = mode; }
     void setFillOpacity(double opac) { fillOpacity = opac; }
     void setStrokeOpacity(double opac) { strokeOpacity = opac; }
@@ -1265,12 +1273,12 @@ private:
     double pageWidth, pageHeight; // page size (pixels)
     int    rotate; // page rotation angle
 
-    GfxColorSpace *fillColorSpace; // fill color space
-    GfxColorSpace *strokeColorSpace; // stroke color space
+    std::shared_ptr< GfxColorSpace > fillColorSpace; // fill color space
+    std::shared_ptr< GfxColorSpace > strokeColorSpace; // stroke color space
     GfxColor       fillColor; // fill color
     GfxColor       strokeColor; // stroke color
-    GfxPattern *   fillPattern; // fill pattern
-    GfxPattern *   strokePattern; // stroke pattern
+    std::shared_ptr< GfxPattern > fillPattern; // fill pattern
+    std::shared_ptr< GfxPattern > strokePattern; // stroke pattern
     GfxBlendMode   blendMode; // transparency blend mode
     double         fillOpacity; // fill opacity
     double         strokeOpacity; // stroke opacity
@@ -12,7 +12,6 @@
 #include <cstdio>
 #include <cctype>
 
-#include <fstream>
 #include <list>
 #include <string>
 
@@ -27,16 +26,19 @@
 
 #include <xpdf/CMap.hh>
 #include <xpdf/CharCodeToUnicode.hh>
+#include <xpdf/config_cache.hh>
 #include <xpdf/Error.hh>
 #include <xpdf/FontEncodingTables.hh>
 #include <xpdf/GlobalParams.hh>
-#include <xpdf/NameToCharCode.hh>
+#include <xpdf/name_map.hh>
 #include <xpdf/NameToUnicodeTable.cc>
 #include <xpdf/unicode_map.hh>
 
 #define cidToUnicodeCacheSize 4
 #define unicodeToUnicodeCacheSize 4
 
+static constexpr xpdf::name_map_t nameToUnicodeMap(nameToUnicodeTab);
+
 ////////////////////////////////////////////////////////////////////////
 
 static fs::path home_path()
@@ -55,6 +57,46 @@ static fs::path home_path()
     }
 }
 
+//
+// Snapshot of the files read for a config file, in the user's cache
+// directory:
+//
+static fs::path config_cache_path(const fs::path &cfgPath)
+{
+    fs::path dir;
+
+    if (const char *s = getenv("XDG_CACHE_HOME"); s && s[0])
+        dir = fs::path(s);
+    else
+        dir = home_path() / ".cache";
+
+    std::error_code ec;
+    auto absPath = fs::absolute(cfgPath, ec);
+
+    char buf[32];
+    snprintf(buf, sizeof buf, "config-%016zx",
+             std::hash< std::string >()(absPath.string()));
+
+    return dir / "xpdf" / buf;
+}
+
+static const std::map< std::string, xpdf::unicode_map_t > &
+resident_unicode_maps()
+{
+    static const std::map< std::string, xpdf::unicode_map_t > maps = {
+#define ADD_MAP(name, type) { name, xpdf::unicode_map_t(type()) }
+        ADD_MAP(      "Latin1", xpdf::unicode_latin1_map_t),
+        ADD_MAP(      "ASCII7", xpdf::unicode_ascii7_map_t),
+        ADD_MAP(      "Symbol", xpdf::unicode_symbol_map_t),
+        ADD_MAP("ZapfDingbats", xpdf::unicode_dingbats_map_t),
+        ADD_MAP(       "UTF-8", xpdf::unicode_utf8_map_t),
+        ADD_MAP(       "UCS-2", xpdf::unicode_ucs2_map_t)
+#undef ADD_MAP
+    };
+
+    return maps;
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 static struct
@@ -348,11 +390,7 @@ KeyBinding::~KeyBinding()
 
 GlobalParams::GlobalParams(const char *cfgFileName)
 {
-    init_paper();
-
-    psImageableLLX = psImageableLLY = 0;
-    psImageableURX = psPaperWidth;
-    psImageableURY = psPaperHeight;
+    // the paper size, key bindings and caches are set up on first use
     psCrop = true;
     psUseCropBoxAsPage = false;
     psExpandSmaller = false;
@@ -370,6 +408,8 @@ GlobalParams::GlobalParams(const char *cfgFileName)
     psEmbedCIDTrueType = true;
     psFontPassthrough = false;
     psPreload = false;
+    psStreaming = false;
+    psStreamingFontPool = 64;
     psOPI = false;
     psASCIIHex = false;
     psLZW = true;
@@ -378,6 +418,10 @@ GlobalParams::GlobalParams(const char *cfgFileName)
     psRasterResolution = 300;
     psRasterMono = false;
     psRasterSliceSize = 20000000;
+    psRasterThreads = 0;
+    psRasterSkipBlank = false;
+    psFontThreads = 0;
+    psFontCacheDir = NULL;
     textEncoding = new GString("Latin1");
     textEOL = eolUnix;
     textPageBreaks = true;
@@ -406,99 +450,88 @@ GlobalParams::GlobalParams(const char *cfgFileName)
     mapUnknownCharNames = false;
     mapExtTrueTypeFontsViaUnicode = true;
     enableXFA = true;
-    createDefaultKeyBindings();
+    keyBindings = NULL;
     printCommands = false;
     errQuiet = false;
+    xrefRepairThreads = 0;
+    rasterThreads = 1;
+    type3CacheSize = 4096;
+    gfxFontCacheSize = 16384;
+    cMapCacheSize = 32;
 
-    cidToUnicodeCache = new CharCodeToUnicodeCache(cidToUnicodeCacheSize);
-    unicodeToUnicodeCache = new CharCodeToUnicodeCache(unicodeToUnicodeCacheSize);
+    cidToUnicodeCache = NULL;
+    unicodeToUnicodeCache = NULL;
+    cMapCache = NULL;
 
-    cMapCache = new CMapCache();
-
-    init_mac_roman_map();
-    init_unicode_map();
-    init_resident_unicode_maps();
+    configCache = NULL;
 
     // look for a user config file, then a system-wide config file
-    std::unique_ptr< ::FILE, int(*)(::FILE*) > pf(0, ::fclose);
-
     fs::path p;
 
-    if (cfgFileName && cfgFileName[0]) {
-        p = fs::path(cfgFileName);
+    auto is_file = [](const fs::path &p) {
+        std::error_code ec;
+        return fs::is_regular_file(p, ec);
+    };
 
-        if (fs::exists(p) && fs::is_regular_file(p))
-            pf.reset(fopen(p.c_str(), "r"));
-    }
+    if (cfgFileName && cfgFileName[0])
+        p = fs::path(cfgFileName);
 
-    if (!pf) {
+    if (p.empty() || !is_file(p))
         p = home_path() / ".xpdfrc";
 
-        if (fs::exists(p) && fs::is_regular_file(p))
-            pf.reset(fopen(p.c_str(), "r"));
-    }
-
-    if (0 == pf) {
+    if (!is_file(p))
         p = "/etc/xpdfrc";
 
-        if (fs::exists(p) && fs::is_regular_file(p))
-            pf.reset(fopen(p.c_str(), "r"));
-    }
+    if (is_file(p)) {
+        xpdf::config_cache_t cache(config_cache_path(p));
+        configCache = &cache;
 
-    if (pf) {
-        // TODO
         GString fname(p.c_str());
-        parseFile(&fname, pf.get());
+        parseFile(&fname);
+        scanFontDirs();
+
+        configCache = NULL;
+        cache.save();
     }
 }
 
 void GlobalParams::init_paper()
 {
-    paperinit();
+    std::call_once(paperOnce, [this]() {
+        paperinit();
 
-    if (const char *paperName = systempapername()) {
-        const struct paper *paperType = paperinfo(paperName);
-        psPaperWidth = (int)paperpswidth(paperType);
-        psPaperHeight = (int)paperpsheight(paperType);
-    } else {
-        error(errConfig, -1, "No paper information available - using defaults");
-        psPaperWidth = XPDF_PAPER_WIDTH;
-        psPaperHeight = XPDF_PAPER_HEIGHT;
-    }
+        if (const char *paperName = systempapername()) {
+            const struct paper *paperType = paperinfo(paperName);
+            psPaperWidth = (int)paperpswidth(paperType);
+            psPaperHeight = (int)paperpsheight(paperType);
+        } else {
+            error(errConfig, -1,
+                  "No paper information available - using defaults");
+            psPaperWidth = XPDF_PAPER_WIDTH;
+            psPaperHeight = XPDF_PAPER_HEIGHT;
+        }
 
-    paperdone();
-}
+        paperdone();
 
-void GlobalParams::init_mac_roman_map()
-{
-    //
-    // Scan the encoding in reverse because we want the lowest-numbered
-    // index for each char name ('space' is encoded twice):
-    //
-    for (int i = 255; i >= 0; --i)
-        if (macRomanEncoding[i])
-            macRomanReverseMap.emplace(macRomanEncoding[i], (CharCode)i);
+        psImageableLLX = psImageableLLY = 0;
+        psImageableURX = psPaperWidth;
+        psImageableURY = psPaperHeight;
+    });
 }
 
-void GlobalParams::init_unicode_map()
+void GlobalParams::init_key_bindings()
 {
-    for (int i = 0; nameToUnicodeTab[i].name; ++i)
-        nameToUnicode.emplace(nameToUnicodeTab[i].name, nameToUnicodeTab[i].u);
+    std::call_once(keyBindingsOnce, [this]() { createDefaultKeyBindings(); });
 }
 
-void GlobalParams::init_resident_unicode_maps()
+void GlobalParams::init_caches()
 {
-#define ADD_MAP(name, type)                                         \
-    residentUnicodeMaps.emplace(name, xpdf::unicode_map_t(type()))
-
-    ADD_MAP(      "Latin1", xpdf::unicode_latin1_map_t);
-    ADD_MAP(      "ASCII7", xpdf::unicode_ascii7_map_t);
-    ADD_MAP(      "Symbol", xpdf::unicode_symbol_map_t);
-    ADD_MAP("ZapfDingbats", xpdf::unicode_dingbats_map_t);
-    ADD_MAP(       "UTF-8", xpdf::unicode_utf8_map_t);
-    ADD_MAP(       "UCS-2", xpdf::unicode_ucs2_map_t);
-
-#undef ADD_MAP
+    std::call_once(cachesOnce, [this]() {
+        cidToUnicodeCache = new CharCodeToUnicodeCache(cidToUnicodeCacheSize);
+        unicodeToUnicodeCache =
+            new CharCodeToUnicodeCache(unicodeToUnicodeCacheSize);
+        cMapCache = new CMapCache();
+    });
 }
 
 void GlobalParams::createDefaultKeyBindings()
@@ -572,53 +605,52 @@ void GlobalParams::createDefaultKeyBindings()
 #undef XPDF_BIND_DEF
 }
 
-void GlobalParams::parseFile(GString *fileName, FILE *f)
+bool GlobalParams::parseFile(GString *fileName)
 {
-    size_t lineno = 1;
+    // while the constructor parses the config file, read through the
+    // snapshot
+    xpdf::config_cache_t cache;
 
-    std::ifstream stream(fileName->c_str());
+    auto lines = (configCache ? configCache : &cache)->config_file(
+        fileName->c_str());
 
-    for (std::string line; std::getline(stream, line); ++lineno)
-        parseLine(line, fileName, lineno);
+    if (!lines)
+        return false;
+
+    for (auto &[lineno, tokens] : *lines) {
+        GList *list = new GList();
+
+        for (auto &token : tokens)
+            list->append(new GString(token));
+
+        parseTokens(list, fileName, lineno);
+        deleteGList(list, GString);
+    }
+
+    return true;
 }
 
 void GlobalParams::parseLine(const std::string &line, GString *fileName, int lineno)
 {
-    GList *  tokens;
-    GString *cmd, *incFile;
-    FILE *   f2;
-
-    // break the line into tokens
-    tokens = new GList();
-    const char *p1 = line.c_str(), *p2;
+    GList *tokens = new GList();
 
-    while (*p1) {
-        for (; *p1 && isspace(*p1); ++p1) ;
+    for (auto &token : xpdf::tokenize_config_line(line))
+        tokens->append(new GString(token));
 
-        if (!*p1)
-            break;
-
-        if (*p1 == '"' || *p1 == '\'') {
-            for (p2 = p1 + 1; *p2 && *p2 != *p1; ++p2) ;
-            ++p1;
-        } else {
-            for (p2 = p1 + 1; *p2 && !isspace(*p2); ++p2) ;
-        }
+    parseTokens(tokens, fileName, lineno);
+    deleteGList(tokens, GString);
+}
 
-        tokens->append(new GString(p1, (int)(p2 - p1)));
-        p1 = *p2 ? p2 + 1 : p2;
-    }
+void GlobalParams::parseTokens(GList *tokens, GString *fileName, int lineno)
+{
+    GString *cmd, *incFile;
 
-    // parse the line
     if (tokens->getLength() > 0 && ((GString *)tokens->get(0))->front() != '#') {
         cmd = (GString *)tokens->get(0);
         if (!cmd->cmp("include")) {
             if (tokens->getLength() == 2) {
                 incFile = (GString *)tokens->get(1);
-                if (f2 = fopen(incFile->c_str(), "r")) {
-                    parseFile(incFile, f2);
-                    fclose(f2);
-                } else {
+                if (!parseFile(incFile)) {
                     error(errConfig, -1,
                           "Couldn't find included config file: '{0:t}' "
                           "({1:t}:{2:d})",
@@ -691,6 +723,11 @@ void GlobalParams::parseLine(const std::string &line, GString *fileName, int lin
                        lineno);
         } else if (!cmd->cmp("psPreload")) {
             parseYesNo("psPreload", &psPreload, tokens, fileName, lineno);
+        } else if (!cmd->cmp("psStreaming")) {
+            parseYesNo("psStreaming", &psStreaming, tokens, fileName, lineno);
+        } else if (!cmd->cmp("psStreamingFontPool")) {
+            parseInteger("psStreamingFontPool", &psStreamingFontPool, tokens,
+                         fileName, lineno);
         } else if (!cmd->cmp("psOPI")) {
             parseYesNo("psOPI", &psOPI, tokens, fileName, lineno);
         } else if (!cmd->cmp("psASCIIHex")) {
@@ -710,6 +747,18 @@ void GlobalParams::parseLine(const std::string &line, GString *fileName, int lin
         } else if (!cmd->cmp("psRasterSliceSize")) {
             parseInteger("psRasterSliceSize", &psRasterSliceSize, tokens,
                          fileName, lineno);
+        } else if (!cmd->cmp("psRasterThreads")) {
+            parseInteger("psRasterThreads", &psRasterThreads, tokens, fileName,
+                         lineno);
+        } else if (!cmd->cmp("psRasterSkipBlank")) {
+            parseYesNo("psRasterSkipBlank", &psRasterSkipBlank, tokens, fileName,
+                       lineno);
+        } else if (!cmd->cmp("psFontThreads")) {
+            parseInteger("psFontThreads", &psFontThreads, tokens, fileName,
+                         lineno);
+        } else if (!cmd->cmp("psFontCacheDir")) {
+            parseCommand("psFontCacheDir", &psFontCacheDir, tokens, fileName,
+                         lineno);
         } else if (!cmd->cmp("textEncoding")) {
             parseTextEncoding(tokens, fileName, lineno);
         } else if (!cmd->cmp("textEOL")) {
@@ -786,6 +835,21 @@ void GlobalParams::parseLine(const std::string &line, GString *fileName, int lin
             parseYesNo("printCommands", &printCommands, tokens, fileName, lineno);
         } else if (!cmd->cmp("errQuiet")) {
             parseYesNo("errQuiet", &errQuiet, tokens, fileName, lineno);
+        } else if (!cmd->cmp("xrefRepairThreads")) {
+            parseInteger("xrefRepairThreads", &xrefRepairThreads, tokens,
+                         fileName, lineno);
+        } else if (!cmd->cmp("rasterThreads")) {
+            parseInteger("rasterThreads", &rasterThreads, tokens, fileName,
+                         lineno);
+        } else if (!cmd->cmp("type3CacheSize")) {
+            parseInteger("type3CacheSize", &type3CacheSize, tokens, fileName,
+                         lineno);
+        } else if (!cmd->cmp("gfxFontCacheSize")) {
+            parseInteger("gfxFontCacheSize", &gfxFontCacheSize, tokens, fileName,
+                         lineno);
+        } else if (!cmd->cmp("cMapCacheSize")) {
+            parseInteger("cMapCacheSize", &cMapCacheSize, tokens, fileName,
+                         lineno);
         } else {
             error(errConfig, -1,
                   "Unknown config file command '{0:t}' ({1:t}:{2:d})", cmd,
@@ -807,8 +871,6 @@ void GlobalParams::parseLine(const std::string &line, GString *fileName, int lin
             }
         }
     }
-
-    deleteGList(tokens, GString);
 }
 
 void GlobalParams::parseNameToUnicode(GList *tokens, GString *fileName, int lineno)
@@ -824,30 +886,22 @@ void GlobalParams::parseNameToUnicode(GList *tokens, GString *fileName, int line
 
     name = (GString *)tokens->get(1);
 
-    std::ifstream stream(name->c_str());
+    xpdf::config_cache_t cache;
+
+    auto file = (configCache ? configCache : &cache)->name_to_unicode_file(
+        name->c_str());
 
-    if (!stream.is_open()) {
+    if (!file) {
         error(errConfig, -1, "Couldn't open 'nameToUnicode' file '{0:t}'", name);
         return;
     }
 
-    lineno = 1;
-    for (std::string line; std::getline(stream, line); ++lineno) {
-        auto tokens = xpdf::split(line);
-
-        if (2 != tokens.size()) {
-            error(errConfig, -1, "Bad line in 'nameToUnicode' file ({0:t}:{1:d})",
-                  name, lineno);
-            continue;
-        }
+    for (auto badLine : file->badLines)
+        error(errConfig, -1, "Bad line in 'nameToUnicode' file ({0:t}:{1:d})",
+              name, badLine);
 
-        const char *tok1 = tokens[0].c_str(), *tok2 = tokens[1].c_str();
-
-        Unicode  u;
-        sscanf(tok1, "%x", &u);
-
-        nameToUnicode.emplace(tok2, u);
-    }
+    for (auto &[charName, u] : file->entries)
+        nameToUnicode.emplace(charName, u);
 }
 
 void GlobalParams::parseCIDToUnicode(GList *tokens, GString *fileName, int line)
@@ -983,6 +1037,7 @@ void GlobalParams::parsePSPaperSize(GList *tokens, GString *fileName, int line)
 {
     GString *tok;
 
+    init_paper();
     if (tokens->getLength() == 2) {
         tok = (GString *)tokens->get(1);
         if (!setPSPaperSize(tok->c_str())) {
@@ -1014,6 +1069,7 @@ void GlobalParams::parsePSImageableArea(GList *tokens, GString *fileName,
               line);
         return;
     }
+    init_paper();
     psImageableLLX = atoi(((GString *)tokens->get(1))->c_str());
     psImageableLLY = atoi(((GString *)tokens->get(2))->c_str());
     psImageableURX = atoi(((GString *)tokens->get(3))->c_str());
@@ -1203,6 +1259,7 @@ void GlobalParams::parseBind(GList *tokens, GString *fileName, int line)
                   &mods, &context, "bind", tokens, fileName, line)) {
         return;
     }
+    init_key_bindings();
     for (i = 0; i < keyBindings->getLength(); ++i) {
         binding = (KeyBinding *)keyBindings->get(i);
         if (binding->code == code && binding->mods == mods &&
@@ -1232,6 +1289,7 @@ void GlobalParams::parseUnbind(GList *tokens, GString *fileName, int line)
                   &mods, &context, "unbind", tokens, fileName, line)) {
         return;
     }
+    init_key_bindings();
     for (i = 0; i < keyBindings->getLength(); ++i) {
         binding = (KeyBinding *)keyBindings->get(i);
         if (binding->code == code && binding->mods == mods &&
@@ -1494,6 +1552,8 @@ GlobalParams::~GlobalParams()
 
     if (psFile)
         delete psFile;
+    if (psFontCacheDir)
+        delete psFontCacheDir;
 
     deleteGHash(psResidentFonts, GString);
     deleteGList(psResidentFonts16, PSFontParam16);
@@ -1511,7 +1571,9 @@ GlobalParams::~GlobalParams()
     if (movieCommand) {
         delete movieCommand;
     }
-    deleteGList(keyBindings, KeyBinding);
+    if (keyBindings) {
+        deleteGList(keyBindings, KeyBinding);
+    }
 
     cMapDirs.startIter(&iter);
     while (cMapDirs.getNext(&iter, &key, (void **)&list)) {
@@ -1588,35 +1650,31 @@ void GlobalParams::setupBaseFonts(char *dir)
 
 CharCode GlobalParams::getMacRomanCharCode(char *charName)
 {
-    // no need to lock - macRomanReverseMap is constant
-    try {
-        return macRomanReverseMap.at(charName);
-    } catch(...) {
-        return 0;
-    }
+    return macRomanCharCode(charName);
 }
 
 Unicode GlobalParams::mapNameToUnicode(const char *charName)
 {
-    // no need to lock - nameToUnicode is constant
-    try {
-        return nameToUnicode.at(charName);
-    } catch(...) {
-        return 0;
+    // no need to lock - nameToUnicode is constant; the built-in table
+    // takes precedence over the nameToUnicode files
+    if (auto p = nameToUnicodeMap.find(charName)) {
+        return *p;
     }
+    auto iter = nameToUnicode.find(charName);
+    return iter == nameToUnicode.end() ? 0 : iter->second;
 }
 
 bool
 GlobalParams::hasResidentUnicodeMap(const char *encoding) const
 {
-    return residentUnicodeMaps.contains(encoding);
+    return resident_unicode_maps().contains(encoding);
 }
 
 xpdf::unicode_map_t
 GlobalParams::getResidentUnicodeMap(const char *encoding) const
 {
     try {
-        return residentUnicodeMaps.at(encoding);
+        return resident_unicode_maps().at(encoding);
     } catch(...) {
         return xpdf::unicode_map_t{ };
     }
@@ -1637,7 +1695,7 @@ FILE *GlobalParams::findCMapFile(GString *collection, GString *cMapName)
     for (int i = 0; i < list->getLength(); ++i) {
         GString *dir = (GString *)list->get(i);
 
-        auto path = fs::path(dir->c_str(), cMapName->c_str());
+        auto path = fs::path(dir->c_str()) / cMapName->c_str();
 
         if (FILE *pf = fopen(path.c_str(), "r"))
             return pf;
@@ -1651,7 +1709,7 @@ FILE *GlobalParams::findToUnicodeFile(GString *name)
     for (int i = 0; i < toUnicodeDirs.getLength(); ++i) {
         GString *dir = (GString *)toUnicodeDirs.get(i);
 
-        auto path = fs::path(dir->c_str(), name->c_str());
+        auto path = fs::path(dir->c_str()) / name->c_str();
 
         if (FILE *pf = fopen(path.c_str(), "r"))
             return pf;
@@ -1670,20 +1728,44 @@ GString *GlobalParams::findFontFile(GString *fontName)
     for (int i = 0; i < fontDirs.getLength(); ++i) {
         GString *dir = (GString *)fontDirs.get(i);
 
-        for (size_t j = 0; j < sizeof exts / sizeof *exts; ++j) {
-            const char *ext = exts[j];
+        // the font dirs scanned with the config are not probed again
+        auto iter = strchr(fontName->c_str(), '/')
+                        ? fontDirFiles.end()
+                        : fontDirFiles.find(dir->c_str());
+
+        for (size_t j = 0; exts[j]; ++j) {
+            const std::string name = std::string(fontName->c_str()) + exts[j];
 
-            auto path = fs::path(dir->c_str()) / fontName->c_str();
-            path += ext;
+            if (iter != fontDirFiles.end()) {
+                if (std::binary_search(iter->second.begin(),
+                                       iter->second.end(), name))
+                    return new GString((fs::path(dir->c_str()) / name).c_str());
+            } else {
+                auto path = fs::path(dir->c_str()) / name;
 
-            if (fs::exists(path))
-                return new GString(path.c_str());
+                if (fs::exists(path))
+                    return new GString(path.c_str());
+            }
         }
     }
 
     return 0;
 }
 
+void GlobalParams::scanFontDirs()
+{
+    for (int i = 0; i < fontDirs.getLength(); ++i) {
+        GString *dir = (GString *)fontDirs.get(i);
+
+        std::error_code ec;
+
+        if (auto names = configCache->font_dir(dir->c_str()))
+            fontDirFiles.emplace(dir->c_str(), *names);
+        else if (!fs::exists(dir->c_str(), ec) && !ec)
+            fontDirFiles.emplace(dir->c_str(), std::vector< std::string >());
+    }
+}
+
 GString *GlobalParams::findBase14FontFile(GString *fontName, int *fontNum,
                                           double *oblique)
 {
@@ -1738,6 +1820,7 @@ int GlobalParams::getPSPaperWidth()
 {
     int w;
 
+    init_paper();
     w = psPaperWidth;
     return w;
 }
@@ -1746,12 +1829,14 @@ int GlobalParams::getPSPaperHeight()
 {
     int h;
 
+    init_paper();
     h = psPaperHeight;
     return h;
 }
 
 void GlobalParams::getPSImageableArea(int *llx, int *lly, int *urx, int *ury)
 {
+    init_paper();
     *llx = psImageableLLX;
     *lly = psImageableLLY;
     *urx = psImageableURX;
@@ -1919,6 +2004,22 @@ bool GlobalParams::getPSPreload()
     return preload;
 }
 
+bool GlobalParams::getPSStreaming()
+{
+    bool streaming;
+
+    streaming = psStreaming;
+    return streaming;
+}
+
+int GlobalParams::getPSStreamingFontPool()
+{
+    int n;
+
+    n = psStreamingFontPool;
+    return n;
+}
+
 bool GlobalParams::getPSOPI()
 {
     bool opi;
@@ -1983,6 +2084,38 @@ int GlobalParams::getPSRasterSliceSize()
     return slice;
 }
 
+int GlobalParams::getPSRasterThreads()
+{
+    int n;
+
+    n = psRasterThreads;
+    return n;
+}
+
+bool GlobalParams::getPSRasterSkipBlank()
+{
+    bool skip;
+
+    skip = psRasterSkipBlank;
+    return skip;
+}
+
+int GlobalParams::getPSFontThreads()
+{
+    int n;
+
+    n = psFontThreads;
+    return n;
+}
+
+GString *GlobalParams::getPSFontCacheDir()
+{
+    GString *s;
+
+    s = psFontCacheDir ? psFontCacheDir->copy() : (GString *)NULL;
+    return s;
+}
+
 GString *GlobalParams::getTextEncodingName()
 {
     GString *s;
@@ -2182,6 +2315,8 @@ GList *GlobalParams::getKeyBinding(int code, int mods, int context)
     int         modMask;
     int         i, j;
 
+    init_key_bindings();
+
     cmds = NULL;
     // for ASCII chars, ignore the shift modifier
     modMask = code <= 0xff ? ~xpdfKeyModShift : ~0;
@@ -2207,14 +2342,59 @@ bool GlobalParams::getErrQuiet()
     return errQuiet;
 }
 
+int GlobalParams::getXRefRepairThreads()
+{
+    int n;
+
+    n = xrefRepairThreads;
+    return n;
+}
+
+int GlobalParams::getRasterThreads()
+{
+    int n;
+
+    n = rasterThreads;
+    return n;
+}
+
+int GlobalParams::getType3CacheSize()
+{
+    int n;
+
+    n = type3CacheSize;
+    return n;
+}
+
+int GlobalParams::getGfxFontCacheSize()
+{
+    int n;
+
+    n = gfxFontCacheSize;
+    return n;
+}
+
+int GlobalParams::getCMapCacheSize()
+{
+    int n;
+
+    n = cMapCacheSize;
+    return n;
+}
+
 CharCodeToUnicode *GlobalParams::getCIDToUnicode(GString *collection)
 {
     GString *          fileName;
     CharCodeToUnicode *ctu;
 
+    init_caches();
+
     if (!(ctu = cidToUnicodeCache->getCharCodeToUnicode(collection))) {
         if ((fileName = (GString *)cidToUnicodes.lookup(collection)) &&
-            (ctu = CharCodeToUnicode::parseCIDToUnicode(fileName, collection))) {
+            ((ctu = CharCodeToUnicode::parseBinaryCIDToUnicode(fileName,
+                                                               collection)) ||
+             (ctu = CharCodeToUnicode::parseCIDToUnicode(fileName,
+                                                         collection)))) {
             cidToUnicodeCache->add(ctu);
         }
     }
@@ -2237,6 +2417,7 @@ CharCodeToUnicode *GlobalParams::getUnicodeToUnicode(GString *fontName)
         fileName = NULL;
     }
     if (fileName) {
+        init_caches();
         if (!(ctu = unicodeToUnicodeCache->getCharCodeToUnicode(fileName))) {
             if ((ctu = CharCodeToUnicode::parseUnicodeToUnicode(fileName))) {
                 unicodeToUnicodeCache->add(ctu);
@@ -2264,7 +2445,7 @@ xpdf::unicode_map_t
 GlobalParams::getUnicodeMap2(const char *encoding) const
 {
     try {
-        return residentUnicodeMaps.at(encoding);
+        return resident_unicode_maps().at(encoding);
     } catch(...) {
         return unicodeMapCache.at(encoding);
     }
@@ -2274,6 +2455,7 @@ CMap *GlobalParams::getCMap(GString *collection, GString *cMapName)
 {
     CMap *cMap;
 
+    init_caches();
     cMap = cMapCache->getCMap(collection, cMapName);
     return cMap;
 }
@@ -2303,6 +2485,7 @@ void GlobalParams::setPSFile(char *file)
 
 bool GlobalParams::setPSPaperSize(const char *size)
 {
+    init_paper();
     if (!strcmp(size, "match")) {
         psPaperWidth = psPaperHeight = -1;
     } else if (!strcmp(size, "letter")) {
@@ -2328,6 +2511,7 @@ bool GlobalParams::setPSPaperSize(const char *size)
 
 void GlobalParams::setPSPaperWidth(int width)
 {
+    init_paper();
     psPaperWidth = width;
     psImageableLLX = 0;
     psImageableURX = psPaperWidth;
@@ -2335,6 +2519,7 @@ void GlobalParams::setPSPaperWidth(int width)
 
 void GlobalParams::setPSPaperHeight(int height)
 {
+    init_paper();
     psPaperHeight = height;
     psImageableLLY = 0;
     psImageableURY = psPaperHeight;
@@ -2342,6 +2527,7 @@ void GlobalParams::setPSPaperHeight(int height)
 
 void GlobalParams::setPSImageableArea(int llx, int lly, int urx, int ury)
 {
+    init_paper();
     psImageableLLX = llx;
     psImageableLLY = lly;
     psImageableURX = urx;
@@ -2413,6 +2599,11 @@ void GlobalParams::setPSPreload(bool preload)
     psPreload = preload;
 }
 
+void GlobalParams::setPSStreaming(bool streaming)
+{
+    psStreaming = streaming;
+}
+
 void GlobalParams::setPSOPI(bool opi)
 {
     psOPI = opi;
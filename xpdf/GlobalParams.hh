@@ -9,7 +9,9 @@
 #include <cstdio>
 
 #include <map>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include <filesystem>
 namespace fs = std::filesystem;
@@ -25,7 +27,6 @@ namespace fs = std::filesystem;
 class GString;
 class GList;
 class GHash;
-class NameToCharCode;
 class CharCodeToUnicode;
 class CharCodeToUnicodeCache;
 class UnicodeMap;
@@ -34,6 +35,10 @@ class CMap;
 class CMapCache;
 class GlobalParams;
 
+namespace xpdf {
+struct config_cache_t;
+} // namespace xpdf
+
 //------------------------------------------------------------------------
 
 // The global parameters object.
@@ -229,6 +234,8 @@ public:
     bool           getPSEmbedCIDTrueType();
     bool           getPSFontPassthrough();
     bool           getPSPreload();
+    bool           getPSStreaming();
+    int            getPSStreamingFontPool();
     bool           getPSOPI();
     bool           getPSASCIIHex();
     bool           getPSLZW();
@@ -237,6 +244,10 @@ public:
     double         getPSRasterResolution();
     bool           getPSRasterMono();
     int            getPSRasterSliceSize();
+    int            getPSRasterThreads();
+    bool           getPSRasterSkipBlank();
+    int            getPSFontThreads();
+    GString *      getPSFontCacheDir();
     bool           getPSAlwaysRasterize();
     GString *      getTextEncodingName();
     EndOfLineKind  getTextEOL();
@@ -269,6 +280,11 @@ public:
     GList *        getKeyBinding(int code, int mods, int context);
     bool           getPrintCommands() const { return printCommands; }
     bool           getErrQuiet();
+    int            getXRefRepairThreads();
+    int            getRasterThreads();
+    int            getType3CacheSize();
+    int            getGfxFontCacheSize();
+    int            getCMapCacheSize();
 
     CharCodeToUnicode *getCIDToUnicode(GString *collection);
     CharCodeToUnicode *getUnicodeToUnicode(GString *fontName);
@@ -301,6 +317,7 @@ public:
     void setPSEmbedCIDTrueType(bool embed);
     void setPSFontPassthrough(bool passthrough);
     void setPSPreload(bool preload);
+    void setPSStreaming(bool streaming);
     void setPSOPI(bool opi);
     void setPSASCIIHex(bool hex);
     void setTextEncoding(const char *encodingName);
@@ -326,13 +343,17 @@ public:
     void setErrQuiet(bool errQuietA);
 
 private:
+    //
+    // Set up on first use:
+    //
     void init_paper();
-    void init_resident_unicode_maps();
-    void init_mac_roman_map();
-    void init_unicode_map();
+    void init_key_bindings();
+    void init_caches();
 
     void createDefaultKeyBindings();
-    void parseFile(GString *fileName, FILE *f);
+    bool parseFile(GString *fileName);
+    void parseTokens(GList *tokens, GString *fileName, int line);
+    void scanFontDirs();
     void parseNameToUnicode(GList *tokens, GString *fileName, int line);
     void parseCIDToUnicode(GList *tokens, GString *fileName, int line);
     void parseUnicodeToUnicode(GList *tokens, GString *fileName, int line);
@@ -373,9 +394,10 @@ private:
     //----- static tables
 
     //
-    // Mapping from char name to MacRomanEncoding index:
+    // Mapping from char name to Unicode, from nameToUnicode files (the
+    // built-in names are in a static table):
     //
-    std::map< std::string, CharCode > macRomanReverseMap, nameToUnicode;
+    std::map< std::string, CharCode, std::less<> > nameToUnicode;
 
     //
     // Files for mappings from char collections to Unicode, indexed by
@@ -389,8 +411,6 @@ private:
     //
     GHash unicodeToUnicodes;
 
-    std::map< std::string, xpdf::unicode_map_t > residentUnicodeMaps;
-
     //
     // Files for mappings from Unicode to character codes, indexed by encoding
     // name [GString]:
@@ -405,6 +425,9 @@ private:
     GHash fontFiles;       // font files: font name mapped to path
                             //   [GString]
     GList fontDirs;        // list of font dirs [GString]
+    std::map< std::string, std::vector< std::string > >
+        fontDirFiles;      // sorted file names in the font dirs, as
+                            //   scanned when the config was read
     GHash ccFontFiles;     // character collection font files:
                             //   collection name  mapped to path [GString]
     GHash base14SysFonts;  // Base-14 system font files: font name
@@ -443,6 +466,8 @@ private:
     bool psFontPassthrough;    // pass all fonts through as-is?
     bool psPreload;            // preload PostScript images and forms into
                                //   memory
+    bool psStreaming;          // set up PostScript resources page by page
+    int  psStreamingFontPool;  // max fonts kept across pages when streaming
     bool   psOPI; // generate PostScript OPI comments?
     bool   psASCIIHex; // use ASCIIHex instead of ASCII85?
     bool   psLZW; // false to use RLE instead of LZW
@@ -454,6 +479,14 @@ private:
         //   in color (RGB/CMYK)
     int psRasterSliceSize; // maximum size (pixels) of PostScript
         //   rasterization slice
+    int psRasterThreads; // threads used for PostScript rasterization
+        //   (0 = one per core)
+    bool psRasterSkipBlank; // write blank PostScript rasterization
+        //   slices as a single fill
+    int psFontThreads; // threads used to convert embedded fonts
+        //   (0 = one per core)
+    GString *psFontCacheDir; // directory for converted embedded fonts
+        //   (NULL = no cache)
     GString *textEncoding; // encoding (unicodeMap) to use for text
         //   output
     EndOfLineKind textEOL; // type of EOL marker to use for text
@@ -488,6 +521,13 @@ private:
     GList *keyBindings; // key & mouse button bindings [KeyBinding]
     bool   printCommands; // print the drawing commands
     bool   errQuiet; // suppress error messages?
+    int    xrefRepairThreads; // threads used to scan damaged files
+        //   (0 = one per large chunk, up to the number of cores)
+    int    rasterThreads; // threads used to rasterize a page, in bands
+        //   (0 = one per core)
+    int    type3CacheSize; // size of the Type 3 glyph cache, in KB
+    int    gfxFontCacheSize; // size of the document font cache, in KB
+    int    cMapCacheSize; // number of CMaps kept in the CMap cache
 
     CharCodeToUnicodeCache *cidToUnicodeCache;
     CharCodeToUnicodeCache *unicodeToUnicodeCache;
@@ -495,6 +535,14 @@ private:
     std::map< std::string, xpdf::unicode_map_t > unicodeMapCache;
 
     CMapCache *cMapCache;
+
+    std::once_flag paperOnce, keyBindingsOnce, cachesOnce;
+
+    //
+    // Snapshot of the files read while parsing the config file, in the
+    // constructor only:
+    //
+    xpdf::config_cache_t *configCache;
 };
 
 #endif // XPDF_XPDF_GLOBALPARAMS_HH
@@ -832,25 +832,42 @@ Links::~Links()
     free(links);
 }
 
-LinkAction *Links::find(double x, double y)
+const xpdf::rect_index_t &Links::getIndex()
 {
-    int i;
+    if (!index) {
+        std::vector< xpdf::bbox_t > boxes(numLinks);
 
-    for (i = numLinks - 1; i >= 0; --i) {
-        if (links[i]->inRect(x, y)) {
-            return links[i]->getAction();
+        for (int i = 0; i < numLinks; ++i) {
+            auto &box = boxes[i];
+            links[i]->getRect(&box.xmin, &box.ymin, &box.xmax, &box.ymax);
         }
+
+        index = std::make_unique< xpdf::rect_index_t >(std::move(boxes));
     }
-    return NULL;
+
+    return *index;
+}
+
+LinkAction *Links::find(double x, double y)
+{
+    // the last link in the list is on top
+    long i = getIndex().find_last(x, y);
+    return i < 0 ? NULL : links[i]->getAction();
 }
 
 bool Links::onLink(double x, double y)
 {
-    int i;
+    return getIndex().find_first(x, y) >= 0;
+}
 
-    for (i = 0; i < numLinks; ++i) {
-        if (links[i]->inRect(x, y))
-            return true;
+std::vector< Link * > Links::findInRect(double xMin, double yMin, double xMax,
+                                        double yMax)
+{
+    std::vector< Link * > result;
+
+    for (auto i : getIndex().find(xpdf::bbox_t{ xMin, yMin, xMax, yMax })) {
+        result.push_back(links[i]);
     }
-    return false;
+
+    return result;
 }
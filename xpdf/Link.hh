@@ -6,8 +6,12 @@
 
 #include <defs.hh>
 
+#include <memory>
+#include <vector>
+
 #include <xpdf/array_fwd.hh>
 #include <xpdf/obj.hh>
+#include <xpdf/rect_index.hh>
 
 //------------------------------------------------------------------------
 // LinkAction
@@ -428,9 +432,19 @@ public:
     // Return true if <x>,<y> is in a link.
     bool onLink(double x, double y);
 
+    // Return the links whose rectangles intersect the rectangle
+    // <xMin>,<yMin>-<xMax>,<yMax>, in link order.
+    std::vector< Link * > findInRect(double xMin, double yMin, double xMax,
+                                     double yMax);
+
 private:
+    // Build the spatial index on first use.
+    const xpdf::rect_index_t &getIndex();
+
     Link **links;
     int    numLinks;
+
+    std::unique_ptr< xpdf::rect_index_t > index; // link rectangles
 };
 
 #endif // XPDF_XPDF_LINK_HH
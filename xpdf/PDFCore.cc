@@ -137,6 +137,7 @@ PDFCore::PDFCore(SplashColorMode colorModeA, int bitmapRowPadA,
     splashColorCopy(paperColor, paperColorA);
     out = new CoreOutputDev(colorModeA, bitmapRowPadA, reverseVideoA, paperColorA,
                             incrementalUpdate, &redrawCbk, this);
+    out->setPageBitmapCbk(&tileBitmapCbk, this);
     out->startDoc(NULL);
 }
 
@@ -1643,6 +1644,8 @@ void PDFCore::xorRectangle(int pg, int x0, int y0, int x1, int y1,
         for (i = 0; i < page->tiles->getLength(); ++i) {
             tile = (PDFCoreTile *)page->tiles->get(i);
             if (!oneTile || tile == oneTile) {
+                startTileUpdate(tile);
+
                 Splash splash(tile->bitmap, false);
 
                 if (pattern) {
@@ -2093,6 +2096,14 @@ void PDFCore::redrawCbk(void *data, int x0, int y0, int x1, int y1,
                             composited);
 }
 
+// Let the front end provide the bitmap of the tile being rasterized.
+SplashBitmap *PDFCore::tileBitmapCbk(void *data, int w, int h)
+{
+    PDFCore *core = (PDFCore *)data;
+
+    return core->curTile ? core->newTileBitmap(core->curTile, w, h) : NULL;
+}
+
 void PDFCore::redrawWindow(int x, int y, int width, int height, bool needUpdate)
 {
     PDFCorePage *page;
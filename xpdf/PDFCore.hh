@@ -262,8 +262,14 @@ protected:
     PDFCorePage *findPage(int pg);
     static void  redrawCbk(void *data, int x0, int y0, int x1, int y1,
                            bool composited);
+    static SplashBitmap *tileBitmapCbk(void *data, int w, int h);
     void redrawWindow(int x, int y, int width, int height, bool needUpdate);
     virtual PDFCoreTile *newTile(int xDestA, int yDestA);
+    virtual SplashBitmap *newTileBitmap(PDFCoreTile *tileA, int w, int h)
+    {
+        return NULL;
+    }
+    virtual void startTileUpdate(PDFCoreTile *tileA) { }
     virtual void updateTileData(PDFCoreTile *tileA, int xSrc, int ySrc, int width,
                                 int height, bool composited);
     virtual void redrawRect(PDFCoreTile *tileA, int xSrc, int ySrc, int xDest,
@@ -14,6 +14,7 @@
 #include <xpdf/dict.hh>
 #include <xpdf/Error.hh>
 #include <xpdf/ErrorCodes.hh>
+#include <xpdf/GfxFont.hh>
 #include <xpdf/GlobalParams.hh>
 #include <xpdf/Link.hh>
 #include <xpdf/OptionalContent.hh>
@@ -51,6 +52,7 @@ PDFDoc::PDFDoc(GString *fileNameA, GString *ownerPassword, GString *userPassword
     str = NULL;
     xref = NULL;
     catalog = NULL;
+    fontCache = NULL;
     outline = NULL;
     optContent = NULL;
 
@@ -86,6 +88,7 @@ PDFDoc::PDFDoc(BaseStream *strA, GString *ownerPassword, GString *userPassword,
     str = strA;
     xref = NULL;
     catalog = NULL;
+    fontCache = NULL;
     outline = NULL;
     optContent = NULL;
     ok = setup(ownerPassword, userPassword);
@@ -113,12 +116,12 @@ bool PDFDoc::setup(GString *ownerPassword, GString *userPassword)
         }
     }
 
-    // read outline
-    outline = new Outline(catalog->getOutline(), xref);
-
     // read the optional content info
     optContent = new OptionalContent(this);
 
+    fontCache = new GfxFontCache(
+        xref, (size_t)globalParams->getGfxFontCacheSize() * 1024);
+
     // done
     return true;
 }
@@ -159,6 +162,14 @@ bool PDFDoc::setup2(GString *ownerPassword, GString *userPassword,
     return true;
 }
 
+Outline *PDFDoc::getOutline()
+{
+    if (!outline) {
+        outline = new Outline(catalog->getOutline(), xref);
+    }
+    return outline;
+}
+
 PDFDoc::~PDFDoc()
 {
     if (optContent) {
@@ -167,6 +178,9 @@ PDFDoc::~PDFDoc()
     if (outline) {
         delete outline;
     }
+    if (fontCache) {
+        delete fontCache;
+    }
     if (catalog) {
         delete catalog;
     }
@@ -12,6 +12,7 @@
 #include <xpdf/Page.hh>
 
 class BaseStream;
+class GfxFontCache;
 class OutputDev;
 class Links;
 class LinkAction;
@@ -48,6 +49,9 @@ public:
     // Get catalog.
     Catalog *getCatalog() { return catalog; }
 
+    // Get the font cache, shared by all pages.
+    GfxFontCache *getFontCache() { return fontCache; }
+
     // Get base stream.
     BaseStream *getBaseStream() { return str; }
 
@@ -115,8 +119,8 @@ public:
     void processLinks(OutputDev *out, int page);
 
 #ifndef DISABLE_OUTLINE
-    // Return the outline object.
-    Outline *getOutline() { return outline; }
+    // Return the outline object.  It is read on first use.
+    Outline *getOutline();
 #endif
 
     // Return the OptionalContent object.
@@ -185,6 +189,7 @@ private:
     double      pdfVersion;
     XRef *      xref;
     Catalog *   catalog;
+    GfxFontCache *fontCache;
 #ifndef DISABLE_OUTLINE
     Outline *outline;
 #endif
@@ -7,12 +7,18 @@
 #include <cstddef>
 #include <cstdarg>
 #include <signal.h>
+#include <unistd.h>
 #include <cmath>
 
+#include <atomic>
+#include <string>
+#include <thread>
+
 #include <utils/memory.hh>
 #include <utils/string.hh>
 #include <utils/GList.hh>
 #include <utils/GHash.hh>
+#include <utils/path.hh>
 
 #include <fofi/FoFiType1C.hh>
 #include <fofi/FoFiTrueType.hh>
@@ -23,6 +29,7 @@
 #include <xpdf/Annot.hh>
 #include <xpdf/Catalog.hh>
 #include <xpdf/CharCodeToUnicode.hh>
+#include <xpdf/Decrypt.hh>
 #include <xpdf/Error.hh>
 #include <xpdf/Form.hh>
 #include <xpdf/Gfx.hh>
@@ -875,6 +882,278 @@ PSFontFileInfo::~PSFontFileInfo()
     }
 }
 
+//------------------------------------------------------------------------
+// PSFontConversion
+//------------------------------------------------------------------------
+
+enum PSFontConversionType {
+    psConvType1CToType1, // Type 1C -> Type 1
+    psConvOpenTypeT1CToType1, // OpenType CFF -> Type 1
+    psConvTrueTypeToType42, // TrueType -> Type 42
+    psConvCIDType0CToCIDType0, // CID Type 1C -> CID Type 0
+    psConvCIDType0CToType0, // CID Type 1C -> Type 0
+    psConvCIDType2ToCIDType2, // CID TrueType -> CID Type 2
+    psConvCIDType2ToType0, // CID TrueType -> Type 0
+    psConvCIDType0COTToCIDType0, // CID OpenType CFF -> CID Type 0
+    psConvCIDType0COTToType0 // CID OpenType CFF -> Type 0
+};
+
+// The conversion of an embedded font file to PostScript.  During the
+// document setup, conversions are queued, and run together on several
+// threads (see PSOutputDev::runFontConversions); the output written
+// after each queued conversion is held in <after> until then.
+class PSFontConversion
+{
+public:
+    // Takes ownership of <fontBufA>; copies <psNameA>.
+    PSFontConversion(PSFontConversionType typeA, GString *psNameA,
+                     char *fontBufA, int fontLenA);
+    ~PSFontConversion();
+
+    // Set the encoding (for Type 42 fonts), or the code-to-GID / CID
+    // mapping; both are copied.
+    void setEncoding(char **encA);
+    void setCodeToGID(int *codeToGIDA, int codeToGIDLenA);
+
+    // Convert the font into <out>.  If <cacheDir> is non-NULL, a cached
+    // conversion is used if there is one, and a new one is added.
+    void run(GString *cacheDir);
+
+    PSFontConversionType type;
+    GString *            psName;
+    char *               fontBuf; // font file contents
+    int                  fontLen;
+    char **              enc; // encoding [256], or NULL
+    int *                codeToGID; // code/CID to GID map, or NULL
+    int                  codeToGIDLen;
+    bool                 needVerticalMetrics;
+    GString              out; // the converted font
+    GString              after; // output following the font
+
+private:
+    GString *getCacheKey();
+    void     convert();
+};
+
+static void outputToGString(void *stream, const char *data, int len)
+{
+    ((GString *)stream)->append(data, len);
+}
+
+PSFontConversion::PSFontConversion(PSFontConversionType typeA,
+                                   GString *psNameA, char *fontBufA,
+                                   int fontLenA)
+{
+    type = typeA;
+    psName = psNameA->copy();
+    fontBuf = fontBufA;
+    fontLen = fontLenA;
+    enc = NULL;
+    codeToGID = NULL;
+    codeToGIDLen = 0;
+    needVerticalMetrics = false;
+}
+
+PSFontConversion::~PSFontConversion()
+{
+    int i;
+
+    delete psName;
+    free(fontBuf);
+    if (enc) {
+        for (i = 0; i < 256; ++i) {
+            free(enc[i]);
+        }
+        free(enc);
+    }
+    if (codeToGID) {
+        free(codeToGID);
+    }
+}
+
+void PSFontConversion::setEncoding(char **encA)
+{
+    int i;
+
+    enc = (char **)calloc(256, sizeof(char *));
+    for (i = 0; i < 256; ++i) {
+        enc[i] = encA[i] ? strdup(encA[i]) : (char *)NULL;
+    }
+}
+
+void PSFontConversion::setCodeToGID(int *codeToGIDA, int codeToGIDLenA)
+{
+    if (codeToGIDA) {
+        codeToGID = (int *)calloc(codeToGIDLenA > 0 ? codeToGIDLenA : 1,
+                                  sizeof(int));
+        memcpy(codeToGID, codeToGIDA, codeToGIDLenA * sizeof(int));
+    }
+    codeToGIDLen = codeToGIDLenA;
+}
+
+// The cache key is an MD5 hash of everything that goes into the
+// conversion, including the xpdf version.
+GString *PSFontConversion::getCacheKey()
+{
+    static const char *hexChars = "0123456789abcdef";
+    MD5State           md5;
+    GString *          s;
+    int                params[4];
+    int                i;
+
+    s = GString::format("xpdf {0:s} {1:t}", PACKAGE_VERSION, psName);
+    md5Start(&md5);
+    md5Append(&md5, (unsigned char *)s->c_str(), s->getLength() + 1);
+    delete s;
+    params[0] = type;
+    params[1] = needVerticalMetrics;
+    params[2] = codeToGID ? codeToGIDLen : -1;
+    params[3] = enc ? 1 : 0;
+    md5Append(&md5, (unsigned char *)params, sizeof(params));
+    if (codeToGID) {
+        md5Append(&md5, (unsigned char *)codeToGID, codeToGIDLen * sizeof(int));
+    }
+    if (enc) {
+        for (i = 0; i < 256; ++i) {
+            if (enc[i]) {
+                md5Append(&md5, (unsigned char *)enc[i], (int)strlen(enc[i]));
+            }
+            md5Append(&md5, (unsigned char *)"\n", 1);
+        }
+    }
+    md5Append(&md5, (unsigned char *)fontBuf, fontLen);
+    md5Finish(&md5);
+
+    s = new GString();
+    for (i = 0; i < 16; ++i) {
+        s->append(1UL, hexChars[(md5.digest[i] >> 4) & 0x0f]);
+        s->append(1UL, hexChars[md5.digest[i] & 0x0f]);
+    }
+    s->append(".ps");
+    return s;
+}
+
+void PSFontConversion::run(GString *cacheDir)
+{
+    GString *key;
+    fs::path path, tmpPath;
+    FILE *   f;
+    char     buf[65536];
+    size_t   n;
+    bool     ok;
+
+    if (!cacheDir) {
+        convert();
+        return;
+    }
+
+    key = getCacheKey();
+    path = fs::path(cacheDir->c_str()) / key->c_str();
+    delete key;
+
+    // use the cached conversion, if any
+    if ((f = fopen(path.c_str(), "rb"))) {
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+            out.append(buf, n);
+        }
+        ok = !ferror(f);
+        fclose(f);
+        if (ok && !out.empty()) {
+            return;
+        }
+        out.clear();
+    }
+
+    convert();
+
+    // add it to the cache -- write a temporary file and rename it, so
+    // a concurrent reader never sees a partial file
+    if (!out.empty()) {
+        tmpPath = path;
+        tmpPath += "." + std::to_string(getpid()) + ".tmp";
+        if ((f = fopen(tmpPath.c_str(), "wb"))) {
+            ok = fwrite(out.c_str(), 1, out.size(), f) == out.size();
+            ok = fclose(f) == 0 && ok;
+            if (!ok || rename(tmpPath.c_str(), path.c_str())) {
+                error(errIO, -1, "Couldn't write font cache file '{0:s}'",
+                      path.c_str());
+                remove(tmpPath.c_str());
+            }
+        } else {
+            error(errIO, -1, "Couldn't write font cache file '{0:s}'",
+                  path.c_str());
+        }
+    }
+}
+
+void PSFontConversion::convert()
+{
+    FoFiType1C *  ffT1C;
+    FoFiTrueType *ffTT;
+
+    switch (type) {
+    case psConvType1CToType1:
+    case psConvCIDType0CToCIDType0:
+    case psConvCIDType0CToType0:
+        if (!(ffT1C = FoFiType1C::make(fontBuf, fontLen))) {
+            break;
+        }
+        if (type == psConvType1CToType1) {
+            ffT1C->convertToType1(psName->c_str(), NULL, true, outputToGString,
+                                  &out);
+        } else if (type == psConvCIDType0CToCIDType0) {
+            ffT1C->convertToCIDType0(psName->c_str(), NULL, 0, outputToGString,
+                                     &out);
+        } else {
+            ffT1C->convertToType0(psName->c_str(), NULL, 0, outputToGString,
+                                  &out);
+        }
+        delete ffT1C;
+        break;
+
+    default:
+        if (!(ffTT = FoFiTrueType::make(fontBuf, fontLen, 0))) {
+            break;
+        }
+        switch (type) {
+        case psConvOpenTypeT1CToType1:
+            if (ffTT->isOpenTypeCFF()) {
+                ffTT->convertToType1(psName->c_str(), NULL, true,
+                                     outputToGString, &out);
+            }
+            break;
+        case psConvTrueTypeToType42:
+            ffTT->convertToType42(psName->c_str(), enc, codeToGID,
+                                  outputToGString, &out);
+            break;
+        case psConvCIDType2ToCIDType2:
+            ffTT->convertToCIDType2(psName->c_str(), codeToGID, codeToGIDLen,
+                                    needVerticalMetrics, outputToGString, &out);
+            break;
+        case psConvCIDType2ToType0:
+            ffTT->convertToType0(psName->c_str(), codeToGID, codeToGIDLen,
+                                 needVerticalMetrics, outputToGString, &out);
+            break;
+        case psConvCIDType0COTToCIDType0:
+            if (ffTT->isOpenTypeCFF()) {
+                ffTT->convertToCIDType0(psName->c_str(), codeToGID,
+                                        codeToGIDLen, outputToGString, &out);
+            }
+            break;
+        case psConvCIDType0COTToType0:
+            if (ffTT->isOpenTypeCFF()) {
+                ffTT->convertToType0(psName->c_str(), codeToGID, codeToGIDLen,
+                                     outputToGString, &out);
+            }
+            break;
+        default:
+            break;
+        }
+        delete ffTT;
+        break;
+    }
+}
+
 //------------------------------------------------------------------------
 // process colors
 //------------------------------------------------------------------------
@@ -1051,6 +1330,14 @@ static void outputToFile(void *stream, const char *data, int len)
     fwrite(data, 1, len, (FILE *)stream);
 }
 
+// Output is collected in outBuf, and passed to the output function
+// once it grows past this size.
+#define psOutBufSize 65536
+
+// Maximum size of the output held back while font conversions are
+// queued.
+#define psMaxHeldOutput (16 << 20)
+
 PSOutputDev::PSOutputDev(const char *fileName, PDFDoc *docA, int firstPage,
                          int lastPage, PSOutMode modeA, int imgLLXA, int imgLLYA,
                          int imgURXA, int imgURYA, bool manualCtrlA,
@@ -1074,6 +1361,8 @@ PSOutputDev::PSOutputDev(const char *fileName, PDFDoc *docA, int firstPage,
     customColors = NULL;
     haveTextClip = false;
     t3String = NULL;
+    deferFontConversions = false;
+    fontCacheDir = NULL;
 
     // open file or pipe
     if (!strcmp(fileName, "-")) {
@@ -1122,6 +1411,8 @@ PSOutputDev::PSOutputDev(PSOutputFunc outputFuncA, void *outputStreamA,
     customColors = NULL;
     haveTextClip = false;
     t3String = NULL;
+    deferFontConversions = false;
+    fontCacheDir = NULL;
 
     init(outputFuncA, outputStreamA, psGeneric, docA, firstPage, lastPage, modeA,
          imgLLXA, imgLLYA, imgURXA, imgURYA, manualCtrlA);
@@ -1132,17 +1423,16 @@ void PSOutputDev::init(PSOutputFunc outputFuncA, void *outputStreamA,
                        int lastPage, PSOutMode modeA, int imgLLXA, int imgLLYA,
                        int imgURXA, int imgURYA, bool manualCtrlA)
 {
-    Catalog *       catalog;
-    Page *          page;
-    PDFRectangle *  box;
-    PSFontFileInfo *ff;
-    GList *         names;
-    int             pg, w, h, i;
+    Catalog *     catalog;
+    PDFRectangle *box;
+    int           pg;
 
     // initialize
     ok = true;
     outputFunc = outputFuncA;
     outputStream = outputStreamA;
+    outBuf.reserve(psOutBufSize + 4096);
+    fontCacheDir = globalParams->getPSFontCacheDir();
     fileType = fileTypeA;
     doc = docA;
     xref = doc->getXRef();
@@ -1158,33 +1448,22 @@ void PSOutputDev::init(PSOutputFunc outputFuncA, void *outputStreamA,
     if (imgLLX == 0 && imgURX == 0 && imgLLY == 0 && imgURY == 0) {
         globalParams->getPSImageableArea(&imgLLX, &imgLLY, &imgURX, &imgURY);
     }
+    streaming = globalParams->getPSStreaming() && mode == psModePS &&
+                !manualCtrlA;
+    poolFontsOnly = false;
+    numPoolFonts = 0;
+    maxPoolFonts = globalParams->getPSStreamingFontPool() > 0 ?
+                       globalParams->getPSStreamingFontPool() :
+                       0;
     if (paperWidth < 0 || paperHeight < 0) {
         paperMatch = true;
         paperWidth = paperHeight = 1; // in case the document has zero pages
-        for (pg = (firstPage >= 1) ? firstPage : 1;
-             pg <= lastPage && pg <= catalog->getNumPages(); ++pg) {
-            page = catalog->getPage(pg);
-            if (globalParams->getPSUseCropBoxAsPage()) {
-                w = (int)ceil(page->getCropWidth());
-                h = (int)ceil(page->getCropHeight());
-            } else {
-                w = (int)ceil(page->getMediaWidth());
-                h = (int)ceil(page->getMediaHeight());
-            }
-            for (i = 0; i < paperSizes.size(); ++i) {
-                auto &size = paperSizes[i];
-                if (size.w == w && size.h == h) {
-                    break;
-                }
-            }
-            if (i == paperSizes.size()) {
-                paperSizes.push_back(PSOutPaperSize(w, h));
-            }
-            if (w > paperWidth) {
-                paperWidth = w;
-            }
-            if (h > paperHeight) {
-                paperHeight = h;
+        // in streaming mode, the paper sizes are collected by startPage()
+        // and written in the trailer
+        if (!streaming) {
+            for (pg = (firstPage >= 1) ? firstPage : 1;
+                 pg <= lastPage && pg <= catalog->getNumPages(); ++pg) {
+                addPaperSize(catalog->getPage(pg));
             }
         }
         // NB: img{LLX,LLY,URX,URY} will be set by startPage()
@@ -1212,20 +1491,7 @@ void PSOutputDev::init(PSOutputFunc outputFuncA, void *outputStreamA,
     clipURX0 = clipURY0 = -1;
 
     // initialize font lists, etc.
-    for (i = 0; i < 14; ++i) {
-        ff = new PSFontFileInfo(new GString(psBase14SubstFonts[i].psName),
-                                fontType1, psFontFileResident);
-        fontFileInfo->add(ff->psName, ff);
-    }
-    names = globalParams->getPSResidentFonts();
-    for (i = 0; i < names->getLength(); ++i) {
-        if (!fontFileInfo->lookup((GString *)names->get(i))) {
-            ff = new PSFontFileInfo((GString *)names->get(i), fontType1,
-                                    psFontFileResident);
-            fontFileInfo->add(ff->psName, ff);
-        }
-    }
-    delete names;
+    setupResidentFonts();
     imgIDLen = 0;
     imgIDSize = 0;
     formIDLen = 0;
@@ -1262,12 +1528,70 @@ void PSOutputDev::init(PSOutputFunc outputFuncA, void *outputStreamA,
         if (mode != psModeForm) {
             writePS("%%EndSetup\n");
         }
+        if (streaming) {
+            flushPS();
+        }
     }
 
     // initialize sequential page number
     seqPage = 1;
 }
 
+// Add the size of <page> to the list of paper sizes.
+void PSOutputDev::addPaperSize(Page *page)
+{
+    int w, h, i;
+
+    if (globalParams->getPSUseCropBoxAsPage()) {
+        w = (int)ceil(page->getCropWidth());
+        h = (int)ceil(page->getCropHeight());
+    } else {
+        w = (int)ceil(page->getMediaWidth());
+        h = (int)ceil(page->getMediaHeight());
+    }
+    for (i = 0; i < paperSizes.size(); ++i) {
+        auto &size = paperSizes[i];
+        if (size.w == w && size.h == h) {
+            break;
+        }
+    }
+    if (i == paperSizes.size()) {
+        paperSizes.push_back(PSOutPaperSize(w, h));
+    }
+    if (w > paperWidth) {
+        paperWidth = w;
+    }
+    if (h > paperHeight) {
+        paperHeight = h;
+    }
+}
+
+// Add the base 14 substitutes and the psResidentFont fonts to
+// fontFileInfo.
+void PSOutputDev::setupResidentFonts()
+{
+    PSFontFileInfo *ff;
+    GList *         names;
+    int             i;
+
+    for (i = 0; i < 14; ++i) {
+        ff = new PSFontFileInfo(new GString(psBase14SubstFonts[i].psName),
+                                fontType1, psFontFileResident);
+        fontFileInfo->add(ff->psName, ff);
+    }
+    names = globalParams->getPSResidentFonts();
+    for (i = 0; i < names->getLength(); ++i) {
+        if (!fontFileInfo->lookup((GString *)names->get(i))) {
+            ff = new PSFontFileInfo((GString *)names->get(i), fontType1,
+                                    psFontFileResident);
+            fontFileInfo->add(ff->psName, ff);
+        } else {
+            delete (GString *)names->get(i);
+        }
+    }
+    delete names;
+}
+
 PSOutputDev::~PSOutputDev()
 {
     PSOutCustomColor *cc;
@@ -1280,6 +1604,7 @@ PSOutputDev::~PSOutputDev()
                 writePS("%%EOF\n");
             }
         }
+        flushPS();
         if (fileType == psFile) {
             fclose((FILE *)outputStream);
         } else if (fileType == psPipe) {
@@ -1290,6 +1615,12 @@ PSOutputDev::~PSOutputDev()
     if (embFontList) {
         delete embFontList;
     }
+    for (auto conv : fontConversions) {
+        delete conv;
+    }
+    if (fontCacheDir) {
+        delete fontCacheDir;
+    }
     deleteGHash(fontFileInfo, PSFontFileInfo);
     free(imgIDs);
     free(formIDs);
@@ -1302,6 +1633,7 @@ PSOutputDev::~PSOutputDev()
 
 bool PSOutputDev::checkIO()
 {
+    flushPS();
     if (fileType == psFile || fileType == psPipe || fileType == psStdout) {
         if (ferror((FILE *)outputStream)) {
             error(errIO, -1, "Error writing to PostScript file");
@@ -1316,7 +1648,6 @@ void PSOutputDev::writeHeader(int firstPage, int lastPage, PDFRectangle *mediaBo
 {
     Object info, obj1;
     double x1, y1, x2, y2;
-    int    i;
 
     switch (mode) {
     case psModePS:
@@ -1356,18 +1687,12 @@ void PSOutputDev::writeHeader(int firstPage, int lastPage, PDFRectangle *mediaBo
 
     switch (mode) {
     case psModePS:
-        if (paperMatch) {
-            for (i = 0; i < paperSizes.size(); ++i) {
-                auto &size = paperSizes[i];
-
-                writePSFmt("%%{0:s} {1:d}x{2:d} {1:d} {2:d} 0 () ()\n",
-                           i == 0 ? "DocumentMedia:" : "+", size.w, size.h);
-            }
+        if (streaming && paperMatch) {
+            writePS("%%DocumentMedia: (atend)\n");
+            writePS("%%BoundingBox: (atend)\n");
         } else {
-            writePSFmt("%%DocumentMedia: plain {0:d} {1:d} 0 () ()\n", paperWidth,
-                       paperHeight);
+            writeDocumentMedia();
         }
-        writePSFmt("%%BoundingBox: 0 0 {0:d} {1:d}\n", paperWidth, paperHeight);
         writePSFmt("%%Pages: {0:d}\n", lastPage - firstPage + 1);
         writePS("%%EndComments\n");
         if (!paperMatch) {
@@ -1413,6 +1738,24 @@ void PSOutputDev::writeHeader(int firstPage, int lastPage, PDFRectangle *mediaBo
     }
 }
 
+void PSOutputDev::writeDocumentMedia()
+{
+    int i;
+
+    if (paperMatch) {
+        for (i = 0; i < paperSizes.size(); ++i) {
+            auto &size = paperSizes[i];
+
+            writePSFmt("%%{0:s} {1:d}x{2:d} {1:d} {2:d} 0 () ()\n",
+                       i == 0 ? "DocumentMedia:" : "+", size.w, size.h);
+        }
+    } else {
+        writePSFmt("%%DocumentMedia: plain {0:d} {1:d} 0 () ()\n", paperWidth,
+                   paperHeight);
+    }
+    writePSFmt("%%BoundingBox: 0 0 {0:d} {1:d}\n", paperWidth, paperHeight);
+}
+
 void PSOutputDev::writeXpdfProcset()
 {
     bool         lev1, lev2, lev3, sep, nonSep;
@@ -1471,11 +1814,8 @@ void PSOutputDev::writeXpdfProcset()
 
 void PSOutputDev::writeDocSetup(Catalog *catalog, int firstPage, int lastPage)
 {
-    Page *   page;
-    Dict *   resDict;
-    Annots * annots;
     Form *   form;
-    Object   obj1, obj2, obj3;
+    Object   obj1, obj2;
     GString *s;
     int      pg, i, j;
 
@@ -1485,21 +1825,11 @@ void PSOutputDev::writeDocSetup(Catalog *catalog, int firstPage, int lastPage)
     } else {
         writePS("xpdf begin\n");
     }
-    for (pg = firstPage; pg <= lastPage; ++pg) {
-        page = catalog->getPage(pg);
-        if ((resDict = page->getResourceDict())) {
-            setupResources(resDict);
-        }
-        annots = new Annots(doc, page->getAnnots());
-        for (i = 0; i < annots->getNumAnnots(); ++i) {
-            if ((obj1 = annots->getAnnot(i)->getAppearance()).is_stream()) {
-                obj2 = resolve((*obj1.streamGetDict())["Resources"]);
-                if (obj2.is_dict()) {
-                    setupResources(&obj2.as_dict());
-                }
-            }
+    deferFontConversions = true;
+    if (!streaming) {
+        for (pg = firstPage; pg <= lastPage; ++pg) {
+            setupPageResources(catalog->getPage(pg));
         }
-        delete annots;
     }
     if ((form = catalog->getForm())) {
         for (i = 0; i < form->getNumFields(); ++i) {
@@ -1516,6 +1846,8 @@ void PSOutputDev::writeDocSetup(Catalog *catalog, int firstPage, int lastPage)
             }
         }
     }
+    deferFontConversions = false;
+    runFontConversions();
     if (mode != psModeForm) {
         if (mode != psModeEPS && !manualCtrl) {
             writePSFmt("{0:s} pdfSetup\n",
@@ -1543,6 +1875,57 @@ void PSOutputDev::writeDocSetup(Catalog *catalog, int firstPage, int lastPage)
     }
 }
 
+// Set up the resources used by <page> and its annotations.
+void PSOutputDev::setupPageResources(Page *page)
+{
+    Dict *  resDict;
+    Annots *annots;
+    Object  obj1, obj2;
+    int     i;
+
+    if ((resDict = page->getResourceDict())) {
+        setupResources(resDict);
+    }
+    annots = new Annots(doc, page->getAnnots());
+    for (i = 0; i < annots->getNumAnnots(); ++i) {
+        if ((obj1 = annots->getAnnot(i)->getAppearance()).is_stream()) {
+            obj2 = resolve((*obj1.streamGetDict())["Resources"]);
+            if (obj2.is_dict()) {
+                setupResources(&obj2.as_dict());
+            }
+        }
+    }
+    delete annots;
+}
+
+// Drop the fontInfo and fontFileInfo entries set up for the current
+// page, keeping the font pool and the resident fonts.  The PostScript
+// definitions were freed by the page's restore.
+void PSOutputDev::dropPageFonts()
+{
+    std::unordered_set< PSFontFileInfo * > keep;
+    std::vector< PSFontFileInfo * >        drop;
+    GHashIter *                            iter;
+    GString *                              key;
+    void *                                 p;
+
+    fontInfo.erase(fontInfo.begin() + numPoolFonts, fontInfo.end());
+    for (auto &fi : fontInfo) {
+        keep.insert(fi.ff);
+    }
+    fontFileInfo->startIter(&iter);
+    while (fontFileInfo->getNext(&iter, &key, &p)) {
+        auto ff = (PSFontFileInfo *)p;
+        if (ff->loc != psFontFileResident && !keep.count(ff)) {
+            drop.push_back(ff);
+        }
+    }
+    for (auto ff : drop) {
+        fontFileInfo->remove(ff->psName);
+        delete ff;
+    }
+}
+
 void PSOutputDev::writePageTrailer()
 {
     if (mode != psModeForm) {
@@ -1557,6 +1940,9 @@ void PSOutputDev::writeTrailer()
     if (mode == psModeForm) {
         writePS("/Foo exch /Form defineresource pop\n");
     } else {
+        if (streaming && paperMatch) {
+            writeDocumentMedia();
+        }
         writePS("%%DocumentSuppliedResources:\n");
         writePS(embFontList->c_str());
         if (level == psLevel1Sep || level == psLevel2Sep ||
@@ -1601,7 +1987,9 @@ void PSOutputDev::setupResources(Dict *resDict)
     int    i, j;
 
     setupFonts(resDict);
-    setupImages(resDict);
+    if (!poolFontsOnly) {
+        setupImages(resDict);
+    }
 
     //----- recursively scan XObjects
     xObjDict = resolve((*resDict)["XObject"]);
@@ -1735,7 +2123,9 @@ void PSOutputDev::setupResources(Dict *resDict)
         }
     }
 
-    setupForms(resDict);
+    if (!poolFontsOnly) {
+        setupForms(resDict);
+    }
 }
 
 void PSOutputDev::setupFonts(Dict *resDict)
@@ -1752,10 +2142,12 @@ void PSOutputDev::setupFonts(Dict *resDict)
         obj2 = resolve(obj1);
         if (obj2.is_dict()) {
             r = obj1.as_ref();
-            gfxFontDict = new GfxFontDict(xref, &r, &obj2.as_dict());
+            gfxFontDict =
+                new GfxFontDict(xref, &r, obj2, doc->getFontCache());
         }
     } else if (obj1.is_dict()) {
-        gfxFontDict = new GfxFontDict(xref, NULL, &obj1.as_dict());
+        gfxFontDict =
+            new GfxFontDict(xref, NULL, obj1, doc->getFontCache());
     }
     if (gfxFontDict) {
         for (i = 0; i < gfxFontDict->getNumFonts(); ++i) {
@@ -1785,6 +2177,13 @@ void PSOutputDev::setupFont(GfxFont *font, Dict *parentResDict)
         }
     }
 
+    // the font pool is limited in size, and it doesn't take Type 3 fonts,
+    // whose char procs can use the page's images and forms
+    if (poolFontsOnly &&
+        (font->getType() == fontType3 || fontInfo.size() >= maxPoolFonts)) {
+        return;
+    }
+
     // add fontInfo entry
     fontInfo.push_back(*font->getID());
     auto &fi = fontInfo.back();
@@ -1953,6 +2352,17 @@ void PSOutputDev::setupFont(GfxFont *font, Dict *parentResDict)
     }
 }
 
+// Add a font to the %%DocumentSuppliedResources list.  In streaming
+// mode, the same font can be written on several pages.
+void PSOutputDev::addEmbFontName(GString *psName)
+{
+    if (embFontNames.insert(*psName).second) {
+        embFontList->append("%%+ font ");
+        embFontList->append(psName->c_str());
+        embFontList->append("\n");
+    }
+}
+
 PSFontFileInfo *PSOutputDev::setupEmbeddedType1Font(GfxFont *font, Ref *id)
 {
     static char     hexChar[17] = "0123456789abcdef";
@@ -2002,9 +2412,7 @@ PSFontFileInfo *PSOutputDev::setupEmbeddedType1Font(GfxFont *font, Ref *id)
 
     // beginning comment
     writePSFmt("%%BeginResource: font {0:t}\n", psName);
-    embFontList->append("%%+ font ");
-    embFontList->append(psName->c_str());
-    embFontList->append("\n");
+    addEmbFontName(psName);
 
     // check for PFB format
     strObj.streamReset();
@@ -2166,9 +2574,7 @@ PSFontFileInfo *PSOutputDev::setupExternalType1Font(GfxFont *font,
 
     // beginning comment
     writePSFmt("%%BeginResource: font {0:t}\n", psName);
-    embFontList->append("%%+ font ");
-    embFontList->append(psName->c_str());
-    embFontList->append("\n");
+    addEmbFontName(psName);
 
     // open the font file
     if (!(fontFile = fopen(fileName->c_str(), "rb"))) {
@@ -2247,7 +2653,6 @@ PSFontFileInfo *PSOutputDev::setupEmbeddedType1CFont(GfxFont *font, Ref *id)
     PSFontFileInfo *ff;
     char *          fontBuf;
     int             fontLen;
-    FoFiType1C *    ffT1C;
     GHashIter *     iter;
 
     // check if font is already embedded
@@ -2265,18 +2670,12 @@ PSFontFileInfo *PSOutputDev::setupEmbeddedType1CFont(GfxFont *font, Ref *id)
 
     // beginning comment
     writePSFmt("%%BeginResource: font {0:t}\n", psName);
-    embFontList->append("%%+ font ");
-    embFontList->append(psName->c_str());
-    embFontList->append("\n");
+    addEmbFontName(psName);
 
     // convert it to a Type 1 font
     if ((fontBuf = font->readEmbFontFile(xref, &fontLen))) {
-        if ((ffT1C = FoFiType1C::make(fontBuf, fontLen))) {
-            ffT1C->convertToType1(psName->c_str(), NULL, true, outputFunc,
-                                  outputStream);
-            delete ffT1C;
-        }
-        free(fontBuf);
+        addFontConversion(new PSFontConversion(psConvType1CToType1, psName,
+                                               fontBuf, fontLen));
     }
 
     // ending comment
@@ -2294,7 +2693,6 @@ PSFontFileInfo *PSOutputDev::setupEmbeddedOpenTypeT1CFont(GfxFont *font, Ref *id
     PSFontFileInfo *ff;
     char *          fontBuf;
     int             fontLen;
-    FoFiTrueType *  ffTT;
     GHashIter *     iter;
 
     // check if font is already embedded
@@ -2312,20 +2710,12 @@ PSFontFileInfo *PSOutputDev::setupEmbeddedOpenTypeT1CFont(GfxFont *font, Ref *id
 
     // beginning comment
     writePSFmt("%%BeginResource: font {0:t}\n", psName);
-    embFontList->append("%%+ font ");
-    embFontList->append(psName->c_str());
-    embFontList->append("\n");
+    addEmbFontName(psName);
 
     // convert it to a Type 1 font
     if ((fontBuf = font->readEmbFontFile(xref, &fontLen))) {
-        if ((ffTT = FoFiTrueType::make(fontBuf, fontLen, 0))) {
-            if (ffTT->isOpenTypeCFF()) {
-                ffTT->convertToType1(psName->c_str(), NULL, true, outputFunc,
-                                     outputStream);
-            }
-            delete ffTT;
-        }
-        free(fontBuf);
+        addFontConversion(new PSFontConversion(psConvOpenTypeT1CToType1,
+                                               psName, fontBuf, fontLen));
     }
 
     // ending comment
@@ -2339,13 +2729,14 @@ PSFontFileInfo *PSOutputDev::setupEmbeddedOpenTypeT1CFont(GfxFont *font, Ref *id
 
 PSFontFileInfo *PSOutputDev::setupEmbeddedTrueTypeFont(GfxFont *font, Ref *id)
 {
-    GString *       psName;
-    PSFontFileInfo *ff;
-    char *          fontBuf;
-    int             fontLen;
-    FoFiTrueType *  ffTT;
-    int *           codeToGID;
-    GHashIter *     iter;
+    GString *         psName;
+    PSFontFileInfo *  ff;
+    char *            fontBuf;
+    int               fontLen;
+    FoFiTrueType *    ffTT;
+    PSFontConversion *conv;
+    int *             codeToGID;
+    GHashIter *       iter;
 
     // get the code-to-GID mapping
     if (!(fontBuf = font->readEmbFontFile(xref, &fontLen))) {
@@ -2376,18 +2767,17 @@ PSFontFileInfo *PSOutputDev::setupEmbeddedTrueTypeFont(GfxFont *font, Ref *id)
 
     // beginning comment
     writePSFmt("%%BeginResource: font {0:t}\n", psName);
-    embFontList->append("%%+ font ");
-    embFontList->append(psName->c_str());
-    embFontList->append("\n");
+    addEmbFontName(psName);
 
     // convert it to a Type 42 font
-    ffTT->convertToType42(psName->c_str(),
-                          ((Gfx8BitFont *)font)->getHasEncoding() ?
-                              ((Gfx8BitFont *)font)->getEncoding() :
-                              (char **)NULL,
-                          codeToGID, outputFunc, outputStream);
     delete ffTT;
-    free(fontBuf);
+    conv = new PSFontConversion(psConvTrueTypeToType42, psName, fontBuf,
+                                fontLen);
+    if (((Gfx8BitFont *)font)->getHasEncoding()) {
+        conv->setEncoding(((Gfx8BitFont *)font)->getEncoding());
+    }
+    conv->setCodeToGID(codeToGID, 256);
+    addFontConversion(conv);
 
     // ending comment
     writePS("%%EndResource\n");
@@ -2434,16 +2824,14 @@ PSFontFileInfo *PSOutputDev::setupExternalTrueTypeFont(GfxFont *font,
 
     // beginning comment
     writePSFmt("%%BeginResource: font {0:t}\n", psName);
-    embFontList->append("%%+ font ");
-    embFontList->append(psName->c_str());
-    embFontList->append("\n");
+    addEmbFontName(psName);
 
     // convert it to a Type 42 font
     ffTT->convertToType42(psName->c_str(),
                           ((Gfx8BitFont *)font)->getHasEncoding() ?
                               ((Gfx8BitFont *)font)->getEncoding() :
                               (char **)NULL,
-                          codeToGID, outputFunc, outputStream);
+                          codeToGID, outputToBuf, this);
     delete ffTT;
 
     // ending comment
@@ -2463,7 +2851,6 @@ PSFontFileInfo *PSOutputDev::setupEmbeddedCIDType0Font(GfxFont *font, Ref *id)
     PSFontFileInfo *ff;
     char *          fontBuf;
     int             fontLen;
-    FoFiType1C *    ffT1C;
     GHashIter *     iter;
 
     // check if font is already embedded
@@ -2481,25 +2868,15 @@ PSFontFileInfo *PSOutputDev::setupEmbeddedCIDType0Font(GfxFont *font, Ref *id)
 
     // beginning comment
     writePSFmt("%%BeginResource: font {0:t}\n", psName);
-    embFontList->append("%%+ font ");
-    embFontList->append(psName->c_str());
-    embFontList->append("\n");
+    addEmbFontName(psName);
 
-    // convert it to a Type 0 font
+    // convert it to a Type 0 font -- Level 3: use a CID font;
+    // otherwise: use a non-CID composite font
     if ((fontBuf = font->readEmbFontFile(xref, &fontLen))) {
-        if ((ffT1C = FoFiType1C::make(fontBuf, fontLen))) {
-            if (globalParams->getPSLevel() >= psLevel3) {
-                // Level 3: use a CID font
-                ffT1C->convertToCIDType0(psName->c_str(), NULL, 0, outputFunc,
-                                         outputStream);
-            } else {
-                // otherwise: use a non-CID composite font
-                ffT1C->convertToType0(psName->c_str(), NULL, 0, outputFunc,
-                                      outputStream);
-            }
-            delete ffT1C;
-        }
-        free(fontBuf);
+        addFontConversion(new PSFontConversion(
+            globalParams->getPSLevel() >= psLevel3 ? psConvCIDType0CToCIDType0 :
+                                                     psConvCIDType0CToType0,
+            psName, fontBuf, fontLen));
     }
 
     // ending comment
@@ -2515,14 +2892,14 @@ PSFontFileInfo *
 PSOutputDev::setupEmbeddedCIDTrueTypeFont(GfxFont *font, Ref *id,
                                           bool needVerticalMetrics)
 {
-    GString *       psName;
-    PSFontFileInfo *ff;
-    char *          fontBuf;
-    int             fontLen;
-    FoFiTrueType *  ffTT;
-    int *           codeToGID;
-    int             codeToGIDLen;
-    GHashIter *     iter;
+    GString *         psName;
+    PSFontFileInfo *  ff;
+    char *            fontBuf;
+    int               fontLen;
+    PSFontConversion *conv;
+    int *             codeToGID;
+    int               codeToGIDLen;
+    GHashIter *       iter;
 
     // get the code-to-GID mapping
     codeToGID = ((GfxCIDFont *)font)->getCIDToGID();
@@ -2546,27 +2923,18 @@ PSOutputDev::setupEmbeddedCIDTrueTypeFont(GfxFont *font, Ref *id,
 
     // beginning comment
     writePSFmt("%%BeginResource: font {0:t}\n", psName);
-    embFontList->append("%%+ font ");
-    embFontList->append(psName->c_str());
-    embFontList->append("\n");
+    addEmbFontName(psName);
 
-    // convert it to a Type 0 font
+    // convert it to a Type 0 font -- Level 3: use a CID font;
+    // otherwise: use a non-CID composite font
     if ((fontBuf = font->readEmbFontFile(xref, &fontLen))) {
-        if ((ffTT = FoFiTrueType::make(fontBuf, fontLen, 0))) {
-            if (globalParams->getPSLevel() >= psLevel3) {
-                // Level 3: use a CID font
-                ffTT->convertToCIDType2(psName->c_str(), codeToGID, codeToGIDLen,
-                                        needVerticalMetrics, outputFunc,
-                                        outputStream);
-            } else {
-                // otherwise: use a non-CID composite font
-                ffTT->convertToType0(psName->c_str(), codeToGID, codeToGIDLen,
-                                     needVerticalMetrics, outputFunc,
-                                     outputStream);
-            }
-            delete ffTT;
-        }
-        free(fontBuf);
+        conv = new PSFontConversion(globalParams->getPSLevel() >= psLevel3 ?
+                                        psConvCIDType2ToCIDType2 :
+                                        psConvCIDType2ToType0,
+                                    psName, fontBuf, fontLen);
+        conv->setCodeToGID(codeToGID, codeToGIDLen);
+        conv->needVerticalMetrics = needVerticalMetrics;
+        addFontConversion(conv);
     }
 
     // ending comment
@@ -2668,20 +3036,18 @@ PSOutputDev::setupExternalCIDTrueTypeFont(GfxFont *font, GString *fileName,
 
     // beginning comment
     writePSFmt("%%BeginResource: font {0:t}\n", psName);
-    embFontList->append("%%+ font ");
-    embFontList->append(psName->c_str());
-    embFontList->append("\n");
+    addEmbFontName(psName);
 
     // convert it to a Type 0 font
     //~ this should use fontNum to load the correct font
     if (globalParams->getPSLevel() >= psLevel3) {
         // Level 3: use a CID font
         ffTT->convertToCIDType2(psName->c_str(), codeToGID, codeToGIDLen,
-                                needVerticalMetrics, outputFunc, outputStream);
+                                needVerticalMetrics, outputToBuf, this);
     } else {
         // otherwise: use a non-CID composite font
         ffTT->convertToType0(psName->c_str(), codeToGID, codeToGIDLen,
-                             needVerticalMetrics, outputFunc, outputStream);
+                             needVerticalMetrics, outputToBuf, this);
     }
     delete ffTT;
 
@@ -2698,13 +3064,13 @@ PSOutputDev::setupExternalCIDTrueTypeFont(GfxFont *font, GString *fileName,
 
 PSFontFileInfo *PSOutputDev::setupEmbeddedOpenTypeCFFFont(GfxFont *font, Ref *id)
 {
-    GString *       psName;
-    PSFontFileInfo *ff;
-    char *          fontBuf;
-    int             fontLen;
-    FoFiTrueType *  ffTT;
-    GHashIter *     iter;
-    int             n;
+    GString *         psName;
+    PSFontFileInfo *  ff;
+    char *            fontBuf;
+    int               fontLen;
+    PSFontConversion *conv;
+    GHashIter *       iter;
+    int               n;
 
     // check if font is already embedded
     fontFileInfo->startIter(&iter);
@@ -2721,31 +3087,18 @@ PSFontFileInfo *PSOutputDev::setupEmbeddedOpenTypeCFFFont(GfxFont *font, Ref *id
 
     // beginning comment
     writePSFmt("%%BeginResource: font {0:t}\n", psName);
-    embFontList->append("%%+ font ");
-    embFontList->append(psName->c_str());
-    embFontList->append("\n");
+    addEmbFontName(psName);
 
-    // convert it to a Type 0 font
+    // convert it to a Type 0 font -- Level 3: use a CID font;
+    // otherwise: use a non-CID composite font
     if ((fontBuf = font->readEmbFontFile(xref, &fontLen))) {
-        if ((ffTT = FoFiTrueType::make(fontBuf, fontLen, 0))) {
-            if (ffTT->isOpenTypeCFF()) {
-                if (globalParams->getPSLevel() >= psLevel3) {
-                    // Level 3: use a CID font
-                    ffTT->convertToCIDType0(
-                        psName->c_str(), ((GfxCIDFont *)font)->getCIDToGID(),
-                        ((GfxCIDFont *)font)->getCIDToGIDLen(), outputFunc,
-                        outputStream);
-                } else {
-                    // otherwise: use a non-CID composite font
-                    ffTT->convertToType0(psName->c_str(),
-                                         ((GfxCIDFont *)font)->getCIDToGID(),
-                                         ((GfxCIDFont *)font)->getCIDToGIDLen(),
-                                         outputFunc, outputStream);
-                }
-            }
-            delete ffTT;
-        }
-        free(fontBuf);
+        conv = new PSFontConversion(globalParams->getPSLevel() >= psLevel3 ?
+                                        psConvCIDType0COTToCIDType0 :
+                                        psConvCIDType0COTToType0,
+                                    psName, fontBuf, fontLen);
+        conv->setCodeToGID(((GfxCIDFont *)font)->getCIDToGID(),
+                           ((GfxCIDFont *)font)->getCIDToGIDLen());
+        addFontConversion(conv);
     }
 
     // ending comment
@@ -2789,9 +3142,7 @@ PSFontFileInfo *PSOutputDev::setupType3Font(GfxFont *font, Dict *parentResDict)
 
     // beginning comment
     writePSFmt("%%BeginResource: font {0:t}\n", psName);
-    embFontList->append("%%+ font ");
-    embFontList->append(psName->c_str());
-    embFontList->append("\n");
+    addEmbFontName(psName);
 
     // font dictionary
     writePS("8 dict begin\n");
@@ -2835,24 +3186,20 @@ PSFontFileInfo *PSOutputDev::setupType3Font(GfxFont *font, Dict *parentResDict)
             // TODO: anitize interface
             gfx->display(&charProcs->val_at(i));
             if (t3String) {
+                buf = t3String;
+                t3String = NULL;
                 if (t3Cacheable) {
-                    buf = GString::format(
-                        "{0:.6g} {1:.6g} {2:.6g} {3:.6g} {4:.6g} {5:.6g} "
-                        "setcachedevice\n",
-                        t3WX, t3WY, t3LLX, t3LLY, t3URX, t3URY);
+                    writePSFmt("{0:.6g} {1:.6g} {2:.6g} {3:.6g} {4:.6g} {5:.6g} "
+                               "setcachedevice\n",
+                               t3WX, t3WY, t3LLX, t3LLY, t3URX, t3URY);
                 } else {
-                    buf = GString::format("{0:.6g} {1:.6g} setcharwidth\n", t3WX,
-                                          t3WY);
+                    writePSFmt("{0:.6g} {1:.6g} setcharwidth\n", t3WX, t3WY);
                 }
-                (*outputFunc)(outputStream, buf->c_str(), buf->getLength());
+                writePSBlock(buf->c_str(), buf->getLength());
                 delete buf;
-                (*outputFunc)(outputStream, t3String->c_str(),
-                              t3String->getLength());
-                delete t3String;
-                t3String = NULL;
             }
             if (t3NeedsRestore) {
-                (*outputFunc)(outputStream, "Q\n", 2);
+                writePS("Q\n");
             }
             writePS("} def\n");
         }
@@ -3218,26 +3565,26 @@ bool PSOutputDev::checkPageSlice(Page *page, double hDPI, double vDPI,
 {
     bool             mono;
     bool             useLZW;
+    bool             skipBlank;
     double           dpi;
     SplashOutputDev *splashOut;
     SplashColor      paperColor;
     PDFRectangle     box;
     GfxState *       state;
-    SplashBitmap *   bitmap;
-    Stream *         str0, *str;
-    Object           obj;
-    unsigned char *  p;
-    unsigned char    col[4];
-    char             buf[4096];
+    SplashBitmap *   bitmap, *prevBitmap;
+    std::thread      writer;
     double           hDPI2, vDPI2;
-    double           m0, m1, m2, m3, m4, m5;
     int              nStripes, stripeH, stripeY;
-    int              w, h, x, y, comp, i, n;
+    int              nThreads;
 
     // get the rasterization parameters
     dpi = globalParams->getPSRasterResolution();
     mono = globalParams->getPSRasterMono();
     useLZW = globalParams->getPSLZW();
+    skipBlank = globalParams->getPSRasterSkipBlank();
+    if ((nThreads = globalParams->getPSRasterThreads()) <= 0) {
+        nThreads = (int)std::thread::hardware_concurrency();
+    }
 
     // start the PS page
     page->makeBox(dpi, dpi, rotateA, useMediaBox, false, sliceX, sliceY, sliceW,
@@ -3271,6 +3618,7 @@ bool PSOutputDev::checkPageSlice(Page *page, double hDPI, double vDPI,
                                         false,
                                         globalParams->getAntialiasPrinting());
     }
+    splashOut->setRasterThreads(nThreads);
     splashOut->startDoc(xref);
 
     // break the page into stripes
@@ -3290,141 +3638,40 @@ bool PSOutputDev::checkPageSlice(Page *page, double hDPI, double vDPI,
                          (double)globalParams->getPSRasterSliceSize());
     stripeH = (sliceH + nStripes - 1) / nStripes;
 
-    // render the stripes
+    // render the stripes -- with more than one thread, each stripe is
+    // written out on a separate thread while the next one is being
+    // rasterized (nothing else is written to the PS output in the
+    // meantime)
+    prevBitmap = NULL;
     for (stripeY = sliceY; stripeY < sliceH; stripeY += stripeH) {
         // rasterize a stripe
         page->makeBox(hDPI2, vDPI2, 0, useMediaBox, false, sliceX, stripeY,
                       sliceW, stripeH, &box, &crop);
-        m0 = box.x2 - box.x1;
-        m1 = 0;
-        m2 = 0;
-        m3 = box.y2 - box.y1;
-        m4 = box.x1;
-        m5 = box.y1;
         page->displaySlice(splashOut, hDPI2, vDPI2,
                            (360 - page->getRotate()) % 360, useMediaBox, crop,
                            sliceX, stripeY, sliceW, stripeH, printing,
                            abortCheckCbk, abortCheckCbkData);
+        bitmap = splashOut->takeBitmap();
+
+        // wait for the previous stripe to be written
+        if (writer.joinable()) {
+            writer.join();
+        }
+        delete prevBitmap;
 
         // draw the rasterized image
-        bitmap = splashOut->getBitmap();
-        w = bitmap->getWidth();
-        h = bitmap->getHeight();
-        writePS("gsave\n");
-        writePSFmt("[{0:.6g} {1:.6g} {2:.6g} {3:.6g} {4:.6g} {5:.6g}] concat\n",
-                   m0, m1, m2, m3, m4, m5);
-        switch (level) {
-        case psLevel1:
-            writePSFmt("{0:d} {1:d} 8 [{2:d} 0 0 {3:d} 0 {4:d}] pdfIm1\n", w, h,
-                       w, -h, h);
-            p = bitmap->getDataPtr() + (h - 1) * bitmap->getRowSize();
-            i = 0;
-            for (y = 0; y < h; ++y) {
-                for (x = 0; x < w; ++x) {
-                    writePSFmt("{0:02x}", *p++);
-                    if (++i == 32) {
-                        writePSChar('\n');
-                        i = 0;
-                    }
-                }
-            }
-            if (i != 0) {
-                writePSChar('\n');
-            }
-            break;
-        case psLevel1Sep:
-            writePSFmt("{0:d} {1:d} 8 [{2:d} 0 0 {3:d} 0 {4:d}] pdfIm1Sep\n", w,
-                       h, w, -h, h);
-            p = bitmap->getDataPtr() + (h - 1) * bitmap->getRowSize();
-            i = 0;
-            col[0] = col[1] = col[2] = col[3] = 0;
-            for (y = 0; y < h; ++y) {
-                for (comp = 0; comp < 4; ++comp) {
-                    for (x = 0; x < w; ++x) {
-                        writePSFmt("{0:02x}", p[4 * x + comp]);
-                        col[comp] |= p[4 * x + comp];
-                        if (++i == 32) {
-                            writePSChar('\n');
-                            i = 0;
-                        }
-                    }
-                }
-                p -= bitmap->getRowSize();
-            }
-            if (i != 0) {
-                writePSChar('\n');
-            }
-            if (col[0]) {
-                processColors |= psProcessCyan;
-            }
-            if (col[1]) {
-                processColors |= psProcessMagenta;
-            }
-            if (col[2]) {
-                processColors |= psProcessYellow;
-            }
-            if (col[3]) {
-                processColors |= psProcessBlack;
-            }
-            break;
-        case psLevel2:
-        case psLevel2Sep:
-        case psLevel3:
-        case psLevel3Sep:
-            if (mono) {
-                writePS("/DeviceGray setcolorspace\n");
-            } else {
-                writePS("/DeviceRGB setcolorspace\n");
-            }
-            writePS("<<\n  /ImageType 1\n");
-            writePSFmt("  /Width {0:d}\n", bitmap->getWidth());
-            writePSFmt("  /Height {0:d}\n", bitmap->getHeight());
-            writePSFmt("  /ImageMatrix [{0:d} 0 0 {1:d} 0 {2:d}]\n", w, -h, h);
-            writePS("  /BitsPerComponent 8\n");
-            if (mono) {
-                writePS("  /Decode [0 1]\n");
-            } else {
-                writePS("  /Decode [0 1 0 1 0 1]\n");
-            }
-            writePS("  /DataSource currentfile\n");
-            if (globalParams->getPSASCIIHex()) {
-                writePS("    /ASCIIHexDecode filter\n");
-            } else {
-                writePS("    /ASCII85Decode filter\n");
-            }
-            if (useLZW) {
-                writePS("    /LZWDecode filter\n");
-            } else {
-                writePS("    /RunLengthDecode filter\n");
-            }
-            writePS(">>\n");
-            writePS("image\n");
-            obj = {};
-            p = bitmap->getDataPtr() + (h - 1) * bitmap->getRowSize();
-            str0 = new MemStream((char *)p, 0, w * h * (mono ? 1 : 3), &obj);
-            if (useLZW) {
-                str = new LZWEncoder(str0);
-            } else {
-                str = new RunLengthEncoder(str0);
-            }
-            if (globalParams->getPSASCIIHex()) {
-                str = new ASCIIHexEncoder(str);
-            } else {
-                str = new ASCII85Encoder(str);
-            }
-            str->reset();
-            while ((n = str->readblock(buf, sizeof(buf))) > 0) {
-                writePSBlock(buf, n);
-            }
-            str->close();
-            delete str;
-            delete str0;
-            writePSChar('\n');
-            processColors |= mono ? psProcessBlack : psProcessCMYK;
-            break;
+        if (nThreads > 1) {
+            writer = std::thread(&PSOutputDev::writeRasterStripe, this, bitmap,
+                                 box, mono, useLZW, skipBlank);
+        } else {
+            writeRasterStripe(bitmap, box, mono, useLZW, skipBlank);
         }
-        writePS("grestore\n");
+        prevBitmap = bitmap;
+    }
+    if (writer.joinable()) {
+        writer.join();
     }
+    delete prevBitmap;
 
     delete splashOut;
 
@@ -3434,6 +3681,189 @@ bool PSOutputDev::checkPageSlice(Page *page, double hDPI, double vDPI,
     return false;
 }
 
+// Returns true if all color components in <bitmap> are equal to
+// <paper>, i.e., nothing was drawn on it.
+static bool isBlankBitmap(SplashBitmap *bitmap, unsigned char paper)
+{
+    unsigned char *p;
+    int            n, x, y;
+
+    n = bitmap->getWidth() * splashColorModeNComps[bitmap->getMode()];
+    for (y = 0; y < bitmap->getHeight(); ++y) {
+        p = bitmap->getDataPtr() + y * bitmap->getRowSize();
+        for (x = 0; x < n; ++x) {
+            if (p[x] != paper) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Write one rasterized stripe, mapped onto <box>, as an image.  If
+// <skipBlank> is set, and nothing was drawn on the stripe, it is
+// written as a single fill with the paper color instead.
+void PSOutputDev::writeRasterStripe(SplashBitmap *bitmap, PDFRectangle box,
+                                    bool mono, bool useLZW, bool skipBlank)
+{
+    static const char hexChars[17] = "0123456789abcdef";
+    Stream *          str0, *str;
+    Object            obj;
+    unsigned char *   p;
+    unsigned char     col[4], paper;
+    char              buf[4096];
+    double            m0, m1, m2, m3, m4, m5;
+    int               w, h, x, y, comp, i, n;
+
+    m0 = box.x2 - box.x1;
+    m1 = 0;
+    m2 = 0;
+    m3 = box.y2 - box.y1;
+    m4 = box.x1;
+    m5 = box.y1;
+    w = bitmap->getWidth();
+    h = bitmap->getHeight();
+    writePS("gsave\n");
+    writePSFmt("[{0:.6g} {1:.6g} {2:.6g} {3:.6g} {4:.6g} {5:.6g}] concat\n", m0,
+               m1, m2, m3, m4, m5);
+
+    if (skipBlank) {
+        paper = 0xff;
+#if SPLASH_CMYK
+        if (bitmap->getMode() == splashModeCMYK8) {
+            paper = 0;
+        }
+#endif
+        if (isBlankBitmap(bitmap, paper)) {
+            if (paper) {
+                writePS("1 setgray 0 0 1 1 re fill\n");
+            } else {
+                writePS("0 0 0 0 setcmykcolor 0 0 1 1 re fill\n");
+            }
+            writePS("grestore\n");
+            return;
+        }
+    }
+
+    switch (level) {
+    case psLevel1:
+        writePSFmt("{0:d} {1:d} 8 [{2:d} 0 0 {3:d} 0 {4:d}] pdfIm1\n", w, h, w,
+                   -h, h);
+        p = bitmap->getDataPtr() + (h - 1) * bitmap->getRowSize();
+        i = 0;
+        for (y = 0; y < h; ++y) {
+            for (x = 0; x < w; ++x) {
+                buf[i++] = hexChars[*p >> 4];
+                buf[i++] = hexChars[*p++ & 0x0f];
+                if (i == 64) {
+                    buf[i++] = '\n';
+                    writePSBlock(buf, i);
+                    i = 0;
+                }
+            }
+        }
+        if (i != 0) {
+            buf[i++] = '\n';
+            writePSBlock(buf, i);
+        }
+        break;
+    case psLevel1Sep:
+        writePSFmt("{0:d} {1:d} 8 [{2:d} 0 0 {3:d} 0 {4:d}] pdfIm1Sep\n", w, h,
+                   w, -h, h);
+        p = bitmap->getDataPtr() + (h - 1) * bitmap->getRowSize();
+        i = 0;
+        col[0] = col[1] = col[2] = col[3] = 0;
+        for (y = 0; y < h; ++y) {
+            for (comp = 0; comp < 4; ++comp) {
+                for (x = 0; x < w; ++x) {
+                    buf[i++] = hexChars[p[4 * x + comp] >> 4];
+                    buf[i++] = hexChars[p[4 * x + comp] & 0x0f];
+                    col[comp] |= p[4 * x + comp];
+                    if (i == 64) {
+                        buf[i++] = '\n';
+                        writePSBlock(buf, i);
+                        i = 0;
+                    }
+                }
+            }
+            p -= bitmap->getRowSize();
+        }
+        if (i != 0) {
+            buf[i++] = '\n';
+            writePSBlock(buf, i);
+        }
+        if (col[0]) {
+            processColors |= psProcessCyan;
+        }
+        if (col[1]) {
+            processColors |= psProcessMagenta;
+        }
+        if (col[2]) {
+            processColors |= psProcessYellow;
+        }
+        if (col[3]) {
+            processColors |= psProcessBlack;
+        }
+        break;
+    case psLevel2:
+    case psLevel2Sep:
+    case psLevel3:
+    case psLevel3Sep:
+        if (mono) {
+            writePS("/DeviceGray setcolorspace\n");
+        } else {
+            writePS("/DeviceRGB setcolorspace\n");
+        }
+        writePS("<<\n  /ImageType 1\n");
+        writePSFmt("  /Width {0:d}\n", w);
+        writePSFmt("  /Height {0:d}\n", h);
+        writePSFmt("  /ImageMatrix [{0:d} 0 0 {1:d} 0 {2:d}]\n", w, -h, h);
+        writePS("  /BitsPerComponent 8\n");
+        if (mono) {
+            writePS("  /Decode [0 1]\n");
+        } else {
+            writePS("  /Decode [0 1 0 1 0 1]\n");
+        }
+        writePS("  /DataSource currentfile\n");
+        if (globalParams->getPSASCIIHex()) {
+            writePS("    /ASCIIHexDecode filter\n");
+        } else {
+            writePS("    /ASCII85Decode filter\n");
+        }
+        if (useLZW) {
+            writePS("    /LZWDecode filter\n");
+        } else {
+            writePS("    /RunLengthDecode filter\n");
+        }
+        writePS(">>\n");
+        writePS("image\n");
+        obj = {};
+        p = bitmap->getDataPtr() + (h - 1) * bitmap->getRowSize();
+        str0 = new MemStream((char *)p, 0, w * h * (mono ? 1 : 3), &obj);
+        if (useLZW) {
+            str = new LZWEncoder(str0);
+        } else {
+            str = new RunLengthEncoder(str0);
+        }
+        if (globalParams->getPSASCIIHex()) {
+            str = new ASCIIHexEncoder(str);
+        } else {
+            str = new ASCII85Encoder(str);
+        }
+        str->reset();
+        while ((n = str->readblock(buf, sizeof(buf))) > 0) {
+            writePSBlock(buf, n);
+        }
+        str->close();
+        delete str;
+        delete str0;
+        writePSChar('\n');
+        processColors |= mono ? psProcessBlack : psProcessCMYK;
+        break;
+    }
+    writePS("grestore\n");
+}
+
 void PSOutputDev::startPage(int pageNum, GfxState *state)
 {
     Page *   page;
@@ -3446,6 +3876,9 @@ void PSOutputDev::startPage(int pageNum, GfxState *state)
         writePSFmt("%%Page: {0:d} {1:d}\n", pageNum, seqPage);
         if (paperMatch) {
             page = doc->getCatalog()->getPage(pageNum);
+            if (streaming) {
+                addPaperSize(page);
+            }
             imgLLX = imgLLY = 0;
             if (globalParams->getPSUseCropBoxAsPage()) {
                 imgURX = (int)ceil(page->getCropWidth());
@@ -3468,6 +3901,28 @@ void PSOutputDev::startPage(int pageNum, GfxState *state)
         writePS("xpdf begin\n");
     }
 
+    // in streaming mode, the page's resources are set up here, instead
+    // of in the document setup -- fonts that fit in the font pool are
+    // set up first, and kept for the following pages; the rest of the
+    // page is wrapped in save/restore, to free everything else (the
+    // paper setup comes before the save, so that the restore doesn't
+    // undo it, and a page with the same size doesn't set it up again)
+    if (streaming) {
+        page = doc->getCatalog()->getPage(pageNum);
+        deferFontConversions = true;
+        poolFontsOnly = true;
+        setupPageResources(page);
+        poolFontsOnly = false;
+        numPoolFonts = fontInfo.size();
+        if (paperMatch) {
+            writePSFmt("{0:d} {1:d} pdfSetupPaper\n", imgURX, imgURY);
+        }
+        writePS("userdict /pdfPageSave save put\n");
+        setupPageResources(page);
+        deferFontConversions = false;
+        runFontConversions();
+    }
+
     // underlays
     if (underlayCbk) {
         (*underlayCbk)(this, underlayCbkData);
@@ -3521,7 +3976,7 @@ void PSOutputDev::startPage(int pageNum, GfxState *state)
         }
         writePSFmt("%%PageOrientation: {0:s}\n",
                    landscape ? "Landscape" : "Portrait");
-        if (paperMatch) {
+        if (paperMatch && !streaming) {
             writePSFmt("{0:d} {1:d} pdfSetupPaper\n", imgURX, imgURY);
         }
         writePS("pdfStartPage\n");
@@ -3668,8 +4123,20 @@ void PSOutputDev::endPage()
         }
         writePS("%%PageTrailer\n");
         writePageTrailer();
+        if (streaming) {
+            writePS("userdict /pdfPageSave get restore\n");
+        }
         writePS("end\n");
     }
+    flushPS();
+
+    // in streaming mode, drop the page's resources (other than the font
+    // pool) -- a later page that uses any of them will set them up again
+    if (streaming) {
+        dropPageFonts();
+        imgIDLen = 0;
+        formIDLen = 0;
+    }
 }
 
 void PSOutputDev::saveState(GfxState *state)
@@ -6678,12 +7145,105 @@ void PSOutputDev::cvtFunction(const Function &func)
     writePSBlock(str.c_str(), str.size());
 }
 
+void PSOutputDev::flushPS()
+{
+    // output that follows a queued font conversion is held until the
+    // conversions are run -- unless there is too much of it
+    if (!fontConversions.empty()) {
+        if (outBuf.size() >= psMaxHeldOutput) {
+            runFontConversions();
+        }
+        return;
+    }
+    if (!outBuf.empty()) {
+        (*outputFunc)(outputStream, outBuf.c_str(), (int)outBuf.size());
+        outBuf.clear();
+    }
+}
+
+// PSOutputFunc that appends to the output buffer -- this is handed to
+// the FoFi font converters in place of outputFunc.
+void PSOutputDev::outputToBuf(void *stream, const char *data, int len)
+{
+    ((PSOutputDev *)stream)->writePSBlock(data, len);
+}
+
+// Convert an embedded font, and write it out.  During the document
+// setup, the conversion is only queued, to be run (along with the
+// others) by runFontConversions().
+void PSOutputDev::addFontConversion(PSFontConversion *conv)
+{
+    if (!deferFontConversions) {
+        conv->run(fontCacheDir);
+        writePSBlock(conv->out.c_str(), (int)conv->out.size());
+        delete conv;
+        return;
+    }
+    if (fontConversions.empty()) {
+        flushPS();
+    } else {
+        fontConversions.back()->after.swap(outBuf);
+    }
+    fontConversions.push_back(conv);
+}
+
+static void runFontConversionsThread(std::vector< PSFontConversion * > *convs,
+                                     GString *cacheDir, std::atomic< int > *next)
+{
+    int i;
+
+    while ((i = (*next)++) < (int)convs->size()) {
+        (*convs)[i]->run(cacheDir);
+    }
+}
+
+// Run the queued font conversions on several threads, and splice
+// their output back in, in order.
+void PSOutputDev::runFontConversions()
+{
+    std::vector< PSFontConversion * > convs;
+    std::vector< std::thread >        threads;
+    std::atomic< int >                next;
+    int                               nThreads, i;
+
+    if (fontConversions.empty()) {
+        return;
+    }
+    convs.swap(fontConversions);
+    convs.back()->after.swap(outBuf);
+
+    if ((nThreads = globalParams->getPSFontThreads()) <= 0) {
+        nThreads = (int)std::thread::hardware_concurrency();
+    }
+    if (nThreads > (int)convs.size()) {
+        nThreads = (int)convs.size();
+    }
+    next = 0;
+    for (i = 1; i < nThreads; ++i) {
+        threads.emplace_back(runFontConversionsThread, &convs, fontCacheDir,
+                             &next);
+    }
+    runFontConversionsThread(&convs, fontCacheDir, &next);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (auto conv : convs) {
+        writePSBlock(conv->out.c_str(), (int)conv->out.size());
+        writePSBlock(conv->after.c_str(), (int)conv->after.size());
+        delete conv;
+    }
+}
+
 void PSOutputDev::writePSChar(char c)
 {
     if (t3String) {
         t3String->append(1UL, c);
     } else {
-        (*outputFunc)(outputStream, &c, 1);
+        outBuf.append(1UL, c);
+        if (outBuf.size() >= psOutBufSize) {
+            flushPS();
+        }
     }
 }
 
@@ -6691,8 +7251,15 @@ void PSOutputDev::writePSBlock(const char *s, int len)
 {
     if (t3String) {
         t3String->append(s, len);
-    } else {
+    } else if (len >= psOutBufSize && fontConversions.empty()) {
+        // large blocks bypass the buffer
+        flushPS();
         (*outputFunc)(outputStream, s, len);
+    } else {
+        outBuf.append(s, len);
+        if (outBuf.size() >= psOutBufSize) {
+            flushPS();
+        }
     }
 }
 
@@ -6701,22 +7268,26 @@ void PSOutputDev::writePS(const char *s)
     if (t3String) {
         t3String->append(s);
     } else {
-        (*outputFunc)(outputStream, s, (int)strlen(s));
+        outBuf.append(s);
+        if (outBuf.size() >= psOutBufSize) {
+            flushPS();
+        }
     }
 }
 
 void PSOutputDev::writePSFmt(const char *fmt, ...)
 {
-    va_list  args;
-    GString *buf;
+    va_list args;
 
     va_start(args, fmt);
     if (t3String) {
         t3String->appendfv((char *)fmt, args);
     } else {
-        buf = GString::formatv((char *)fmt, args);
-        (*outputFunc)(outputStream, buf->c_str(), buf->getLength());
-        delete buf;
+        // format in place, without a temporary string
+        outBuf.appendfv((char *)fmt, args);
+        if (outBuf.size() >= psOutBufSize) {
+            flushPS();
+        }
     }
     va_end(args);
 }
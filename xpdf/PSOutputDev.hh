@@ -7,6 +7,8 @@
 #include <defs.hh>
 
 #include <cstddef>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 #include <xpdf/function.hh>
@@ -25,6 +27,7 @@ class PDFRectangle;
 class PSOutCustomColor;
 class PSOutputDev;
 class PSFontFileInfo;
+class SplashBitmap;
 
 //------------------------------------------------------------------------
 // PSOutputDev
@@ -48,6 +51,7 @@ typedef GString *(*PSOutCustomCodeCbk)(PSOutputDev *           psOut,
                                        void *data);
 
 class PSFontInfo;
+class PSFontConversion;
 struct PSOutPaperSize;
 
 class PSOutputDev : public OutputDev
@@ -268,6 +272,16 @@ private:
               PDFDoc *docA, int firstPage, int lastPage, PSOutMode modeA,
               int imgLLXA, int imgLLYA, int imgURXA, int imgURYA,
               bool manualCtrlA);
+    void flushPS();
+    void addPaperSize(Page *page);
+    void writeDocumentMedia();
+    void setupResidentFonts();
+    void setupPageResources(Page *page);
+    void dropPageFonts();
+    void addEmbFontName(GString *psName);
+    static void outputToBuf(void *stream, const char *data, int len);
+    void addFontConversion(PSFontConversion *conv);
+    void runFontConversions();
     void setupResources(Dict *resDict);
     void setupFonts(Dict *resDict);
     void setupFont(GfxFont *font, Dict *parentResDict);
@@ -291,6 +305,8 @@ private:
     void            setupImage(Ref id, Stream *str, bool mask);
     void            setupForms(Dict *resDict);
     void            setupForm(Object *strRef, Object *strObj);
+    void            writeRasterStripe(SplashBitmap *bitmap, PDFRectangle box,
+                                      bool mono, bool useLZW, bool skipBlank);
     void            addProcessColor(double c, double m, double y, double k);
     void            addCustomColor(GfxSeparationColorSpace *sepCS);
     void            doPath(GfxPath *path);
@@ -328,9 +344,23 @@ private:
         imgURX, imgURY;
     bool preload; // load all images into memory, and
         //   predefine forms
+    bool streaming; // set up resources in each page's setup,
+        //   and drop them after the page
+    bool   poolFontsOnly; // set up only the fonts kept across pages
+        //   (streaming mode)
+    size_t numPoolFonts; // number of fontInfo entries kept across
+        //   pages (streaming mode)
+    size_t maxPoolFonts; // max number of fontInfo entries kept
+        //   across pages (streaming mode)
 
     PSOutputFunc outputFunc;
     void *       outputStream;
+    GString      outBuf; // output not yet passed to outputFunc
+    std::vector< PSFontConversion * > fontConversions; // queued font
+        //   conversions
+    bool     deferFontConversions; // queue font conversions (during the
+        //   document setup)
+    GString *fontCacheDir; // directory for converted fonts, or NULL
     PSFileType   fileType; // file / pipe / stdout
     bool         manualCtrl;
     int          seqPage; // current sequential page number
@@ -383,6 +413,7 @@ private:
         epsX2, epsY2;
 
     GString *embFontList; // resource comments for embedded fonts
+    std::unordered_set< std::string > embFontNames; // fonts in embFontList
 
     int processColors; // used process colors
     PSOutCustomColor // used custom colors
@@ -6,6 +6,11 @@
 #include <climits>
 #include <cmath>
 #include <cstring>
+#include <functional>
+#include <list>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <utils/path.hh>
 
@@ -13,6 +18,7 @@
 
 #include <splash/Splash.hh>
 #include <splash/SplashBitmap.hh>
+#include <splash/SplashBitmapPool.hh>
 #include <splash/SplashErrorCodes.hh>
 #include <splash/SplashFont.hh>
 #include <splash/SplashFontEngine.hh>
@@ -21,6 +27,7 @@
 #include <splash/SplashGlyphBitmap.hh>
 #include <splash/SplashPath.hh>
 #include <splash/SplashPattern.hh>
+#include <splash/SplashSIMD.hh>
 #include <splash/SplashScreen.hh>
 #include <splash/SplashState.hh>
 
@@ -37,13 +44,6 @@
 #include <xpdf/SplashOutputDev.hh>
 #include <xpdf/obj.hh>
 
-//------------------------------------------------------------------------
-
-// Type 3 font cache size parameters
-#define type3FontCacheAssoc 8
-#define type3FontCacheMaxSets 8
-#define type3FontCacheSize (128 * 1024)
-
 //------------------------------------------------------------------------
 // Blend functions
 //------------------------------------------------------------------------
@@ -314,6 +314,7 @@ static void splashOutBlendHue(SplashColorPtr src, SplashColorPtr dest,
         break;
     case splashModeRGB8:
     case splashModeBGR8:
+    case splashModeXBGR8:
         setSat(src[0], src[1], src[2], getSat(dest[0], dest[1], dest[2]), &r0,
                &g0, &b0);
         setLum(r0, g0, b0, getLum(dest[0], dest[1], dest[2]), &blend[0],
@@ -349,6 +350,7 @@ static void splashOutBlendSaturation(SplashColorPtr src, SplashColorPtr dest,
         break;
     case splashModeRGB8:
     case splashModeBGR8:
+    case splashModeXBGR8:
         setSat(dest[0], dest[1], dest[2], getSat(src[0], src[1], src[2]), &r0,
                &g0, &b0);
         setLum(r0, g0, b0, getLum(dest[0], dest[1], dest[2]), &blend[0],
@@ -383,6 +385,7 @@ static void splashOutBlendColor(SplashColorPtr src, SplashColorPtr dest,
         break;
     case splashModeRGB8:
     case splashModeBGR8:
+    case splashModeXBGR8:
         setLum(src[0], src[1], src[2], getLum(dest[0], dest[1], dest[2]),
                &blend[0], &blend[1], &blend[2]);
         break;
@@ -414,6 +417,7 @@ static void splashOutBlendLuminosity(SplashColorPtr src, SplashColorPtr dest,
         break;
     case splashModeRGB8:
     case splashModeBGR8:
+    case splashModeXBGR8:
         setLum(dest[0], dest[1], dest[2], getLum(src[0], src[1], src[2]),
                &blend[0], &blend[1], &blend[2]);
         break;
@@ -449,6 +453,196 @@ SplashBlendFunc splashOutBlendFuncs[] = { NULL,
                                           &splashOutBlendColor,
                                           &splashOutBlendLuminosity };
 
+//------------------------------------------------------------------------
+// Span blend functions
+//------------------------------------------------------------------------
+
+// These compute the same values as the separable blend functions above,
+// for a run of values of one color component.
+
+SPLASH_SPAN_KERNEL
+static void splashOutBlendMultiplySpan(unsigned char *src, unsigned char *dest,
+                                       unsigned char *blend, int n)
+{
+    SplashVecI32 s, d;
+    int          i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        s = splashVecLoad(src + i);
+        d = splashVecLoad(dest + i);
+        splashVecStore(blend + i, splashVecDivT255(d * s));
+    }
+}
+
+SPLASH_SPAN_KERNEL
+static void splashOutBlendScreenSpan(unsigned char *src, unsigned char *dest,
+                                     unsigned char *blend, int n)
+{
+    SplashVecI32 s, d;
+    int          i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        s = splashVecLoad(src + i);
+        d = splashVecLoad(dest + i);
+        splashVecStore(blend + i, d + s - splashVecDivT255(d * s));
+    }
+}
+
+SPLASH_SPAN_KERNEL
+static void splashOutBlendOverlaySpan(unsigned char *src, unsigned char *dest,
+                                      unsigned char *blend, int n)
+{
+    SplashVecI32 s, d;
+    int          i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        s = splashVecLoad(src + i);
+        d = splashVecLoad(dest + i);
+        splashVecStore(blend + i,
+                       d < 0x80 ? splashVecDivT255(s * 2 * d) :
+                                  255 - splashVecDivT255(2 * (255 - s) *
+                                                         (255 - d)));
+    }
+}
+
+SPLASH_SPAN_KERNEL
+static void splashOutBlendDarkenSpan(unsigned char *src, unsigned char *dest,
+                                     unsigned char *blend, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        splashVecStore(blend + i, splashVecMin(splashVecLoad(dest + i),
+                                               splashVecLoad(src + i)));
+    }
+}
+
+SPLASH_SPAN_KERNEL
+static void splashOutBlendLightenSpan(unsigned char *src, unsigned char *dest,
+                                      unsigned char *blend, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        splashVecStore(blend + i, splashVecMax(splashVecLoad(dest + i),
+                                               splashVecLoad(src + i)));
+    }
+}
+
+SPLASH_SPAN_KERNEL
+static void splashOutBlendColorDodgeSpan(unsigned char *src,
+                                         unsigned char *dest,
+                                         unsigned char *blend, int n)
+{
+    SplashVecI32 s, d, x;
+    int          i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        s = splashVecLoad(src + i);
+        d = splashVecLoad(dest + i);
+        // 255 - s is zero only where s == 255, where x becomes 0
+        x = splashVecMin(splashVecDiv(d * 255, 255 - s), splashVecSplat(255));
+        x = s == 255 ? splashVecSplat(255) : x;
+        splashVecStore(blend + i, d == 0 ? splashVecSplat(0) : x);
+    }
+}
+
+SPLASH_SPAN_KERNEL
+static void splashOutBlendColorBurnSpan(unsigned char *src, unsigned char *dest,
+                                        unsigned char *blend, int n)
+{
+    SplashVecI32 s, d, x;
+    int          i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        s = splashVecLoad(src + i);
+        d = splashVecLoad(dest + i);
+        // s is zero only where the result is 0 or 255 anyway
+        x = 255 - splashVecMin(splashVecDiv((255 - d) * 255, s),
+                               splashVecSplat(255));
+        x = s == 0 ? splashVecSplat(0) : x;
+        splashVecStore(blend + i, d == 255 ? splashVecSplat(255) : x);
+    }
+}
+
+SPLASH_SPAN_KERNEL
+static void splashOutBlendHardLightSpan(unsigned char *src, unsigned char *dest,
+                                        unsigned char *blend, int n)
+{
+    SplashVecI32 s, d;
+    int          i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        s = splashVecLoad(src + i);
+        d = splashVecLoad(dest + i);
+        splashVecStore(blend + i,
+                       s < 0x80 ? splashVecDivT255(d * 2 * s) :
+                                  255 - splashVecDivT255(2 * (255 - d) *
+                                                         (255 - s)));
+    }
+}
+
+static void splashOutBlendSoftLightSpan(unsigned char *src, unsigned char *dest,
+                                        unsigned char *blend, int n)
+{
+    int i;
+
+    // the square root doesn't vectorize well, so this one stays scalar
+    for (i = 0; i < n; ++i) {
+        splashOutBlendSoftLight(src + i, dest + i, blend + i, splashModeMono8);
+    }
+}
+
+SPLASH_SPAN_KERNEL
+static void splashOutBlendDifferenceSpan(unsigned char *src,
+                                         unsigned char *dest,
+                                         unsigned char *blend, int n)
+{
+    SplashVecI32 s, d;
+    int          i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        s = splashVecLoad(src + i);
+        d = splashVecLoad(dest + i);
+        splashVecStore(blend + i, splashVecMax(s, d) - splashVecMin(s, d));
+    }
+}
+
+SPLASH_SPAN_KERNEL
+static void splashOutBlendExclusionSpan(unsigned char *src, unsigned char *dest,
+                                        unsigned char *blend, int n)
+{
+    SplashVecI32 s, d;
+    int          i;
+
+    for (i = 0; i < n; i += splashVecSize) {
+        s = splashVecLoad(src + i);
+        d = splashVecLoad(dest + i);
+        splashVecStore(blend + i, d + s - splashVecDivT255(2 * d * s));
+    }
+}
+
+// NB: This must match the GfxBlendMode enum defined in GfxState.h.  The
+// non-separable modes have no span version.
+SplashBlendSpanFunc splashOutBlendSpanFuncs[] = {
+    NULL,
+    &splashOutBlendMultiplySpan,
+    &splashOutBlendScreenSpan,
+    &splashOutBlendOverlaySpan,
+    &splashOutBlendDarkenSpan,
+    &splashOutBlendLightenSpan,
+    &splashOutBlendColorDodgeSpan,
+    &splashOutBlendColorBurnSpan,
+    &splashOutBlendHardLightSpan,
+    &splashOutBlendSoftLightSpan,
+    &splashOutBlendDifferenceSpan,
+    &splashOutBlendExclusionSpan,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
 //------------------------------------------------------------------------
 // SplashOutFontFileID
 //------------------------------------------------------------------------
@@ -486,35 +680,26 @@ private:
 // T3FontCache
 //------------------------------------------------------------------------
 
-struct T3FontCacheTag
-{
-    unsigned short code;
-    unsigned short mru; // valid bit (0x8000) and MRU index
-};
-
+// The glyph bitmap geometry of a Type 3 font at one matrix.  The glyphs
+// themselves are kept in the T3GlyphCache.
 class T3FontCache
 {
 public:
     T3FontCache(Ref *fontID, double m11A, double m12A, double m21A, double m22A,
                 int glyphXA, int glyphYA, int glyphWA, int glyphHA, bool aa,
                 bool validBBoxA);
-    ~T3FontCache();
     bool matches(Ref *idA, double m11A, double m12A, double m21A, double m22A)
     {
         return fontID.num == idA->num && fontID.gen == idA->gen && m11 == m11A &&
                m12 == m12A && m21 == m21A && m22 == m22A;
     }
 
-    Ref             fontID; // PDF font ID
-    double          m11, m12, m21, m22; // transform matrix
-    int             glyphX, glyphY; // pixel offset of glyph bitmaps
-    int             glyphW, glyphH; // size of glyph bitmaps, in pixels
-    bool            validBBox; // false if the bbox was [0 0 0 0]
-    int             glyphSize; // size of glyph bitmaps, in bytes
-    int             cacheSets; // number of sets in cache
-    int             cacheAssoc; // cache associativity (glyphs per set)
-    unsigned char * cacheData; // glyph pixmap cache
-    T3FontCacheTag *cacheTags; // cache tags, i.e., char codes
+    Ref    fontID; // PDF font ID
+    double m11, m12, m21, m22; // transform matrix
+    int    glyphX, glyphY; // pixel offset of glyph bitmaps
+    int    glyphW, glyphH; // size of glyph bitmaps, in pixels
+    bool   validBBox; // false if the bbox was [0 0 0 0]
+    int    glyphSize; // size of glyph bitmaps, in bytes
 };
 
 T3FontCache::T3FontCache(Ref *fontIDA, double m11A, double m12A, double m21A,
@@ -545,37 +730,148 @@ T3FontCache::T3FontCache(Ref *fontIDA, double m11A, double m12A, double m21A,
     } else {
         glyphSize = ((glyphW + 7) >> 3) * glyphH;
     }
-    cacheAssoc = type3FontCacheAssoc;
-    for (cacheSets = type3FontCacheMaxSets;
-         cacheSets > 1 && cacheSets * cacheAssoc * glyphSize > type3FontCacheSize;
-         cacheSets >>= 1)
-        ;
-    cacheData = (unsigned char *)calloc(cacheSets * cacheAssoc, glyphSize);
-    cacheTags =
-        (T3FontCacheTag *)calloc(cacheSets * cacheAssoc, sizeof(T3FontCacheTag));
-    for (i = 0; i < cacheSets * cacheAssoc; ++i) {
-        cacheTags[i].mru = i & (cacheAssoc - 1);
+}
+
+//------------------------------------------------------------------------
+// T3GlyphCache
+//------------------------------------------------------------------------
+
+struct T3GlyphKey
+{
+    Ref      fontID; // PDF font ID
+    double   m11, m12, m21, m22; // transform matrix (zero for a mask)
+    CharCode code; // character code
+    bool     mask; // image mask, instead of a glyph bitmap
+};
+
+static inline bool operator==(const T3GlyphKey &lhs, const T3GlyphKey &rhs)
+{
+    return lhs.fontID.num == rhs.fontID.num && lhs.fontID.gen == rhs.fontID.gen &&
+           lhs.m11 == rhs.m11 && lhs.m12 == rhs.m12 && lhs.m21 == rhs.m21 &&
+           lhs.m22 == rhs.m22 && lhs.code == rhs.code && lhs.mask == rhs.mask;
+}
+
+struct T3GlyphKeyHash
+{
+    size_t operator()(const T3GlyphKey &key) const
+    {
+        std::hash< double > hd;
+        size_t              h;
+
+        h = xpdf::ref_hash_t()(key.fontID);
+        h = h * 31 + hd(key.m11);
+        h = h * 31 + hd(key.m12);
+        h = h * 31 + hd(key.m21);
+        h = h * 31 + hd(key.m22);
+        h = h * 31 + key.code * 2 + key.mask;
+        return h;
     }
+};
+
+// A cached Type 3 glyph: either the glyph bitmap rendered at one matrix,
+// or -- for a CharProc that draws nothing but an image mask -- the mask
+// itself, which can be rendered at any matrix without running the
+// CharProc again.
+struct T3Glyph
+{
+    T3GlyphKey key;
+
+    //----- glyph bitmap
+    int glyphX, glyphY; // pixel offset of the bitmap
+    int glyphW, glyphH; // size of the bitmap, in pixels
+
+    //----- image mask
+    int    maskW, maskH; // size of the mask, in pixels
+    double maskMat[6]; // image space to glyph space matrix
+    double bbox[4]; // glyph bbox, from the d1 operator
+    bool   interpolate; // interpolate flag of the image
+
+    std::vector< unsigned char > data; // glyph bitmap, or mask (one byte
+                                       //   per pixel, 1 = paint)
+};
+
+// Type 3 glyphs, for all fonts and matrices, with LRU eviction once the
+// data exceeds the configured size.
+class T3GlyphCache
+{
+public:
+    explicit T3GlyphCache(size_t maxSizeA) : size(0), maxSize(maxSizeA) { }
+
+    // Returns the glyph for <key>, and makes it the most recently used,
+    // or returns NULL.
+    T3Glyph *lookup(const T3GlyphKey &key);
+
+    // Adds <glyph>, evicting the least recently used glyphs to make room.
+    // Returns the added glyph, which stays valid until the next add().
+    T3Glyph *add(T3Glyph &&glyph);
+
+    void clear();
+
+private:
+    std::list< T3Glyph > glyphs; // MRU first
+    std::unordered_map< T3GlyphKey, std::list< T3Glyph >::iterator,
+                        T3GlyphKeyHash >
+        index;
+    size_t size; // total size of the glyph data, in bytes
+    size_t maxSize;
+};
+
+T3Glyph *T3GlyphCache::lookup(const T3GlyphKey &key)
+{
+    auto iter = index.find(key);
+
+    if (iter == index.end()) {
+        return NULL;
+    }
+    glyphs.splice(glyphs.begin(), glyphs, iter->second);
+    return &glyphs.front();
+}
+
+T3Glyph *T3GlyphCache::add(T3Glyph &&glyph)
+{
+    auto iter = index.find(glyph.key);
+
+    if (iter != index.end()) {
+        size -= iter->second->data.size();
+        glyphs.erase(iter->second);
+        index.erase(iter);
+    }
+    while (!glyphs.empty() && size + glyph.data.size() > maxSize) {
+        size -= glyphs.back().data.size();
+        index.erase(glyphs.back().key);
+        glyphs.pop_back();
+    }
+    size += glyph.data.size();
+    glyphs.push_front(std::move(glyph));
+    index[glyphs.front().key] = glyphs.begin();
+    return &glyphs.front();
 }
 
-T3FontCache::~T3FontCache()
+void T3GlyphCache::clear()
 {
-    free(cacheData);
-    free(cacheTags);
+    glyphs.clear();
+    index.clear();
+    size = 0;
 }
 
 struct T3GlyphStack
 {
-    unsigned short code; // character code
+    CharCode code; // character code
 
     bool haveDx; // set after seeing a d0/d1 operator
     bool doNotCache; // set if we see a gsave/grestore before
         //   the d0/d1
 
     //----- cache info
-    T3FontCache *   cache; // font cache for the current font
-    T3FontCacheTag *cacheTag; // pointer to cache tag for the glyph
-    unsigned char * cacheData; // pointer to cache data for the glyph
+    T3FontCache *cache; // font cache for the current font
+    bool         cacheGlyph; // set if the glyph is rendered for the cache
+    double       bbox[4]; // glyph bbox, from the d1 operator
+    double       glyphCTM[6]; // glyph space to glyph bitmap matrix
+
+    //----- image mask glyphs
+    bool    maskOnly; // set while the CharProc has drawn nothing but
+        //   (at most) one image mask
+    T3Glyph mask; // the image mask, if maskOnly and mask.data is set
 
     //----- saved state
     SplashBitmap *origBitmap;
@@ -595,6 +891,8 @@ struct SplashTransparencyGroup
     SplashBitmap * tBitmap; // bitmap for transparency group
     GfxColorSpace *blendingColorSpace;
     bool           isolated;
+    int            modXMin, modYMin, // region of tBitmap drawn into by
+        modXMax, modYMax; //   the group (empty if xMin > xMax)
 
     //----- saved state
     SplashBitmap *origBitmap;
@@ -616,6 +914,9 @@ SplashOutputDev::SplashOutputDev(SplashColorMode colorModeA, int bitmapRowPadA,
     bitmapTopDown = bitmapTopDownA;
     bitmapUpsideDown = false;
     noComposite = false;
+    if ((rasterThreads = globalParams->getRasterThreads()) <= 0) {
+        rasterThreads = (int)std::thread::hardware_concurrency();
+    }
     allowAntialias = allowAntialiasA;
     vectorAntialias = allowAntialias && globalParams->getVectorAntialias() &&
                       colorMode != splashModeMono1;
@@ -627,8 +928,12 @@ SplashOutputDev::SplashOutputDev(SplashColorMode colorModeA, int bitmapRowPadA,
 
     xref = NULL;
 
+    bitmapPool = std::make_shared< SplashBitmapPool >();
+    pageBitmapCbk = NULL;
+    pageBitmapCbkData = NULL;
     bitmap = new SplashBitmap(1, 1, bitmapRowPad, colorMode,
-                              colorMode != splashModeMono1, bitmapTopDown);
+                              colorMode != splashModeMono1, bitmapTopDown,
+                              bitmapPool);
     splash = new Splash(bitmap, vectorAntialias, &screenParams);
     splash->setMinLineWidth(globalParams->getMinLineWidth());
     splash->setStrokeAdjust(globalParams->getStrokeAdjust());
@@ -637,6 +942,8 @@ SplashOutputDev::SplashOutputDev(SplashColorMode colorModeA, int bitmapRowPadA,
     fontEngine = NULL;
 
     nT3Fonts = 0;
+    t3GlyphCache = new T3GlyphCache((size_t)globalParams->getType3CacheSize() *
+                                    1024);
     t3GlyphStack = NULL;
 
     font = NULL;
@@ -707,6 +1014,7 @@ SplashOutputDev::~SplashOutputDev()
     for (i = 0; i < nT3Fonts; ++i) {
         delete t3FontCache[i];
     }
+    delete t3GlyphCache;
     if (fontEngine) {
         delete fontEngine;
     }
@@ -735,6 +1043,7 @@ void SplashOutputDev::startDoc(XRef *xrefA)
         delete t3FontCache[i];
     }
     nT3Fonts = 0;
+    t3GlyphCache->clear();
 }
 
 void SplashOutputDev::startPage(int pageNum, GfxState *state)
@@ -766,10 +1075,17 @@ void SplashOutputDev::startPage(int pageNum, GfxState *state)
             delete bitmap;
             bitmap = NULL;
         }
-        bitmap = new SplashBitmap(w, h, bitmapRowPad, colorMode,
-                                  colorMode != splashModeMono1, bitmapTopDown);
+        if (pageBitmapCbk && state && bitmapTopDown) {
+            bitmap = (*pageBitmapCbk)(pageBitmapCbkData, w, h);
+        }
+        if (!bitmap) {
+            bitmap = new SplashBitmap(w, h, bitmapRowPad, colorMode,
+                                      colorMode != splashModeMono1,
+                                      bitmapTopDown, bitmapPool);
+        }
     }
     splash = new Splash(bitmap, vectorAntialias, &screenParams);
+    splash->setThreads(rasterThreads);
     splash->setMinLineWidth(globalParams->getMinLineWidth());
     if (state) {
         ctm = state->getCTM();
@@ -788,6 +1104,7 @@ void SplashOutputDev::startPage(int pageNum, GfxState *state)
         break;
     case splashModeRGB8:
     case splashModeBGR8:
+    case splashModeXBGR8:
         color[0] = color[1] = color[2] = 0;
         break;
 #if SPLASH_CMYK
@@ -811,6 +1128,7 @@ void SplashOutputDev::startPage(int pageNum, GfxState *state)
 
 void SplashOutputDev::endPage()
 {
+    splash->flush();
     if (colorMode != splashModeMono1 && !noComposite) {
         splash->compositeBackground(paperColor);
     }
@@ -942,6 +1260,7 @@ void SplashOutputDev::updateFillColor(GfxState *state)
         break;
     case splashModeRGB8:
     case splashModeBGR8:
+    case splashModeXBGR8:
         state->getFillRGB(&rgb);
         splash->setFillPattern(getColor(&rgb));
         break;
@@ -970,6 +1289,7 @@ void SplashOutputDev::updateStrokeColor(GfxState *state)
         break;
     case splashModeRGB8:
     case splashModeBGR8:
+    case splashModeXBGR8:
         state->getStrokeRGB(&rgb);
         splash->setStrokePattern(getColor(&rgb));
         break;
@@ -1072,7 +1392,8 @@ void SplashOutputDev::setOverprintMask(GfxColorSpace *colorSpace,
 
 void SplashOutputDev::updateBlendMode(GfxState *state)
 {
-    splash->setBlendFunc(splashOutBlendFuncs[state->getBlendMode()]);
+    splash->setBlendFunc(splashOutBlendFuncs[state->getBlendMode()],
+                         splashOutBlendSpanFuncs[state->getBlendMode()]);
 }
 
 void SplashOutputDev::updateFillOpacity(GfxState *state)
@@ -1436,11 +1757,8 @@ void SplashOutputDev::doUpdateFont(GfxState *state)
                 w = ((Gfx8BitFont *)gfxFont)->getWidth(code);
 
                 if (auto p = xpdf::builtin_substitute_font(substIdx)) {
-                    int width = 0;
-
-                    try {
-                        width = p->widths.at(name);
-                    } catch(...) { }
+                    auto pw = p->widths.find(name);
+                    int  width = pw ? *pw : 0;
 
                     if (w > 0.01 && width > 10) {
                         w /= width * .001;
@@ -1491,6 +1809,7 @@ void SplashOutputDev::stroke(GfxState *state)
 {
     SplashPath *path;
 
+    noType3MaskGlyph();
     if (state->getStrokeColorSpace()->isNonMarking()) {
         return;
     }
@@ -1505,6 +1824,7 @@ void SplashOutputDev::fill(GfxState *state)
 {
     SplashPath *path;
 
+    noType3MaskGlyph();
     if (state->getFillColorSpace()->isNonMarking()) {
         return;
     }
@@ -1519,6 +1839,7 @@ void SplashOutputDev::eoFill(GfxState *state)
 {
     SplashPath *path;
 
+    noType3MaskGlyph();
     if (state->getFillColorSpace()->isNonMarking()) {
         return;
     }
@@ -1543,6 +1864,7 @@ void SplashOutputDev::tilingPatternFill(GfxState *state, Gfx *gfx, Object *strRe
     double        xa, ya, xb, yb, xc, yc;
     int           x, y, xx, yy, i;
 
+    noType3MaskGlyph();
     // transform the four corners of the bbox from pattern space to
     // device space and compute the device space bbox
     state->transform(bbox[0] * mat[0] + bbox[1] * mat[2] + mat[4],
@@ -1617,7 +1939,7 @@ void SplashOutputDev::tilingPatternFill(GfxState *state, Gfx *gfx, Object *strRe
     origBitmap = bitmap;
     origSplash = splash;
     bitmap = tileBitmap = new SplashBitmap(tileW, tileH, bitmapRowPad, colorMode,
-                                           true, bitmapTopDown);
+                                           true, bitmapTopDown, bitmapPool);
     splash = new Splash(bitmap, vectorAntialias, origSplash->getScreen());
     splash->setMinLineWidth(globalParams->getMinLineWidth());
     splash->setStrokeAdjust(globalParams->getStrokeAdjust());
@@ -1668,6 +1990,7 @@ void SplashOutputDev::clip(GfxState *state)
 {
     SplashPath *path;
 
+    noType3MaskGlyph();
     path = convertPath(state, state->getPath(), true);
     splash->clipToPath(path, false);
     delete path;
@@ -1677,6 +2000,7 @@ void SplashOutputDev::eoClip(GfxState *state)
 {
     SplashPath *path;
 
+    noType3MaskGlyph();
     path = convertPath(state, state->getPath(), true);
     splash->clipToPath(path, true);
     delete path;
@@ -1686,6 +2010,7 @@ void SplashOutputDev::clipToStrokePath(GfxState *state)
 {
     SplashPath *path, *path2;
 
+    noType3MaskGlyph();
     path = convertPath(state, state->getPath(), false);
     path2 = splash->makeStrokePath(path, state->getLineWidth());
     delete path;
@@ -1741,6 +2066,7 @@ void SplashOutputDev::drawChar(GfxState *state, double x, double y, double dx,
     double      m[4];
     bool        horiz;
 
+    noType3MaskGlyph();
     if (skipHorizText || skipRotatedText) {
         state->getFontTransMat(&m[0], &m[1], &m[2], &m[3]);
         horiz = m[0] > 0 && fabs(m[1]) < 0.001 && fabs(m[2]) < 0.001 && m[3] < 0;
@@ -1851,6 +2177,7 @@ bool SplashOutputDev::beginType3Char(GfxState *state, double x, double y,
     double        x1, y1, xMin, yMin, xMax, yMax, xt, yt;
     int           i, j;
 
+    noType3MaskGlyph();
     if (skipHorizText || skipRotatedText) {
         state->getFontTransMat(&m[0], &m[1], &m[2], &m[3]);
         horiz = m[0] > 0 && fabs(m[1]) < 0.001 && fabs(m[2]) < 0.001 && m[3] < 0;
@@ -1947,14 +2274,20 @@ bool SplashOutputDev::beginType3Char(GfxState *state, double x, double y,
     t3Font = t3FontCache[0];
 
     // is the glyph in the cache?
-    i = (code & (t3Font->cacheSets - 1)) * t3Font->cacheAssoc;
-    for (j = 0; j < t3Font->cacheAssoc; ++j) {
-        if ((t3Font->cacheTags[i + j].mru & 0x8000) &&
-            t3Font->cacheTags[i + j].code == code) {
-            drawType3Glyph(state, t3Font, &t3Font->cacheTags[i + j],
-                           t3Font->cacheData + (i + j) * t3Font->glyphSize);
-            return true;
-        }
+    T3GlyphKey key = { t3Font->fontID, t3Font->m11, t3Font->m12,
+                       t3Font->m21,    t3Font->m22, code,
+                       false };
+    T3Glyph *  glyph;
+    if ((glyph = t3GlyphCache->lookup(key))) {
+        drawType3Glyph(state, glyph);
+        return true;
+    }
+
+    // is the image mask of the glyph in the cache?
+    T3GlyphKey maskKey = { t3Font->fontID, 0, 0, 0, 0, code, true };
+    if ((glyph = t3GlyphCache->lookup(maskKey)) &&
+        drawType3MaskGlyph(state, t3Font, glyph)) {
+        return true;
     }
 
     // push a new Type 3 glyph record
@@ -1963,8 +2296,8 @@ bool SplashOutputDev::beginType3Char(GfxState *state, double x, double y,
     t3GlyphStack = t3gs;
     t3GlyphStack->code = code;
     t3GlyphStack->cache = t3Font;
-    t3GlyphStack->cacheTag = NULL;
-    t3GlyphStack->cacheData = NULL;
+    t3GlyphStack->cacheGlyph = false;
+    t3GlyphStack->maskOnly = false;
     t3GlyphStack->haveDx = false;
     t3GlyphStack->doNotCache = false;
 
@@ -1974,12 +2307,36 @@ bool SplashOutputDev::beginType3Char(GfxState *state, double x, double y,
 void SplashOutputDev::endType3Char(GfxState *state)
 {
     T3GlyphStack *t3gs;
+    T3FontCache * t3Font;
+    T3Glyph       glyph, *cached;
     double *      ctm;
 
-    if (t3GlyphStack->cacheTag) {
+    if (t3GlyphStack->cacheGlyph) {
         --nestCount;
-        memcpy(t3GlyphStack->cacheData, bitmap->getDataPtr(),
-               t3GlyphStack->cache->glyphSize);
+        t3Font = t3GlyphStack->cache;
+
+        // a CharProc that drew only an image mask: keep the mask, to
+        // render the glyph at other matrices without running the
+        // CharProc
+        if (t3GlyphStack->maskOnly && !t3GlyphStack->mask.data.empty()) {
+            t3GlyphStack->mask.key = { t3Font->fontID, 0, 0, 0, 0,
+                                       t3GlyphStack->code, true };
+            memcpy(t3GlyphStack->mask.bbox, t3GlyphStack->bbox,
+                   sizeof(t3GlyphStack->mask.bbox));
+            t3GlyphCache->add(std::move(t3GlyphStack->mask));
+        }
+
+        glyph.key = { t3Font->fontID, t3Font->m11, t3Font->m12,
+                      t3Font->m21,    t3Font->m22, t3GlyphStack->code,
+                      false };
+        glyph.glyphX = t3Font->glyphX;
+        glyph.glyphY = t3Font->glyphY;
+        glyph.glyphW = t3Font->glyphW;
+        glyph.glyphH = t3Font->glyphH;
+        glyph.data.assign(bitmap->getDataPtr(),
+                          bitmap->getDataPtr() + t3Font->glyphSize);
+        cached = t3GlyphCache->add(std::move(glyph));
+
         delete bitmap;
         delete splash;
         bitmap = t3GlyphStack->origBitmap;
@@ -1988,8 +2345,7 @@ void SplashOutputDev::endType3Char(GfxState *state)
         state->setCTM(ctm[0], ctm[1], ctm[2], ctm[3], t3GlyphStack->origCTM4,
                       t3GlyphStack->origCTM5);
         updateCTM(state, 0, 0, 0, 0, 0, 0);
-        drawType3Glyph(state, t3GlyphStack->cache, t3GlyphStack->cacheTag,
-                       t3GlyphStack->cacheData);
+        drawType3Glyph(state, cached);
     }
     t3gs = t3GlyphStack;
     t3GlyphStack = t3gs->next;
@@ -2006,9 +2362,7 @@ void SplashOutputDev::type3D1(GfxState *state, double wx, double wy, double llx,
 {
     double *     ctm;
     T3FontCache *t3Font;
-    SplashColor  color;
     double       xt, yt, xMin, xMax, yMin, yMax, x1, y1;
-    int          i, j;
 
     // ignore multiple d0/d1 operators
     if (t3GlyphStack->haveDx) {
@@ -2069,19 +2423,13 @@ void SplashOutputDev::type3D1(GfxState *state, double wx, double wy, double llx,
         return;
     }
 
-    // allocate a cache entry
-    i = (t3GlyphStack->code & (t3Font->cacheSets - 1)) * t3Font->cacheAssoc;
-    for (j = 0; j < t3Font->cacheAssoc; ++j) {
-        if ((t3Font->cacheTags[i + j].mru & 0x7fff) == t3Font->cacheAssoc - 1) {
-            t3Font->cacheTags[i + j].mru = 0x8000;
-            t3Font->cacheTags[i + j].code = t3GlyphStack->code;
-            t3GlyphStack->cacheTag = &t3Font->cacheTags[i + j];
-            t3GlyphStack->cacheData =
-                t3Font->cacheData + (i + j) * t3Font->glyphSize;
-        } else {
-            ++t3Font->cacheTags[i + j].mru;
-        }
-    }
+    // render the glyph for the cache
+    t3GlyphStack->cacheGlyph = true;
+    t3GlyphStack->maskOnly = true;
+    t3GlyphStack->bbox[0] = llx;
+    t3GlyphStack->bbox[1] = lly;
+    t3GlyphStack->bbox[2] = urx;
+    t3GlyphStack->bbox[3] = ury;
 
     // save state
     t3GlyphStack->origBitmap = bitmap;
@@ -2091,51 +2439,168 @@ void SplashOutputDev::type3D1(GfxState *state, double wx, double wy, double llx,
     t3GlyphStack->origCTM5 = ctm[5];
 
     // create the temporary bitmap
+    splash = makeType3GlyphSplash(t3Font, t3GlyphStack->origSplash, &bitmap);
+    state->setCTM(ctm[0], ctm[1], ctm[2], ctm[3], -t3Font->glyphX,
+                  -t3Font->glyphY);
+    memcpy(t3GlyphStack->glyphCTM, state->getCTM(),
+           sizeof(t3GlyphStack->glyphCTM));
+    updateCTM(state, 0, 0, 0, 0, 0, 0);
+    ++nestCount;
+}
+
+// Create the bitmap, and the Splash object, to render a glyph of
+// <t3Font> into.
+Splash *SplashOutputDev::makeType3GlyphSplash(T3FontCache *  t3Font,
+                                              Splash *       origSplash,
+                                              SplashBitmap **glyphBitmap)
+{
+    Splash *    glyphSplash;
+    SplashColor color;
+
     if (colorMode == splashModeMono1) {
-        bitmap = new SplashBitmap(t3Font->glyphW, t3Font->glyphH, 1,
-                                  splashModeMono1, false);
-        splash = new Splash(bitmap, false, t3GlyphStack->origSplash->getScreen());
+        *glyphBitmap = new SplashBitmap(t3Font->glyphW, t3Font->glyphH, 1,
+                                        splashModeMono1, false, true, bitmapPool);
+        glyphSplash = new Splash(*glyphBitmap, false, origSplash->getScreen());
         color[0] = 0;
-        splash->clear(color);
+        glyphSplash->clear(color);
         color[0] = 0xff;
     } else {
-        bitmap = new SplashBitmap(t3Font->glyphW, t3Font->glyphH, 1,
-                                  splashModeMono8, false);
-        splash = new Splash(bitmap, vectorAntialias,
-                            t3GlyphStack->origSplash->getScreen());
+        *glyphBitmap = new SplashBitmap(t3Font->glyphW, t3Font->glyphH, 1,
+                                        splashModeMono8, false, true, bitmapPool);
+        glyphSplash =
+            new Splash(*glyphBitmap, vectorAntialias, origSplash->getScreen());
         color[0] = 0x00;
-        splash->clear(color);
+        glyphSplash->clear(color);
         color[0] = 0xff;
     }
-    splash->setMinLineWidth(globalParams->getMinLineWidth());
-    splash->setStrokeAdjust(t3GlyphStack->origSplash->getStrokeAdjust());
-    splash->setFillPattern(new SplashSolidColor(color));
-    splash->setStrokePattern(new SplashSolidColor(color));
-    //~ this should copy other state from t3GlyphStack->origSplash?
+    glyphSplash->setMinLineWidth(globalParams->getMinLineWidth());
+    glyphSplash->setStrokeAdjust(origSplash->getStrokeAdjust());
+    glyphSplash->setFillPattern(new SplashSolidColor(color));
+    glyphSplash->setStrokePattern(new SplashSolidColor(color));
+    //~ this should copy other state from origSplash?
     //~ [this is likely the same situation as in beginTransparencyGroup()]
-    state->setCTM(ctm[0], ctm[1], ctm[2], ctm[3], -t3Font->glyphX,
-                  -t3Font->glyphY);
-    updateCTM(state, 0, 0, 0, 0, 0, 0);
-    ++nestCount;
+    return glyphSplash;
 }
 
-void SplashOutputDev::drawType3Glyph(GfxState *state, T3FontCache *t3Font,
-                                     T3FontCacheTag *tag, unsigned char *data)
+struct SplashOutT3MaskData
+{
+    unsigned char *data;
+    int            width, height, y;
+};
+
+static bool t3MaskSrc(void *data, SplashColorPtr line)
+{
+    SplashOutT3MaskData *maskData = (SplashOutT3MaskData *)data;
+
+    if (maskData->y == maskData->height) {
+        memset(line, 0, maskData->width);
+        return false;
+    }
+    memcpy(line, maskData->data + maskData->y * maskData->width,
+           maskData->width);
+    ++maskData->y;
+    return true;
+}
+
+// Render the cached image mask <mask> of a glyph, at the current
+// matrix, into a new glyph bitmap -- as the CharProc would have -- and
+// draw it.  Returns false if the glyph doesn't fit the glyph bitmaps of
+// <t3Font>.
+bool SplashOutputDev::drawType3MaskGlyph(GfxState *state, T3FontCache *t3Font,
+                                         T3Glyph *mask)
+{
+    SplashOutT3MaskData maskData;
+    SplashBitmap *      glyphBitmap;
+    Splash *            glyphSplash;
+    SplashCoord         mat[6];
+    T3Glyph             glyph;
+    double *            ctm;
+    double              m[6], xt, yt, x, y, xMin, yMin, xMax, yMax;
+    int                 i;
+
+    // check the glyph bbox, as type3D1 does
+    ctm = state->getCTM();
+    state->transform(0, 0, &xt, &yt);
+    xMin = yMin = 1e30;
+    xMax = yMax = -1e30;
+    for (i = 0; i < 4; ++i) {
+        state->transform(mask->bbox[(i & 1) ? 2 : 0], mask->bbox[(i & 2) ? 3 : 1],
+                         &x, &y);
+        xMin = x < xMin ? x : xMin;
+        yMin = y < yMin ? y : yMin;
+        xMax = x > xMax ? x : xMax;
+        yMax = y > yMax ? y : yMax;
+    }
+    if (xMin - xt < t3Font->glyphX || yMin - yt < t3Font->glyphY ||
+        xMax - xt > t3Font->glyphX + t3Font->glyphW ||
+        yMax - yt > t3Font->glyphY + t3Font->glyphH) {
+        return false;
+    }
+
+    // the image matrix, in the glyph bitmap: maskMat * glyph space matrix
+    m[0] = mask->maskMat[0] * ctm[0] + mask->maskMat[1] * ctm[2];
+    m[1] = mask->maskMat[0] * ctm[1] + mask->maskMat[1] * ctm[3];
+    m[2] = mask->maskMat[2] * ctm[0] + mask->maskMat[3] * ctm[2];
+    m[3] = mask->maskMat[2] * ctm[1] + mask->maskMat[3] * ctm[3];
+    m[4] = mask->maskMat[4] * ctm[0] + mask->maskMat[5] * ctm[2] -
+           t3Font->glyphX;
+    m[5] = mask->maskMat[4] * ctm[1] + mask->maskMat[5] * ctm[3] -
+           t3Font->glyphY;
+    mat[0] = m[0];
+    mat[1] = m[1];
+    mat[2] = -m[2];
+    mat[3] = -m[3];
+    mat[4] = m[2] + m[4];
+    mat[5] = m[3] + m[5];
+
+    glyphSplash = makeType3GlyphSplash(t3Font, splash, &glyphBitmap);
+    maskData.data = mask->data.data();
+    maskData.width = mask->maskW;
+    maskData.height = mask->maskH;
+    maskData.y = 0;
+    glyphSplash->fillImageMask(&t3MaskSrc, &maskData, mask->maskW, mask->maskH,
+                               mat, true, mask->interpolate);
+
+    glyph.key = { t3Font->fontID, t3Font->m11, t3Font->m12, t3Font->m21,
+                  t3Font->m22,    mask->key.code, false };
+    glyph.glyphX = t3Font->glyphX;
+    glyph.glyphY = t3Font->glyphY;
+    glyph.glyphW = t3Font->glyphW;
+    glyph.glyphH = t3Font->glyphH;
+    glyph.data.assign(glyphBitmap->getDataPtr(),
+                      glyphBitmap->getDataPtr() + t3Font->glyphSize);
+    delete glyphSplash;
+    delete glyphBitmap;
+
+    drawType3Glyph(state, t3GlyphCache->add(std::move(glyph)));
+    return true;
+}
+
+void SplashOutputDev::drawType3Glyph(GfxState *state, T3Glyph *t3Glyph)
 {
     SplashGlyphBitmap glyph;
 
     setOverprintMask(state->getFillColorSpace(), state->getFillOverprint(),
                      state->getOverprintMode(), state->getFillColor());
-    glyph.x = -t3Font->glyphX;
-    glyph.y = -t3Font->glyphY;
-    glyph.w = t3Font->glyphW;
-    glyph.h = t3Font->glyphH;
+    glyph.x = -t3Glyph->glyphX;
+    glyph.y = -t3Glyph->glyphY;
+    glyph.w = t3Glyph->glyphW;
+    glyph.h = t3Glyph->glyphH;
     glyph.aa = colorMode != splashModeMono1;
-    glyph.data = data;
+    glyph.data = t3Glyph->data.data();
     glyph.freeData = false;
     splash->fillGlyph(0, 0, &glyph);
 }
 
+// Called by the drawing operations, other than image masks: a CharProc
+// that draws anything else is not cached as an image mask.
+void SplashOutputDev::noType3MaskGlyph()
+{
+    if (t3GlyphStack) {
+        t3GlyphStack->maskOnly = false;
+    }
+}
+
 void SplashOutputDev::endTextObject(GfxState *state)
 {
     if (textClipPath) {
@@ -2178,6 +2643,8 @@ void SplashOutputDev::drawImageMask(GfxState *state, Object *ref, Stream *str,
     double *               ctm;
     SplashCoord            mat[6];
     SplashOutImageMaskData imgMaskData;
+    SplashOutT3MaskData    t3MaskData;
+    int                    origWidth, origHeight;
 
     if (state->getFillColorSpace()->isNonMarking()) {
         return;
@@ -2193,6 +2660,8 @@ void SplashOutputDev::drawImageMask(GfxState *state, Object *ref, Stream *str,
     mat[4] = ctm[2] + ctm[4];
     mat[5] = ctm[3] + ctm[5];
 
+    origWidth = width;
+    origHeight = height;
     reduceImageResolution(str, ctm, &width, &height);
 
     imgMaskData.imgStr = new ImageStream(str, width, 1, 1);
@@ -2202,8 +2671,23 @@ void SplashOutputDev::drawImageMask(GfxState *state, Object *ref, Stream *str,
     imgMaskData.height = height;
     imgMaskData.y = 0;
 
-    splash->fillImageMask(&imageMaskSrc, &imgMaskData, width, height, mat,
-                          t3GlyphStack != NULL, interpolate);
+    // the first image mask in a CharProc that is being cached: keep the
+    // mask (unless it was reduced to this particular resolution)
+    if (t3GlyphStack && t3GlyphStack->cacheGlyph && t3GlyphStack->maskOnly &&
+        t3GlyphStack->mask.data.empty() && width == origWidth &&
+        height == origHeight && width > 0 && height > 0) {
+        captureType3Mask(ctm, &imgMaskData, interpolate);
+        t3MaskData.data = t3GlyphStack->mask.data.data();
+        t3MaskData.width = width;
+        t3MaskData.height = height;
+        t3MaskData.y = 0;
+        splash->fillImageMask(&t3MaskSrc, &t3MaskData, width, height, mat, true,
+                              interpolate);
+    } else {
+        noType3MaskGlyph();
+        splash->fillImageMask(&imageMaskSrc, &imgMaskData, width, height, mat,
+                              t3GlyphStack != NULL, interpolate);
+    }
     if (inlineImg) {
         while (imgMaskData.y < height) {
             imgMaskData.imgStr->readline();
@@ -2215,6 +2699,61 @@ void SplashOutputDev::drawImageMask(GfxState *state, Object *ref, Stream *str,
     str->close();
 }
 
+// Read the image mask of a Type 3 CharProc into t3GlyphStack->mask,
+// with its matrix relative to glyph space.
+void SplashOutputDev::captureType3Mask(double *ctm,
+                                       SplashOutImageMaskData *imgMaskData,
+                                       bool interpolate)
+{
+    T3Glyph *      mask;
+    double *       g;
+    double         inv[6], det, r;
+    unsigned char *p;
+    int            y, i;
+
+    mask = &t3GlyphStack->mask;
+    mask->maskW = imgMaskData->width;
+    mask->maskH = imgMaskData->height;
+    mask->interpolate = interpolate;
+    mask->data.resize((size_t)mask->maskW * mask->maskH);
+    for (y = 0, p = mask->data.data(); y < mask->maskH;
+         ++y, p += mask->maskW) {
+        imageMaskSrc(imgMaskData, p);
+    }
+
+    // maskMat = image CTM * inverse(glyph space to glyph bitmap matrix)
+    g = t3GlyphStack->glyphCTM;
+    det = g[0] * g[3] - g[1] * g[2];
+    if (fabs(det) < 1e-10) {
+        mask->data.clear();
+        t3GlyphStack->maskOnly = false;
+        return;
+    }
+    det = 1 / det;
+    inv[0] = g[3] * det;
+    inv[1] = -g[1] * det;
+    inv[2] = -g[2] * det;
+    inv[3] = g[0] * det;
+    inv[4] = (g[2] * g[5] - g[3] * g[4]) * det;
+    inv[5] = (g[1] * g[4] - g[0] * g[5]) * det;
+    mask->maskMat[0] = ctm[0] * inv[0] + ctm[1] * inv[2];
+    mask->maskMat[1] = ctm[0] * inv[1] + ctm[1] * inv[3];
+    mask->maskMat[2] = ctm[2] * inv[0] + ctm[3] * inv[2];
+    mask->maskMat[3] = ctm[2] * inv[1] + ctm[3] * inv[3];
+    mask->maskMat[4] = ctm[4] * inv[0] + ctm[5] * inv[2] + inv[4];
+    mask->maskMat[5] = ctm[4] * inv[1] + ctm[5] * inv[3] + inv[5];
+
+    // undo the rounding error of the inversion, which would otherwise
+    // move mask edges that fall exactly on pixel boundaries -- the cm
+    // operands in CharProcs are short decimals
+    for (i = 0; i < 6; ++i) {
+        r = round(mask->maskMat[i] * 1e6) / 1e6;
+        if (fabs(r - mask->maskMat[i]) < 1e-9 * (1 + fabs(r))) {
+            mask->maskMat[i] = r;
+        }
+    }
+}
+
 void SplashOutputDev::setSoftMaskFromImageMask(GfxState *state, Object *ref,
                                                Stream *str, int width, int height,
                                                bool invert, bool inlineImg,
@@ -2227,6 +2766,7 @@ void SplashOutputDev::setSoftMaskFromImageMask(GfxState *state, Object *ref,
     Splash *               maskSplash;
     SplashColor            maskColor;
 
+    noType3MaskGlyph();
     ctm = state->getCTM();
     mat[0] = ctm[0];
     mat[1] = ctm[1];
@@ -2242,7 +2782,7 @@ void SplashOutputDev::setSoftMaskFromImageMask(GfxState *state, Object *ref,
     imgMaskData.height = height;
     imgMaskData.y = 0;
     maskBitmap = new SplashBitmap(bitmap->getWidth(), bitmap->getHeight(), 1,
-                                  splashModeMono8, false);
+                                  splashModeMono8, false, true, bitmapPool);
     maskSplash = new Splash(maskBitmap, true);
     maskSplash->setStrokeAdjust(globalParams->getStrokeAdjust());
     clearMaskRegion(state, maskSplash, 0, 0, 1, 1);
@@ -2292,6 +2832,7 @@ bool SplashOutputDev::imageSrc(void *data, SplashColorPtr colorLine,
             break;
         case splashModeRGB8:
         case splashModeBGR8:
+        case splashModeXBGR8:
             for (x = 0, q = colorLine; x < imgData->width; ++x, ++p) {
                 col = &imgData->lookup[3 * *p];
                 *q++ = col[0];
@@ -2319,6 +2860,7 @@ bool SplashOutputDev::imageSrc(void *data, SplashColorPtr colorLine,
             break;
         case splashModeRGB8:
         case splashModeBGR8:
+        case splashModeXBGR8:
             imgData->colorMap->getRGBByteLine(p, colorLine, imgData->width);
             break;
 #if SPLASH_CMYK
@@ -2374,6 +2916,7 @@ bool SplashOutputDev::alphaImageSrc(void *data, SplashColorPtr colorLine,
                 break;
             case splashModeRGB8:
             case splashModeBGR8:
+            case splashModeXBGR8:
                 col = &imgData->lookup[3 * *p];
                 *q++ = col[0];
                 *q++ = col[1];
@@ -2399,6 +2942,7 @@ bool SplashOutputDev::alphaImageSrc(void *data, SplashColorPtr colorLine,
                 break;
             case splashModeRGB8:
             case splashModeBGR8:
+            case splashModeXBGR8:
                 imgData->colorMap->getRGB(p, &rgb);
                 *q++ = xpdf::to_small_color(rgb.r);
                 *q++ = xpdf::to_small_color(rgb.g);
@@ -2439,6 +2983,7 @@ void SplashOutputDev::drawImage(GfxState *state, Object *ref, Stream *str,
     unsigned char pix;
     int           n, i;
 
+    noType3MaskGlyph();
     setOverprintMask(colorMap->getColorSpace(), state->getFillOverprint(),
                      state->getOverprintMode(), NULL);
 
@@ -2479,6 +3024,7 @@ void SplashOutputDev::drawImage(GfxState *state, Object *ref, Stream *str,
             break;
         case splashModeRGB8:
         case splashModeBGR8:
+        case splashModeXBGR8:
             imgData.lookup = (SplashColorPtr)calloc(n, 3);
             for (i = 0; i < n; ++i) {
                 pix = (unsigned char)i;
@@ -2506,7 +3052,7 @@ void SplashOutputDev::drawImage(GfxState *state, Object *ref, Stream *str,
 
     if (colorMode == splashModeMono1) {
         srcMode = splashModeMono8;
-    } else if (colorMode == splashModeBGR8) {
+    } else if (colorMode == splashModeBGR8 || colorMode == splashModeXBGR8) {
         srcMode = splashModeRGB8;
     } else {
         srcMode = colorMode;
@@ -2578,6 +3124,7 @@ bool SplashOutputDev::maskedImageSrc(void *data, SplashColorPtr colorLine,
                 break;
             case splashModeRGB8:
             case splashModeBGR8:
+            case splashModeXBGR8:
                 col = &imgData->lookup[3 * *p];
                 *q++ = col[0];
                 *q++ = col[1];
@@ -2603,6 +3150,7 @@ bool SplashOutputDev::maskedImageSrc(void *data, SplashColorPtr colorLine,
                 break;
             case splashModeRGB8:
             case splashModeBGR8:
+            case splashModeXBGR8:
                 imgData->colorMap->getRGB(p, &rgb);
                 *q++ = xpdf::to_small_color(rgb.r);
                 *q++ = xpdf::to_small_color(rgb.g);
@@ -2650,6 +3198,7 @@ void SplashOutputDev::drawMaskedImage(GfxState *state, Object *ref, Stream *str,
     unsigned char pix;
     int           n, i;
 
+    noType3MaskGlyph();
     setOverprintMask(colorMap->getColorSpace(), state->getFillOverprint(),
                      state->getOverprintMode(), NULL);
 
@@ -2689,7 +3238,8 @@ void SplashOutputDev::drawMaskedImage(GfxState *state, Object *ref, Stream *str,
         imgMaskData.width = maskWidth;
         imgMaskData.height = maskHeight;
         imgMaskData.y = 0;
-        maskBitmap = new SplashBitmap(width, height, 1, splashModeMono1, false);
+        maskBitmap = new SplashBitmap(width, height, 1, splashModeMono1, false,
+                                      true, bitmapPool);
         maskSplash = new Splash(maskBitmap, false);
         maskSplash->setStrokeAdjust(globalParams->getStrokeAdjust());
         maskColor[0] = 0;
@@ -2739,6 +3289,7 @@ void SplashOutputDev::drawMaskedImage(GfxState *state, Object *ref, Stream *str,
                 break;
             case splashModeRGB8:
             case splashModeBGR8:
+            case splashModeXBGR8:
                 imgData.lookup = (SplashColorPtr)calloc(n, 3);
                 for (i = 0; i < n; ++i) {
                     pix = (unsigned char)i;
@@ -2766,7 +3317,7 @@ void SplashOutputDev::drawMaskedImage(GfxState *state, Object *ref, Stream *str,
 
         if (colorMode == splashModeMono1) {
             srcMode = splashModeMono8;
-        } else if (colorMode == splashModeBGR8) {
+        } else if (colorMode == splashModeBGR8 || colorMode == splashModeXBGR8) {
             srcMode = splashModeRGB8;
         } else {
             srcMode = colorMode;
@@ -2801,6 +3352,7 @@ void SplashOutputDev::drawSoftMaskedImage(
     unsigned char pix;
     int           n, i;
 
+    noType3MaskGlyph();
     setOverprintMask(colorMap->getColorSpace(), state->getFillOverprint(),
                      state->getOverprintMode(), NULL);
 
@@ -2835,7 +3387,7 @@ void SplashOutputDev::drawSoftMaskedImage(
         imgMaskData.lookup[i] = xpdf::to_small_color(gray.x);
     }
     maskBitmap = new SplashBitmap(bitmap->getWidth(), bitmap->getHeight(), 1,
-                                  splashModeMono8, false);
+                                  splashModeMono8, false, true, bitmapPool);
     maskSplash = new Splash(maskBitmap, vectorAntialias);
     maskSplash->setStrokeAdjust(globalParams->getStrokeAdjust());
     clearMaskRegion(state, maskSplash, 0, 0, 1, 1);
@@ -2876,6 +3428,7 @@ void SplashOutputDev::drawSoftMaskedImage(
             break;
         case splashModeRGB8:
         case splashModeBGR8:
+        case splashModeXBGR8:
             imgData.lookup = (SplashColorPtr)calloc(n, 3);
             for (i = 0; i < n; ++i) {
                 pix = (unsigned char)i;
@@ -2903,7 +3456,7 @@ void SplashOutputDev::drawSoftMaskedImage(
 
     if (colorMode == splashModeMono1) {
         srcMode = splashModeMono8;
-    } else if (colorMode == splashModeBGR8) {
+    } else if (colorMode == splashModeBGR8 || colorMode == splashModeXBGR8) {
         srcMode = splashModeRGB8;
     } else {
         srcMode = colorMode;
@@ -3047,10 +3600,10 @@ void SplashOutputDev::beginTransparencyGroup(GfxState *state, double *bbox,
                                              bool forSoftMask)
 {
     SplashTransparencyGroup *transpGroup;
-    SplashColor              color;
     double                   xMin, yMin, xMax, yMax, x, y;
-    int                      tx, ty, w, h, i;
+    int                      tx, ty, w, h;
 
+    noType3MaskGlyph();
     // transform the bbox
     state->transform(bbox[0], bbox[1], &x, &y);
     xMin = xMax = x;
@@ -3128,6 +3681,9 @@ void SplashOutputDev::beginTransparencyGroup(GfxState *state, double *bbox,
     transpGroup->origBitmap = bitmap;
     transpGroup->origSplash = splash;
 
+    // the group reads the backdrop from the original bitmap
+    splash->flush();
+
     //~ this handles the blendingColorSpace arg for soft masks, but
     //~   not yet for transparency groups
 
@@ -3154,9 +3710,11 @@ void SplashOutputDev::beginTransparencyGroup(GfxState *state, double *bbox,
     }
 
     // create the temporary bitmap
-    bitmap = new SplashBitmap(w, h, bitmapRowPad, colorMode, true, bitmapTopDown);
+    bitmap = new SplashBitmap(w, h, bitmapRowPad, colorMode, true, bitmapTopDown,
+                              bitmapPool);
     splash =
         new Splash(bitmap, vectorAntialias, transpGroup->origSplash->getScreen());
+    splash->setThreads(rasterThreads);
     splash->setMinLineWidth(globalParams->getMinLineWidth());
     splash->setStrokeAdjust(globalParams->getStrokeAdjust());
     //~ Acrobat apparently copies at least the fill and stroke colors, and
@@ -3165,14 +3723,14 @@ void SplashOutputDev::beginTransparencyGroup(GfxState *state, double *bbox,
     //~ [this is likely the same situation as in type3D1()]
     splash->setFillPattern(transpGroup->origSplash->getFillPattern()->copy());
     splash->setStrokePattern(transpGroup->origSplash->getStrokePattern()->copy());
-    if (isolated) {
-        for (i = 0; i < splashMaxColorComps; ++i) {
-            color[i] = 0;
-        }
-        splash->clear(color, 0);
-    } else {
+    // an isolated group starts out transparent, and new bitmaps are
+    // already zero-filled
+    if (!isolated) {
         splash->blitTransparent(transpGroup->origBitmap, tx, ty, 0, 0, w, h);
     }
+    // everything outside the modified region stays transparent, so
+    // paintTransparencyGroup only needs to composite that region
+    splash->clearModRegion();
     splash->setInTransparencyGroup(transpGroup->origBitmap, tx, ty, !isolated,
                                    knockout);
     transpGroup->tBitmap = bitmap;
@@ -3185,6 +3743,8 @@ void SplashOutputDev::endTransparencyGroup(GfxState *state)
 {
     // restore state
     --nestCount;
+    splash->getModRegion(&transpGroupStack->modXMin, &transpGroupStack->modYMin,
+                         &transpGroupStack->modXMax, &transpGroupStack->modYMax);
     delete splash;
     bitmap = transpGroupStack->origBitmap;
     colorMode = bitmap->getMode();
@@ -3198,19 +3758,26 @@ void SplashOutputDev::paintTransparencyGroup(GfxState *state, double *bbox)
     SplashBitmap *           tBitmap;
     SplashTransparencyGroup *transpGroup;
     bool                     isolated;
-    int                      tx, ty;
+    int                      tx, ty, xMin, yMin, xMax, yMax;
 
     tx = transpGroupStack->tx;
     ty = transpGroupStack->ty;
     tBitmap = transpGroupStack->tBitmap;
     isolated = transpGroupStack->isolated;
+    xMin = transpGroupStack->modXMin;
+    yMin = transpGroupStack->modYMin;
+    xMax = transpGroupStack->modXMax;
+    yMax = transpGroupStack->modYMax;
 
     // paint the transparency group onto the parent bitmap
     // - the clip path was set in the parent's state)
-    if (tx < bitmap->getWidth() && ty < bitmap->getHeight()) {
+    // - pixels outside the modified region are transparent, and
+    //   compositing them would leave the parent unchanged
+    if (tx < bitmap->getWidth() && ty < bitmap->getHeight() && xMin <= xMax &&
+        yMin <= yMax) {
         splash->setOverprintMask(0xffffffff);
-        splash->composite(tBitmap, 0, 0, tx, ty, tBitmap->getWidth(),
-                          tBitmap->getHeight(), false, !isolated);
+        splash->composite(tBitmap, xMin, yMin, tx + xMin, ty + yMin,
+                          xMax - xMin + 1, yMax - yMin + 1, false, !isolated);
     }
 
     // pop the stack
@@ -3238,6 +3805,7 @@ void SplashOutputDev::setSoftMask(GfxState *state, double *bbox, bool alpha,
     double backdrop, backdrop2, lum, lum2;
     int    tx, ty, x, y;
 
+    noType3MaskGlyph();
     tx = transpGroupStack->tx;
     ty = transpGroupStack->ty;
     tBitmap = transpGroupStack->tBitmap;
@@ -3264,6 +3832,7 @@ void SplashOutputDev::setSoftMask(GfxState *state, double *bbox, bool alpha,
                 break;
             case splashModeRGB8:
             case splashModeBGR8:
+            case splashModeXBGR8:
                 transpGroupStack->blendingColorSpace->getRGB(backdropColor, &rgb);
                 backdrop = 0.3 * xpdf::to_double(rgb.r) +
                            0.59 * xpdf::to_double(rgb.g) +
@@ -3303,7 +3872,7 @@ void SplashOutputDev::setSoftMask(GfxState *state, double *bbox, bool alpha,
     }
 
     softMask = new SplashBitmap(bitmap->getWidth(), bitmap->getHeight(), 1,
-                                splashModeMono8, false);
+                                splashModeMono8, false, true, bitmapPool);
     memset(softMask->getDataPtr(), (int)(backdrop2 * 255.0 + 0.5),
            softMask->getRowSize() * softMask->getHeight());
     if (tx < softMask->getWidth() && ty < softMask->getHeight()) {
@@ -3322,6 +3891,7 @@ void SplashOutputDev::setSoftMask(GfxState *state, double *bbox, bool alpha,
                         break;
                     case splashModeRGB8:
                     case splashModeBGR8:
+                    case splashModeXBGR8:
                         lum = (0.3 / 255.0) * color[0] +
                               (0.59 / 255.0) * color[1] +
                               (0.11 / 255.0) * color[2];
@@ -3384,7 +3954,8 @@ SplashBitmap *SplashOutputDev::takeBitmap()
 
     ret = bitmap;
     bitmap = new SplashBitmap(1, 1, bitmapRowPad, colorMode,
-                              colorMode != splashModeMono1, bitmapTopDown);
+                              colorMode != splashModeMono1, bitmapTopDown,
+                              bitmapPool);
     return ret;
 }
 
@@ -3421,6 +3992,7 @@ void SplashOutputDev::setFillColor(int r, int g, int b)
 
     case splashModeRGB8:
     case splashModeBGR8:
+    case splashModeXBGR8:
         splash->setFillPattern(getColor(&rgb));
         break;
 
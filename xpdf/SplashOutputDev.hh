@@ -6,6 +6,8 @@
 
 #include <defs.hh>
 
+#include <memory>
+
 #include <splash/SplashTypes.hh>
 #include <defs.hh>
 #include <xpdf/OutputDev.hh>
@@ -13,18 +15,27 @@
 
 class Gfx8BitFont;
 class SplashBitmap;
+class SplashBitmapPool;
 class Splash;
 class SplashPath;
 class SplashPattern;
 class SplashFontEngine;
 class SplashFont;
 class T3FontCache;
-struct T3FontCacheTag;
+class T3GlyphCache;
+struct T3Glyph;
 struct T3GlyphStack;
+struct SplashOutImageMaskData;
 struct SplashTransparencyGroup;
 
 //------------------------------------------------------------------------
 
+// Makes the <w> x <h> page bitmap, in the device's color mode (see
+// SplashOutputDev::setPageBitmapCbk).
+typedef SplashBitmap *(*SplashOutPageBitmapCbk)(void *data, int w, int h);
+
+//------------------------------------------------------------------------
+
 // number of Type 3 fonts to cache
 #define splashOutT3FontCacheSize 8
 
@@ -45,6 +56,9 @@ public:
 
     //----- get info about output device
 
+    // Get the color mode of the page bitmaps.
+    SplashColorMode getColorMode() { return colorMode; }
+
     // Does this device use upside-down coordinates?
     // (Upside-down means (0,0) is the top left corner of the page.)
     virtual bool upsideDown() { return bitmapTopDown ^ bitmapUpsideDown; }
@@ -184,6 +198,21 @@ public:
     // opaque paper color), resulting in transparent output.
     void setNoComposite(bool f) { noComposite = f; }
 
+    // Page bitmaps are made by <cbk>, e.g., in memory shared with a
+    // display server; pages for which it returns NULL are allocated as
+    // usual.  A bitmap from <cbk> must be top-down, and is deleted by
+    // the device (or the caller of takeBitmap) like any other.
+    void setPageBitmapCbk(SplashOutPageBitmapCbk cbk, void *data)
+    {
+        pageBitmapCbk = cbk;
+        pageBitmapCbkData = data;
+    }
+
+    // Rasterize pages (and transparency groups) on <n> threads, each
+    // one drawing a horizontal band of the bitmap.  The default is set
+    // by the rasterThreads config option.
+    void setRasterThreads(int n) { rasterThreads = n; }
+
     // Get the Splash object.
     Splash *getSplash() { return splash; }
 
@@ -227,8 +256,13 @@ private:
     SplashPath *convertPath(GfxState *state, GfxPath *path,
                             bool dropEmptySubpaths);
     void        doUpdateFont(GfxState *state);
-    void drawType3Glyph(GfxState *state, T3FontCache *t3Font, T3FontCacheTag *tag,
-                        unsigned char *data);
+    Splash *makeType3GlyphSplash(T3FontCache *t3Font, Splash *origSplash,
+                                 SplashBitmap **glyphBitmap);
+    bool drawType3MaskGlyph(GfxState *state, T3FontCache *t3Font, T3Glyph *mask);
+    void drawType3Glyph(GfxState *state, T3Glyph *t3Glyph);
+    void noType3MaskGlyph();
+    void captureType3Mask(double *ctm, SplashOutImageMaskData *imgMaskData,
+                          bool interpolate);
     static bool imageMaskSrc(void *data, SplashColorPtr line);
     static bool imageSrc(void *data, SplashColorPtr colorLine,
                          unsigned char *alphaLine);
@@ -245,6 +279,7 @@ private:
     bool               bitmapTopDown;
     bool               bitmapUpsideDown;
     bool               noComposite;
+    int                rasterThreads;
     bool               allowAntialias;
     bool               vectorAntialias;
     bool               reverseVideo; // reverse video mode
@@ -259,9 +294,16 @@ private:
     Splash *          splash;
     SplashFontEngine *fontEngine;
 
+    // data buffers shared by the page, tile, group, and mask bitmaps
+    std::shared_ptr< SplashBitmapPool > bitmapPool;
+
+    SplashOutPageBitmapCbk pageBitmapCbk; // makes page bitmaps, or NULL
+    void *                 pageBitmapCbkData;
+
     T3FontCache * // Type 3 font cache
                   t3FontCache[splashOutT3FontCacheSize];
     int           nT3Fonts; // number of valid entries in t3FontCache
+    T3GlyphCache *t3GlyphCache; // Type 3 glyphs, for all fonts
     T3GlyphStack *t3GlyphStack; // Type 3 glyph context stack
 
     SplashFont *font; // current font
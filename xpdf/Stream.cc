@@ -4473,6 +4473,19 @@ int FixedLengthEncoder::peek()
     return str->get();
 }
 
+int FixedLengthEncoder::readblock(char *blk, int size)
+{
+    int n;
+
+    if (length >= 0 && size > length - count)
+        size = length - count;
+    if (size <= 0)
+        return 0;
+    n = str->readblock(blk, size);
+    count += n;
+    return n;
+}
+
 bool FixedLengthEncoder::isBinary(bool last)
 {
     return str->isBinary(true);
@@ -4505,19 +4518,53 @@ void ASCIIHexEncoder::reset()
     eof = false;
 }
 
+int ASCIIHexEncoder::readblock(char *blk, int size)
+{
+    int n, m;
+
+    n = 0;
+    while (n < size) {
+        if (bufPtr >= bufEnd) {
+            if (!fillBuf()) {
+                break;
+            }
+        }
+        m = (int)(bufEnd - bufPtr);
+        if (m > size - n) {
+            m = size - n;
+        }
+        memcpy(blk + n, bufPtr, m);
+        bufPtr += m;
+        n += m;
+    }
+    return n;
+}
+
+// Read up to <size> bytes, stopping short only at EOF.
+static int readEncoderInput(Stream *str, unsigned char *in, int size)
+{
+    int n, m;
+
+    n = 0;
+    while (n < size && (m = str->readblock((char *)in + n, size - n)) > 0) {
+        n += m;
+    }
+    return n;
+}
+
 bool ASCIIHexEncoder::fillBuf()
 {
     static const char *hex = "0123456789abcdef";
-    int                c;
+    unsigned char      in[1024];
+    int                n, c, i;
 
     if (eof) {
         return false;
     }
     bufPtr = bufEnd = buf;
-    if ((c = str->get()) == EOF) {
-        *bufEnd++ = '>';
-        eof = true;
-    } else {
+    n = readEncoderInput(str, in, sizeof(in));
+    for (i = 0; i < n; ++i) {
+        c = in[i];
         if (lineLen >= 64) {
             *bufEnd++ = '\n';
             lineLen = 0;
@@ -4526,6 +4573,10 @@ bool ASCIIHexEncoder::fillBuf()
         *bufEnd++ = hex[c & 0x0f];
         lineLen += 2;
     }
+    if (n < (int)sizeof(in)) {
+        *bufEnd++ = '>';
+        eof = true;
+    }
     return true;
 }
 
@@ -4555,41 +4606,57 @@ void ASCII85Encoder::reset()
     eof = false;
 }
 
+int ASCII85Encoder::readblock(char *blk, int size)
+{
+    int n, m;
+
+    n = 0;
+    while (n < size) {
+        if (bufPtr >= bufEnd) {
+            if (!fillBuf()) {
+                break;
+            }
+        }
+        m = (int)(bufEnd - bufPtr);
+        if (m > size - n) {
+            m = size - n;
+        }
+        memcpy(blk + n, bufPtr, m);
+        bufPtr += m;
+        n += m;
+    }
+    return n;
+}
+
 bool ASCII85Encoder::fillBuf()
 {
-    unsigned t;
-    char     buf1[5];
-    int      c0, c1, c2, c3;
-    int      n, i;
+    unsigned char in[1024];
+    unsigned      t;
+    char          buf1[5];
+    int           nIn, n, i, j;
 
     if (eof) {
         return false;
     }
-    c0 = str->get();
-    c1 = str->get();
-    c2 = str->get();
-    c3 = str->get();
     bufPtr = bufEnd = buf;
-    if (c3 == EOF) {
-        if (c0 == EOF) {
-            n = 0;
-            t = 0;
-        } else {
-            if (c1 == EOF) {
-                n = 1;
-                t = c0 << 24;
-            } else if (c2 == EOF) {
-                n = 2;
-                t = (c0 << 24) | (c1 << 16);
-            } else {
-                n = 3;
-                t = (c0 << 24) | (c1 << 16) | (c2 << 8);
+    nIn = readEncoderInput(str, in, sizeof(in));
+
+    // complete groups of 4 bytes
+    for (j = 0; j + 4 <= nIn; j += 4) {
+        t = ((unsigned)in[j] << 24) | (in[j + 1] << 16) | (in[j + 2] << 8) |
+            in[j + 3];
+        if (t == 0) {
+            *bufEnd++ = 'z';
+            if (++lineLen == 65) {
+                *bufEnd++ = '\n';
+                lineLen = 0;
             }
+        } else {
             for (i = 4; i >= 0; --i) {
                 buf1[i] = (char)(t % 85 + 0x21);
                 t /= 85;
             }
-            for (i = 0; i <= n; ++i) {
+            for (i = 0; i <= 4; ++i) {
                 *bufEnd++ = buf1[i];
                 if (++lineLen == 65) {
                     *bufEnd++ = '\n';
@@ -4597,23 +4664,21 @@ bool ASCII85Encoder::fillBuf()
                 }
             }
         }
-        *bufEnd++ = '~';
-        *bufEnd++ = '>';
-        eof = true;
-    } else {
-        t = (c0 << 24) | (c1 << 16) | (c2 << 8) | c3;
-        if (t == 0) {
-            *bufEnd++ = 'z';
-            if (++lineLen == 65) {
-                *bufEnd++ = '\n';
-                lineLen = 0;
+    }
+
+    // a short read means EOF: encode the 0-3 remaining bytes, and
+    // terminate
+    if (nIn < (int)sizeof(in)) {
+        if ((n = nIn - j) > 0) {
+            t = 0;
+            for (i = 0; i < n; ++i) {
+                t |= (unsigned)in[j + i] << (24 - 8 * i);
             }
-        } else {
             for (i = 4; i >= 0; --i) {
                 buf1[i] = (char)(t % 85 + 0x21);
                 t /= 85;
             }
-            for (i = 0; i <= 4; ++i) {
+            for (i = 0; i <= n; ++i) {
                 *bufEnd++ = buf1[i];
                 if (++lineLen == 65) {
                     *bufEnd++ = '\n';
@@ -4621,6 +4686,9 @@ bool ASCII85Encoder::fillBuf()
                 }
             }
         }
+        *bufEnd++ = '~';
+        *bufEnd++ = '>';
+        eof = true;
     }
     return true;
 }
@@ -4632,7 +4700,9 @@ bool ASCII85Encoder::fillBuf()
 RunLengthEncoder::RunLengthEncoder(Stream *strA)
     : FilterStream(strA)
 {
-    bufPtr = bufEnd = nextEnd = buf;
+    bufPtr = bufEnd = buf;
+    inBufPtr = inBufLen = 0;
+    nNext = 0;
     eof = false;
 }
 
@@ -4645,93 +4715,116 @@ RunLengthEncoder::~RunLengthEncoder()
 void RunLengthEncoder::reset()
 {
     str->reset();
-    bufPtr = bufEnd = nextEnd = buf;
+    bufPtr = bufEnd = buf;
+    inBufPtr = inBufLen = 0;
+    nNext = 0;
     eof = false;
 }
 
+int RunLengthEncoder::readblock(char *blk, int size)
+{
+    int n, m;
+
+    n = 0;
+    while (n < size) {
+        if (bufPtr >= bufEnd) {
+            if (!fillBuf()) {
+                break;
+            }
+        }
+        m = (int)(bufEnd - bufPtr);
+        if (m > size - n) {
+            m = size - n;
+        }
+        memcpy(blk + n, bufPtr, m);
+        bufPtr += m;
+        n += m;
+    }
+    return n;
+}
+
+//
+// Each run in buf[] looks like this:
+//   +-----+--------------+--
+//   + tag | ... data ... |
+//   +-----+--------------+--
+//    ^                    ^
+//    p                    bufEnd
 //
-// When fillBuf finishes, buf[] looks like this:
-//   +-----+--------------+-----------------+--
-//   + tag | ... data ... | next 0, 1, or 2 |
-//   +-----+--------------+-----------------+--
-//    ^                    ^                 ^
-//    bufPtr               bufEnd            nextEnd
+// A literal run that stops at a repeated pair leaves the pair in
+// next[], to start the following run.
 //
 bool RunLengthEncoder::fillBuf()
 {
-    int c, c1, c2;
-    int n;
+    char *p;
+    int   c, c1, c2;
+    int   n;
 
     // already hit EOF?
     if (eof)
         return false;
 
-    // grab two bytes
-    if (nextEnd < bufEnd + 1) {
-        if ((c1 = str->get()) == EOF) {
-            eof = true;
-            return false;
-        }
-    } else {
-        c1 = bufEnd[0] & 0xff;
-    }
-    if (nextEnd < bufEnd + 2) {
-        if ((c2 = str->get()) == EOF) {
+    bufPtr = bufEnd = buf;
+    while (!eof && bufEnd + 129 <= buf + sizeof(buf)) {
+        p = bufEnd;
+
+        // grab two bytes
+        if ((c1 = getInput()) == EOF) {
             eof = true;
-            buf[0] = 0;
-            buf[1] = c1;
-            bufPtr = buf;
-            bufEnd = &buf[2];
-            return true;
+            break;
         }
-    } else {
-        c2 = bufEnd[1] & 0xff;
-    }
-
-    // check for repeat
-    c = 0; // make gcc happy
-    if (c1 == c2) {
-        n = 2;
-        while (n < 128 && (c = str->get()) == c1)
-            ++n;
-        buf[0] = (char)(257 - n);
-        buf[1] = c1;
-        bufEnd = &buf[2];
-        if (c == EOF) {
+        if ((c2 = getInput()) == EOF) {
             eof = true;
-        } else if (n < 128) {
-            buf[2] = c;
-            nextEnd = &buf[3];
-        } else {
-            nextEnd = bufEnd;
+            p[0] = 0;
+            p[1] = c1;
+            bufEnd = p + 2;
+            break;
         }
 
-        // get up to 128 chars
-    } else {
-        buf[1] = c1;
-        buf[2] = c2;
-        n = 2;
-        while (n < 128) {
-            if ((c = str->get()) == EOF) {
+        // check for repeat
+        c = 0; // make gcc happy
+        if (c1 == c2) {
+            n = 2;
+            while (n < 128 && (c = getInput()) == c1)
+                ++n;
+            p[0] = (char)(257 - n);
+            p[1] = c1;
+            bufEnd = p + 2;
+            if (c == EOF) {
                 eof = true;
-                break;
+            } else if (n < 128) {
+                next[0] = c;
+                nNext = 1;
             }
-            ++n;
-            buf[n] = c;
-            if (buf[n] == buf[n - 1])
-                break;
-        }
-        if (buf[n] == buf[n - 1]) {
-            buf[0] = (char)(n - 2 - 1);
-            bufEnd = &buf[n - 1];
-            nextEnd = &buf[n + 1];
+
+            // get up to 128 chars
         } else {
-            buf[0] = (char)(n - 1);
-            bufEnd = nextEnd = &buf[n + 1];
+            p[1] = c1;
+            p[2] = c2;
+            n = 2;
+            while (n < 128) {
+                if ((c = getInput()) == EOF) {
+                    eof = true;
+                    break;
+                }
+                ++n;
+                p[n] = c;
+                if (p[n] == p[n - 1])
+                    break;
+            }
+            if (p[n] == p[n - 1]) {
+                p[0] = (char)(n - 2 - 1);
+                bufEnd = p + n - 1;
+                next[0] = p[n - 1] & 0xff;
+                next[1] = p[n] & 0xff;
+                nNext = 2;
+            } else {
+                p[0] = (char)(n - 1);
+                bufEnd = p + n + 1;
+            }
         }
     }
-    bufPtr = buf;
-    return true;
+    return bufPtr < bufEnd;
 }
 
 //------------------------------------------------------------------------
@@ -4741,7 +4834,7 @@ bool RunLengthEncoder::fillBuf()
 LZWEncoder::LZWEncoder(Stream *strA)
     : FilterStream(strA)
 {
-    inBufLen = 0;
+    inBufPtr = inBufLen = 0;
     outBufLen = 0;
 }
 
@@ -4768,6 +4861,7 @@ void LZWEncoder::reset()
     codeLen = 9;
 
     // initialize input buffer
+    inBufPtr = 0;
     inBufLen = str->readblock((char *)inBuf, sizeof(inBuf));
 
     // initialize output buffer with a clear-table code
@@ -4811,12 +4905,39 @@ int LZWEncoder::peek()
     }
 }
 
+int LZWEncoder::readblock(char *blk, int size)
+{
+    int n;
+
+    n = 0;
+    while (n < size) {
+        if (outBufLen < 8) {
+            if (inBufLen > 0 || needEOD) {
+                fillBuf();
+            } else if (outBufLen > 0) {
+                // last (partial) byte
+                blk[n++] = (char)((outBuf << (8 - outBufLen)) & 0xff);
+                outBufLen = 0;
+                break;
+            } else {
+                break;
+            }
+        }
+        while (n < size && outBufLen >= 8) {
+            blk[n++] = (char)((outBuf >> (outBufLen - 8)) & 0xff);
+            outBufLen -= 8;
+        }
+    }
+    return n;
+}
+
 // On input, outBufLen < 8.
 // This function generates, at most, 2 12-bit codes
 //   --> outBufLen < 8 + 12 + 12 = 32
 void LZWEncoder::fillBuf()
 {
     LZWEncoderNode *p0, *p1;
+    unsigned char * in;
     int             seqLen, code, i;
 
     if (needEOD) {
@@ -4827,11 +4948,12 @@ void LZWEncoder::fillBuf()
     }
 
     // find longest matching sequence (if any)
-    p0 = table + inBuf[0];
+    in = inBuf + inBufPtr;
+    p0 = table + in[0];
     seqLen = 1;
     while (inBufLen > seqLen) {
         for (p1 = p0->children; p1; p1 = p1->next) {
-            if (p1->byte == inBuf[seqLen]) {
+            if (p1->byte == in[seqLen]) {
                 break;
             }
         }
@@ -4848,7 +4970,7 @@ void LZWEncoder::fillBuf()
     outBufLen += codeLen;
 
     // update the table
-    table[nextSeq].byte = seqLen < inBufLen ? inBuf[seqLen] : 0;
+    table[nextSeq].byte = seqLen < inBufLen ? in[seqLen] : 0;
     table[nextSeq].children = NULL;
     if (table[code].children) {
         table[nextSeq].next = table[code].children;
@@ -4858,10 +4980,17 @@ void LZWEncoder::fillBuf()
     table[code].children = table + nextSeq;
     ++nextSeq;
 
-    // update the input buffer
-    memmove(inBuf, inBuf + seqLen, inBufLen - seqLen);
+    // update the input buffer -- a match is always shorter than 4096
+    // bytes, so shift and refill only once the lookahead drops below
+    // that
+    inBufPtr += seqLen;
     inBufLen -= seqLen;
-    inBufLen += str->readblock((char *)inBuf + inBufLen, sizeof(inBuf) - inBufLen);
+    if (inBufLen < 4096 && inBufPtr >= 4096) {
+        memmove(inBuf, inBuf + inBufPtr, inBufLen);
+        inBufPtr = 0;
+        inBufLen +=
+            str->readblock((char *)inBuf + inBufLen, sizeof(inBuf) - inBufLen);
+    }
 
     // increment codeLen; generate clear-table code
     if (nextSeq == (1 << codeLen)) {
@@ -301,6 +301,8 @@ public:
     virtual off_t getStart() { return start; }
     virtual void        moveStart(int delta);
 
+    FILE *getFile() { return f; }
+
 private:
     bool fillBuf();
 
@@ -833,6 +835,7 @@ public:
     virtual void       reset();
     virtual int        get();
     virtual int        peek();
+    virtual int        readblock(char *blk, int size);
     virtual GString *getPSFilter(int psLevel, const char *indent) { return NULL; }
     virtual bool     isBinary(bool last = true);
     virtual bool     isEncoder() { return true; }
@@ -863,12 +866,15 @@ public:
     {
         return (bufPtr >= bufEnd && !fillBuf()) ? EOF : (*bufPtr & 0xff);
     }
+    virtual int      readblock(char *blk, int size);
     virtual GString *getPSFilter(int psLevel, const char *indent) { return NULL; }
     virtual bool     isBinary(bool last = true) { return false; }
     virtual bool     isEncoder() { return true; }
 
 private:
-    char  buf[4];
+    // fillBuf() encodes a block of 1024 input bytes at a time: 2048 hex
+    // digits, plus a newline every 64 digits, or the '>' terminator
+    char  buf[2048 + 32 + 1];
     char *bufPtr;
     char *bufEnd;
     int   lineLen;
@@ -898,12 +904,15 @@ public:
     {
         return (bufPtr >= bufEnd && !fillBuf()) ? EOF : (*bufPtr & 0xff);
     }
+    virtual int      readblock(char *blk, int size);
     virtual GString *getPSFilter(int psLevel, const char *indent) { return NULL; }
     virtual bool     isBinary(bool last = true) { return false; }
     virtual bool     isEncoder() { return true; }
 
 private:
-    char  buf[8];
+    // fillBuf() encodes a block of 1024 input bytes at a time: up to
+    // 1280 chars, plus a newline every 65 chars, and the '~>' terminator
+    char  buf[1280 + 20 + 2];
     char *bufPtr;
     char *bufEnd;
     int   lineLen;
@@ -933,17 +942,41 @@ public:
     {
         return (bufPtr >= bufEnd && !fillBuf()) ? EOF : (*bufPtr & 0xff);
     }
+    virtual int      readblock(char *blk, int size);
     virtual GString *getPSFilter(int psLevel, const char *indent) { return NULL; }
     virtual bool     isBinary(bool last = true) { return true; }
     virtual bool     isEncoder() { return true; }
 
 private:
-    char  buf[131];
-    char *bufPtr;
-    char *bufEnd;
-    char *nextEnd;
-    bool  eof;
-
+    char          buf[4096]; // encoded runs (each up to 129 bytes)
+    char *        bufPtr;
+    char *        bufEnd;
+    unsigned char inBuf[4096]; // input bytes
+    int           inBufPtr;
+    int           inBufLen;
+    int           next[2]; // bytes read ahead by the previous run
+    int           nNext;
+    bool          eof;
+
+    int getInput()
+    {
+        int c;
+
+        if (nNext > 0) {
+            c = next[0];
+            next[0] = next[1];
+            --nNext;
+            return c;
+        }
+        if (inBufPtr >= inBufLen) {
+            inBufPtr = 0;
+            if ((inBufLen = str->readblock((char *)inBuf, sizeof(inBuf))) <= 0) {
+                inBufLen = 0;
+                return EOF;
+            }
+        }
+        return inBuf[inBufPtr++];
+    }
     bool fillBuf();
 };
 
@@ -969,6 +1002,7 @@ public:
     virtual void       reset();
     virtual int        get();
     virtual int        peek();
+    virtual int        readblock(char *blk, int size);
     virtual GString *getPSFilter(int psLevel, const char *indent) { return NULL; }
     virtual bool     isBinary(bool last = true) { return true; }
     virtual bool     isEncoder() { return true; }
@@ -977,8 +1011,11 @@ private:
     LZWEncoderNode table[4096];
     int            nextSeq;
     int            codeLen;
-    unsigned char  inBuf[4096];
-    int            inBufLen;
+    // at least 4096 bytes of lookahead start at inBuf + inBufPtr (fewer
+    // at EOF); the buffer is twice that so it is shifted once per 4 KB
+    unsigned char  inBuf[2 * 4096];
+    int            inBufPtr;
+    int            inBufLen; // number of lookahead bytes
     int            outBuf;
     int            outBufLen;
     bool           needEOD;
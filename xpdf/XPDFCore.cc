@@ -3,11 +3,17 @@
 
 #include <defs.hh>
 
+#include <climits>
 #include <cstring>
 #include <chrono>
 
+#include <sys/ipc.h>
+#include <sys/shm.h>
+
 #include <X11/keysym.h>
 #include <X11/cursorfont.h>
+#include <X11/Xlib.h>
+#include <X11/extensions/XShm.h>
 
 #include <utils/string.hh>
 #include <utils/GList.hh>
@@ -57,21 +63,38 @@ Atom      XPDFCore::targetsAtom;
 class XPDFCoreTile : public PDFCoreTile
 {
 public:
-    XPDFCoreTile(int xDestA, int yDestA);
+    XPDFCoreTile(Display *displayA, int xDestA, int yDestA);
     virtual ~XPDFCoreTile();
-    XImage *image;
+    Display *       display;
+    XImage *        image;
+    bool            shm; // set if image is in a MIT-SHM segment
+    bool            shmBusy; // set while the server may be reading image
+    bool            direct; // set if the bitmap is drawn in image->data
+    XShmSegmentInfo shmInfo;
 };
 
-XPDFCoreTile::XPDFCoreTile(int xDestA, int yDestA)
+XPDFCoreTile::XPDFCoreTile(Display *displayA, int xDestA, int yDestA)
     : PDFCoreTile(xDestA, yDestA)
 {
+    display = displayA;
     image = NULL;
+    shm = false;
+    shmBusy = false;
+    direct = false;
 }
 
 XPDFCoreTile::~XPDFCoreTile()
 {
     if (image) {
-        free(image->data);
+        // no need to wait for pending XShmPutImage requests: the server
+        // handles them before the detach, and keeps its own attachment
+        // to the segment until then
+        if (shm) {
+            XShmDetach(display, &shmInfo);
+            shmdt(shmInfo.shmaddr);
+        } else {
+            free(image->data);
+        }
         image->data = NULL;
         XDestroyImage(image);
     }
@@ -81,11 +104,47 @@ XPDFCoreTile::~XPDFCoreTile()
 // XPDFCore
 //------------------------------------------------------------------------
 
+// Rasterize in XBGR8 if the default visual stores pixels in the same
+// layout (32-bit little-endian 0x00RRGGBB TrueColor), so tile rows go
+// to the XImage unchanged; otherwise in RGB8.
+static SplashColorMode getTileColorMode(Widget widget)
+{
+    Display *            display;
+    Visual *             visual;
+    XPixmapFormatValues *formats;
+    int                  screenNum, depth, nFormats, bpp, i;
+
+    display = XtDisplay(widget);
+    screenNum = XScreenNumberOfScreen(XtScreen(widget));
+    visual = DefaultVisual(display, screenNum);
+    depth = DefaultDepth(display, screenNum);
+
+    if (visual->c_class != TrueColor || visual->red_mask != 0xff0000 ||
+        visual->green_mask != 0x00ff00 || visual->blue_mask != 0x0000ff ||
+        ImageByteOrder(display) != LSBFirst) {
+        return splashModeRGB8;
+    }
+
+    bpp = 0;
+    if ((formats = XListPixmapFormats(display, &nFormats))) {
+        for (i = 0; i < nFormats; ++i) {
+            if (formats[i].depth == depth) {
+                bpp = formats[i].bits_per_pixel;
+                break;
+            }
+        }
+        XFree(formats);
+    }
+
+    return bpp == 32 ? splashModeXBGR8 : splashModeRGB8;
+}
+
 XPDFCore::XPDFCore(Widget shellA, Widget parentWidgetA,
                    SplashColorPtr paperColorA, size_t paperPixelA,
                    size_t mattePixelA, bool fullScreenA, bool reverseVideoA,
                    bool installCmap, int rgbCubeSizeA)
-    : PDFCore(splashModeRGB8, 4, reverseVideoA, paperColorA, !fullScreenA)
+    : PDFCore(getTileColorMode(parentWidgetA), 4, reverseVideoA, paperColorA,
+              !fullScreenA)
 {
     GString *initialZoom;
 
@@ -822,6 +881,10 @@ void XPDFCore::setupX(bool installCmap, int rgbCubeSizeA)
     }
     XFree((XPointer)visualList);
 
+    // use MIT-SHM images if the server has the extension (this is
+    // turned off later if the server can't attach our segments)
+    useShm = XShmQueryExtension(display);
+
     // allocate a color cube
     if (!trueColor) {
         // set colors in private colormap
@@ -1208,7 +1271,106 @@ void XPDFCore::inputCbk(Widget widget, XtPointer ptr, XtPointer callData)
 
 PDFCoreTile *XPDFCore::newTile(int xDestA, int yDestA)
 {
-    return new XPDFCoreTile(xDestA, yDestA);
+    return new XPDFCoreTile(display, xDestA, yDestA);
+}
+
+static bool shmAttachFailed;
+
+static int shmAttachErrorHandler(Display *display, XErrorEvent *event)
+{
+    shmAttachFailed = true;
+    return 0;
+}
+
+// Create the image for <tile> in a shared memory segment, which the X
+// server reads directly (no copy over the socket).  If <rowSize> is
+// non-zero, it overrides the image's row size.  Returns false if that
+// fails -- and turns MIT-SHM off if the server can't attach the
+// segment, e.g., on a remote display.
+bool XPDFCore::createShmImage(PDFCoreTile *tileA, int w, int h, int rowSize)
+{
+    XPDFCoreTile *tile = (XPDFCoreTile *)tileA;
+    XImage *      image;
+    XErrorHandler oldHandler;
+
+    image = XShmCreateImage(display, visual, depth, ZPixmap, NULL,
+                            &tile->shmInfo, w, h);
+    if (!image) {
+        return false;
+    }
+    if (rowSize > 0) {
+        image->bytes_per_line = rowSize;
+    }
+    tile->shmInfo.shmid =
+        shmget(IPC_PRIVATE, (size_t)image->bytes_per_line * h, IPC_CREAT | 0600);
+    if (tile->shmInfo.shmid < 0) {
+        XDestroyImage(image);
+        return false;
+    }
+    tile->shmInfo.shmaddr = (char *)shmat(tile->shmInfo.shmid, NULL, 0);
+    if (tile->shmInfo.shmaddr == (char *)-1) {
+        shmctl(tile->shmInfo.shmid, IPC_RMID, NULL);
+        XDestroyImage(image);
+        return false;
+    }
+    image->data = tile->shmInfo.shmaddr;
+    tile->shmInfo.readOnly = False;
+
+    XSync(display, False);
+    shmAttachFailed = false;
+    oldHandler = XSetErrorHandler(&shmAttachErrorHandler);
+    XShmAttach(display, &tile->shmInfo);
+    XSync(display, False);
+    XSetErrorHandler(oldHandler);
+
+    // the segment is freed once both the server and we have detached
+    shmctl(tile->shmInfo.shmid, IPC_RMID, NULL);
+
+    if (shmAttachFailed) {
+        shmdt(tile->shmInfo.shmaddr);
+        image->data = NULL;
+        XDestroyImage(image);
+        useShm = false;
+        return false;
+    }
+    tile->image = image;
+    tile->shm = true;
+    return true;
+}
+
+// The server reads a MIT-SHM image asynchronously: wait for the last
+// XShmPutImage from <tile> before its pixels are changed.
+void XPDFCore::startTileUpdate(PDFCoreTile *tileA)
+{
+    XPDFCoreTile *tile = (XPDFCoreTile *)tileA;
+
+    if (tile->shmBusy) {
+        XSync(display, False);
+        tile->shmBusy = false;
+    }
+}
+
+// Rasterize XBGR8 tiles straight into their MIT-SHM image, which has
+// the same pixel layout (see getTileColorMode).  Rows are padded as in
+// other XBGR8 bitmaps.  Other tiles are converted into their image by
+// updateTileData.
+SplashBitmap *XPDFCore::newTileBitmap(PDFCoreTile *tileA, int w, int h)
+{
+    XPDFCoreTile *tile = (XPDFCoreTile *)tileA;
+    int           rowSize;
+
+    if (!useShm || out->getColorMode() != splashModeXBGR8 || tile->image ||
+        w > (INT_MAX - splashBitmapRowAlign) / 4) {
+        return NULL;
+    }
+    rowSize = w * 4 + splashBitmapRowAlign - 1;
+    rowSize -= rowSize % splashBitmapRowAlign;
+    if (!createShmImage(tile, w, h, rowSize)) {
+        return NULL;
+    }
+    tile->direct = true;
+    return new SplashBitmap(w, h, (SplashColorPtr)tile->image->data, rowSize,
+                            splashModeXBGR8, true);
 }
 
 void XPDFCore::updateTileData(PDFCoreTile *tileA, int xSrc, int ySrc, int width,
@@ -1225,23 +1387,85 @@ void XPDFCore::updateTileData(PDFCoreTile *tileA, int xSrc, int ySrc, int width,
     int            errRightR, errRightG, errRightB;
     int            errDownRightR, errDownRightG, errDownRightB;
     int            r0, g0, b0, re, ge, be;
+    int            pixSize;
+    bool           direct;
+    unsigned char *q;
+
+    // the pixels are already in the image -- while the page is being
+    // rasterized, they are shown before being composited with the paper
+    // color (and may change while the server reads them), which the
+    // final update takes care of
+    if (tile->direct) {
+        return;
+    }
 
     if (!tile->image) {
         w = tile->xMax - tile->xMin;
         h = tile->yMax - tile->yMin;
-        image =
-            XCreateImage(display, visual, depth, ZPixmap, 0, NULL, w, h, 8, 0);
-        image->data = (char *)calloc(h, image->bytes_per_line);
-        tile->image = image;
-    } else {
-        image = (XImage *)tile->image;
+        if (!useShm || !createShmImage(tile, w, h)) {
+            image = XCreateImage(display, visual, depth, ZPixmap, 0, NULL, w, h,
+                                 8, 0);
+            image->data = (char *)calloc(h, image->bytes_per_line);
+            tile->image = image;
+        }
     }
+    image = tile->image;
+    startTileUpdate(tile);
 
-    //~ optimize for known XImage formats
     bw = tile->bitmap->getRowSize();
     dataPtr = tile->bitmap->getDataPtr();
-
-    if (trueColor) {
+    pixSize = tile->bitmap->getMode() == splashModeXBGR8 ? 4 : 3;
+
+    // 32-bit 0x00RRGGBB little-endian pixels (the common TrueColor
+    // format) are written directly to the image data -- XBGR8 bitmaps
+    // are only used with such visuals (see getTileColorMode), and
+    // already have this layout
+    direct = pixSize == 4 ||
+             (trueColor && image->bits_per_pixel == 32 &&
+              image->byte_order == LSBFirst && rShift == 16 && gShift == 8 &&
+              bShift == 0 && rDiv == 0 && gDiv == 0 && bDiv == 0);
+
+    if (direct) {
+        for (y = 0; y < height; ++y) {
+            p = dataPtr + (ySrc + y) * bw + xSrc * pixSize;
+            q = (unsigned char *)image->data +
+                (ySrc + y) * image->bytes_per_line + xSrc * 4;
+            if (!composited && tile->bitmap->getAlphaPtr()) {
+                ap = tile->bitmap->getAlphaPtr() +
+                     (ySrc + y) * tile->bitmap->getWidth() + xSrc;
+            } else {
+                ap = NULL;
+            }
+            if (!ap && pixSize == 4) {
+                memcpy(q, p, width * 4);
+                continue;
+            }
+            for (x = 0; x < width; ++x) {
+                if (pixSize == 4) {
+                    r = splashXBGR8R(p);
+                    g = splashXBGR8G(p);
+                    b = splashXBGR8B(p);
+                } else {
+                    r = splashRGB8R(p);
+                    g = splashRGB8G(p);
+                    b = splashRGB8B(p);
+                }
+                if (ap) {
+                    alpha = *ap++;
+                    alpha1 = 255 - alpha;
+                    r = div255(alpha1 * paperColor[0] + alpha * r);
+                    g = div255(alpha1 * paperColor[1] + alpha * g);
+                    b = div255(alpha1 * paperColor[2] + alpha * b);
+                }
+                q[0] = (unsigned char)b;
+                q[1] = (unsigned char)g;
+                q[2] = (unsigned char)r;
+                q[3] = 0;
+                p += pixSize;
+                q += 4;
+            }
+        }
+    } else if (trueColor) {
         for (y = 0; y < height; ++y) {
             p = dataPtr + (ySrc + y) * bw + xSrc * 3;
             if (!composited && tile->bitmap->getAlphaPtr()) {
@@ -1395,7 +1619,11 @@ void XPDFCore::redrawRect(PDFCoreTile *tileA, int xSrc, int ySrc, int xDest,
     }
 
     // draw the document
-    if (tile) {
+    if (tile && tile->shm) {
+        XShmPutImage(display, drawAreaWin, drawAreaGC, tile->image, xSrc, ySrc,
+                     xDest, yDest, width, height, False);
+        tile->shmBusy = true;
+    } else if (tile) {
         XPutImage(display, drawAreaWin, drawAreaGC, tile->image, xSrc, ySrc,
                   xDest, yDest, width, height);
 
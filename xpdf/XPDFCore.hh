@@ -167,6 +167,9 @@ private:
     static void redrawCbk(Widget widget, XtPointer ptr, XtPointer callData);
     static void inputCbk(Widget widget, XtPointer ptr, XtPointer callData);
     virtual PDFCoreTile *newTile(int xDestA, int yDestA);
+    bool createShmImage(PDFCoreTile *tileA, int w, int h, int rowSize = 0);
+    virtual SplashBitmap *newTileBitmap(PDFCoreTile *tileA, int w, int h);
+    virtual void          startTileUpdate(PDFCoreTile *tileA);
     virtual void updateTileData(PDFCoreTile *tileA, int xSrc, int ySrc, int width,
                                 int height, bool composited);
     virtual void redrawRect(PDFCoreTile *tileA, int xSrc, int ySrc, int xDest,
@@ -194,6 +197,7 @@ private:
     Colormap colormap;
     unsigned depth; // visual depth
     bool     trueColor; // set if using a TrueColor visual
+    bool     useShm; // set if tile images are in MIT-SHM segments
     int      rDiv, gDiv, bDiv; // RGB right shifts (for TrueColor)
     int      rShift, gShift, bShift; // RGB left shifts (for TrueColor)
     int      rgbCubeSize; // size of color cube (for non-TrueColor)
@@ -9,8 +9,13 @@
 #include <cctype>
 #include <climits>
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #include <iostream>
 #include <limits>
+#include <thread>
+#include <vector>
 
 #include <utils/memory.hh>
 #include <utils/path.hh>
@@ -23,12 +28,16 @@
 #include <xpdf/Error.hh>
 #include <xpdf/ErrorCodes.hh>
 #include <xpdf/XRef.hh>
+#include <xpdf/GlobalParams.hh>
 
 //------------------------------------------------------------------------
 
 #define xrefSearchSize 1024 // read this many bytes at end of file
 //   to look for 'startxref'
 
+#define xrefRepairChunkSize (64 << 20) // file chunk scanned by each
+//   thread when repairing a damaged file
+
 //------------------------------------------------------------------------
 // Permission bits
 //------------------------------------------------------------------------
@@ -123,6 +132,27 @@ int XRefPosSet::find(off_t pos)
     return b;
 }
 
+//------------------------------------------------------------------------
+// XRefEntry
+//------------------------------------------------------------------------
+
+bool XRefEntry::set(XRefEntryType type, off_t offset, int gen)
+{
+    if (offset < 0 || offset >= ((off_t)1 << 42) || gen < 0) {
+        return false;
+    }
+    if (gen > 0xfffff) {
+        // the generation of a free entry doesn't matter
+        if (type != xrefEntryFree) {
+            return false;
+        }
+        gen = 0xfffff;
+    }
+    bits = ((unsigned long long)offset << 22) |
+           ((unsigned long long)gen << 2) | (unsigned long long)(type + 1);
+    return true;
+}
+
 //------------------------------------------------------------------------
 // ObjectStream
 //------------------------------------------------------------------------
@@ -142,28 +172,33 @@ public:
     int getObjStrNum() { return objStrNum; }
 
     // Get the <objIdx>th object from this stream, which should be
-    // object number <objNum>, generation 0.
+    // object number <objNum>, generation 0.  Objects are parsed on
+    // first use.
     Object *getObject(int objIdx, int objNum, Object *obj);
 
 private:
-    int     objStrNum; // object number of the object stream
-    int     nObjects; // number of objects in the stream
-    Object *objs; // the objects (length = nObjects)
-    int *   objNums; // the object numbers (length = nObjects)
-    bool    ok;
+    XRef *              xref;
+    int                 objStrNum; // object number of the object stream
+    int                 nObjects; // number of objects in the stream
+    std::vector< char > data; // the decoded stream data, past the
+        //   header
+    std::vector< int >    offsets; // object offsets in <data>
+    std::vector< int >    objNums; // the object numbers
+    std::vector< Object > objs; // the parsed objects
+    std::vector< bool >   parsed; // which of <objs> have been parsed
+    bool                  ok;
 };
 
-ObjectStream::ObjectStream(XRef *xref, int objStrNumA)
+ObjectStream::ObjectStream(XRef *xrefA, int objStrNumA)
 {
     Stream *str;
-    int *   offsets;
     Object  objStr, obj1, obj2;
-    int     first, i;
+    char    buf[4096];
+    int     first, n, i;
 
+    xref = xrefA;
     objStrNum = objStrNumA;
     nObjects = 0;
-    objs = NULL;
-    objNums = NULL;
     ok = false;
 
     if (!xref->fetch(objStrNum, 0, &objStr)->is_stream()) {
@@ -191,17 +226,14 @@ ObjectStream::ObjectStream(XRef *xref, int objStrNumA)
     }
 
     // this is an arbitrary limit to avoid integer overflow problems
-    // in the 'new Object[nObjects]' call (Acrobat apparently limits
-    // object streams to 100-200 objects)
+    // (Acrobat apparently limits object streams to 100-200 objects)
     if (nObjects > 1000000) {
         error(errSyntaxError, -1, "Too many objects in an object stream");
         return;
     }
 
-    objs = new Object[nObjects];
-
-    objNums = (int *)calloc(nObjects, sizeof(int));
-    offsets = (int *)calloc(nObjects, sizeof(int));
+    objNums.resize(nObjects);
+    offsets.resize(nObjects);
 
     // parse the header: object numbers and offsets
     objStr.streamReset();
@@ -216,7 +248,6 @@ ObjectStream::ObjectStream(XRef *xref, int objStrNumA)
         parser.getObj(&obj2, true);
 
         if (!obj1.is_int() || !obj2.is_int()) {
-            free(offsets);
             return;
         }
 
@@ -225,57 +256,269 @@ ObjectStream::ObjectStream(XRef *xref, int objStrNumA)
 
         if (objNums[i] < 0 || offsets[i] < 0 ||
             (i > 0 && offsets[i] < offsets[i - 1])) {
-            free(offsets);
             return;
         }
     }
     while (str->get() != EOF)
         ;
 
-    // skip to the first object - this shouldn't be necessary because
-    // the First key is supposed to be equal to offsets[0], but just in
-    // case...
-    if (i < offsets[0]) {
-        objStr.as_stream()->skip(offsets[0] - i);
+    // read the rest of the stream, which holds the objects themselves
+    // -- the offsets are relative to First
+    while ((n = objStr.as_stream()->readblock(buf, sizeof(buf))) > 0) {
+        data.insert(data.end(), buf, buf + n);
     }
 
-    // parse the objects
-    for (i = 0; i < nObjects; ++i) {
-        obj1 = {};
-        if (i == nObjects - 1) {
-            str = new EmbedStream(objStr.as_stream(), &obj1, false, 0);
-        } else {
-            str = new EmbedStream(objStr.as_stream(), &obj1, true,
-                                  offsets[i + 1] - offsets[i]);
+    objs.resize(nObjects);
+    parsed.resize(nObjects, false);
+    ok = true;
+}
+
+ObjectStream::~ObjectStream() { }
+
+Object *ObjectStream::getObject(int objIdx, int objNum, Object *obj)
+{
+    Stream *str;
+    Object  obj1;
+    int     start, end;
+
+    if (objIdx < 0 || objIdx >= nObjects || objNum != objNums[objIdx]) {
+        *obj = {};
+        return obj;
+    }
+
+    if (!parsed[objIdx]) {
+        parsed[objIdx] = true;
+
+        start = offsets[objIdx];
+        end = objIdx + 1 < nObjects ? offsets[objIdx + 1] : (int)data.size();
+        if (end > (int)data.size()) {
+            end = (int)data.size();
         }
 
-        Parser parser(xref, new Lexer(str), false);
-        parser.getObj(&objs[i]);
+        if (start < end) {
+            obj1 = {};
+            str = new MemStream(data.data(), start, end - start, &obj1);
 
-        while (str->get() != EOF)
-            ;
+            Parser parser(xref, new Lexer(str), false);
+            parser.getObj(&objs[objIdx]);
+        }
     }
 
-    free(offsets);
-    ok = true;
+    return *obj = objs[objIdx], obj;
 }
 
-ObjectStream::~ObjectStream()
+//------------------------------------------------------------------------
+// XRefFileView
+//------------------------------------------------------------------------
+
+// Read-only view of the whole file, from the start of the base stream,
+// used when repairing a damaged xref table.  Files are memory-mapped;
+// other streams are read into memory.
+class XRefFileView
+{
+public:
+    XRefFileView(BaseStream *str);
+    ~XRefFileView();
+
+    const char *getData() { return data; }
+    size_t      getLength() { return len; }
+
+private:
+    void *              map;
+    size_t              mapLen;
+    std::vector< char > buf;
+    const char *        data;
+    size_t              len;
+};
+
+XRefFileView::XRefFileView(BaseStream *str)
 {
-    if (objs) {
-        delete[] objs;
+    struct stat st;
+    off_t       start;
+    FILE *      f;
+    int         n;
+
+    map = NULL;
+    mapLen = 0;
+    data = NULL;
+    len = 0;
+
+    start = str->getStart();
+
+    if (str->type() == typeid(FileStream)) {
+        f = static_cast< FileStream * >(str)->getFile();
+        if (fstat(fileno(f), &st) == 0 && S_ISREG(st.st_mode) &&
+            st.st_size > start) {
+            mapLen = (size_t)st.st_size;
+            map = mmap(NULL, mapLen, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+            if (map != MAP_FAILED) {
+                madvise(map, mapLen, MADV_SEQUENTIAL);
+                data = (const char *)map + start;
+                len = mapLen - start;
+                return;
+            }
+            map = NULL;
+            mapLen = 0;
+        }
     }
-    free(objNums);
+
+    str->reset();
+    do {
+        buf.resize(len + 65536);
+        n = str->readblock(buf.data() + len, 65536);
+        len += n > 0 ? n : 0;
+    } while (n > 0);
+
+    data = buf.data();
 }
 
-Object *ObjectStream::getObject(int objIdx, int objNum, Object *obj)
+XRefFileView::~XRefFileView()
 {
-    if (objIdx < 0 || objIdx >= nObjects || objNum != objNums[objIdx]) {
-        *obj = {};
-        return obj;
+    if (map) {
+        munmap(map, mapLen);
     }
+}
 
-    return *obj = objs[objIdx], obj;
+//------------------------------------------------------------------------
+// XRefScanner
+//------------------------------------------------------------------------
+
+// Markers found by scanning the lines that start in one chunk of the
+// file.  Positions are relative to the start of the file view.
+struct XRefScanResult
+{
+    struct Obj
+    {
+        int    num, gen;
+        size_t pos;
+    };
+
+    std::vector< Obj >    objs; // 'N G obj' lines, in file order
+    std::vector< size_t > streamEnds; // 'endstream' lines
+    std::vector< size_t > trailers; // 'trailer' keywords
+    int                   maxNum = -1;
+};
+
+// Parse a decimal number, as atoi() would, without reading past <end>.
+static const char *scanInt(const char *p, const char *end, int *val)
+{
+    long long n;
+
+    for (n = 0; p < end && isdigit(*p & 0xff); ++p) {
+        if (n <= INT_MAX) {
+            n = n * 10 + (*p - '0');
+        }
+    }
+    *val = n > INT_MAX ? INT_MAX : (int)n;
+    return p;
+}
+
+// Look at one line of the file, or at one 255-byte piece of a longer
+// line (see scanXRefChunk).
+static void scanXRefLine(const char *data, size_t pos, const char *end,
+                         XRefScanResult *res)
+{
+    const char *p, *q;
+    int         num, gen;
+
+    p = data + pos;
+    if ((q = (const char *)memchr(p, '\0', end - p))) {
+        end = q;
+    }
+
+    // skip whitespace
+    while (p < end && Lexer::isSpace(*p & 0xff))
+        ++p;
+    if (p == end) {
+        return;
+    }
+
+    if (isdigit(*p & 0xff)) {
+        p = scanInt(p, end, &num);
+        if (num <= 0 || p == end || !isspace(*p & 0xff)) {
+            return;
+        }
+        do {
+            ++p;
+        } while (p < end && isspace(*p & 0xff));
+        if (p == end || !isdigit(*p & 0xff)) {
+            return;
+        }
+        p = scanInt(p, end, &gen);
+        if (p == end || !isspace(*p & 0xff)) {
+            return;
+        }
+        do {
+            ++p;
+        } while (p < end && isspace(*p & 0xff));
+        if (end - p >= 3 && !strncmp(p, "obj", 3)) {
+            res->objs.push_back({ num, gen, pos });
+            if (num > res->maxNum) {
+                res->maxNum = num;
+            }
+        }
+    } else if (end - p >= 7 && !strncmp(p, "trailer", 7)) {
+        res->trailers.push_back(p - data);
+    } else if (end - p >= 9 && !strncmp(p, "endstream", 9)) {
+        res->streamEnds.push_back(pos);
+    }
+}
+
+// Scan the lines starting in [<begin>, <end>) of the file view.  Line
+// ends are located with memchr, and each search result is reused until
+// the scan moves past it, so every byte is searched at most once per
+// end-of-line character.  Lines longer than 255 bytes are looked at in
+// 255-byte pieces, the way Stream::readline returns them.
+static void scanXRefChunk(const char *data, size_t len, size_t begin,
+                          size_t end, XRefScanResult *res)
+{
+    const char *p, *q, *lf, *cr, *eol, *dataEnd;
+
+    if (begin >= end) {
+        return;
+    }
+
+    dataEnd = data + len;
+    p = data + begin;
+
+    // move to the first line start in the chunk
+    if (begin > 0 && data[begin - 1] != '\n' &&
+        (data[begin - 1] != '\r' || data[begin] == '\n')) {
+        p = data + begin - 1;
+        while (p < dataEnd && *p != '\n' && *p != '\r') {
+            ++p;
+        }
+        if (p < dataEnd && *p == '\r' && p + 1 < dataEnd && p[1] == '\n') {
+            ++p;
+        }
+        if (p < dataEnd) {
+            ++p;
+        }
+    }
+
+    lf = cr = p - 1;
+    while (p < data + end) {
+        if (lf < p && !(lf = (const char *)memchr(p, '\n', dataEnd - p))) {
+            lf = dataEnd;
+        }
+        if (cr < p && !(cr = (const char *)memchr(p, '\r', dataEnd - p))) {
+            cr = dataEnd;
+        }
+        eol = lf < cr ? lf : cr;
+
+        for (q = p; eol - q > 255; q += 255) {
+            scanXRefLine(data, q - data, q + 255, res);
+        }
+        scanXRefLine(data, q - data, eol, res);
+
+        if (eol == dataEnd) {
+            break;
+        }
+        p = eol + 1;
+        if (*eol == '\r' && p < dataEnd && *p == '\n') {
+            ++p;
+        }
+    }
 }
 
 //------------------------------------------------------------------------
@@ -286,7 +529,6 @@ XRef::XRef(BaseStream *strA, bool repair)
 {
     off_t pos;
     Object      obj;
-    int         i;
 
     ok = true;
     errCode = errNone;
@@ -295,14 +537,15 @@ XRef::XRef(BaseStream *strA, bool repair)
     entries = NULL;
     streamEnds = NULL;
     streamEndsLen = 0;
-    for (i = 0; i < objStrCacheSize; ++i) {
-        objStrs[i] = NULL;
-    }
 
     encrypted = false;
     permFlags = defPermFlags;
     ownerPasswordOk = false;
 
+    linearized = false;
+    pendingXRefPos = 0;
+    pendingPosSet = NULL;
+
     str = strA;
     start = str->getStart();
 
@@ -323,10 +566,22 @@ XRef::XRef(BaseStream *strA, bool repair)
             return;
         }
 
-        // read the xref table
-        XRefPosSet posSet;
-        while (readXRef(&pos, &posSet))
-            ;
+        // read the xref table -- in a linearized file, the startxref
+        // entry points to the first-page section, which has all the
+        // objects needed for the first page; the rest of the chain is
+        // read when an object is not found in it
+        XRefPosSet *posSet = new XRefPosSet();
+        if ((linearized = checkLinearized())) {
+            if (readXRef(&pos, posSet)) {
+                pendingXRefPos = pos;
+                pendingPosSet = posSet;
+                posSet = NULL;
+            }
+        } else {
+            while (readXRef(&pos, posSet))
+                ;
+        }
+        delete posSet;
 
         if (!ok) {
             errCode = errDamaged;
@@ -352,14 +607,14 @@ XRef::~XRef()
 {
     free(entries);
 
+    delete pendingPosSet;
+
     if (streamEnds) {
         free(streamEnds);
     }
 
-    for (int i = 0; i < objStrCacheSize; ++i) {
-        if (objStrs[i]) {
-            delete objStrs[i];
-        }
+    for (auto objStr : objStrLRU) {
+        delete objStr;
     }
 }
 
@@ -391,6 +646,64 @@ off_t XRef::getStartXref()
     return lastXRefPos;
 }
 
+// Check for a linearization parameter dictionary at the start of the
+// file.  The file is only treated as linearized if the dictionary's
+// file length matches, i.e., if it has not been updated incrementally.
+bool XRef::checkLinearized()
+{
+    Object obj1, obj2, obj3, obj4;
+    off_t  fileLength;
+
+    obj1 = {};
+
+    Parser parser(NULL, new Lexer(str->makeSubStream(start, false, 0, &obj1)),
+                  true);
+
+    parser.getObj(&obj1, true);
+    parser.getObj(&obj2, true);
+    parser.getObj(&obj3, true);
+    parser.getObj(&obj4);
+
+    if (!obj1.is_int() || !obj2.is_int() || !obj3.is_cmd("obj") ||
+        !obj4.is_dict()) {
+        return false;
+    }
+
+    if (!(obj1 = obj4.as_dict()["Linearized"]).is_num() || obj1.as_num() <= 0) {
+        return false;
+    }
+
+    if (!(obj1 = obj4.as_dict()["L"]).is_int()) {
+        return false;
+    }
+
+    str->seekg(0, -1);
+    fileLength = str->tellg();
+
+    return obj1.as_int() == fileLength || obj1.as_int() == fileLength - start;
+}
+
+// Read the rest of the xref chain of a linearized file.
+void XRef::readPendingXRefs2()
+{
+    XRefPosSet *posSet;
+    off_t       pos;
+
+    posSet = pendingPosSet;
+    pendingPosSet = NULL;
+
+    pos = pendingXRefPos;
+    while (readXRef(&pos, posSet))
+        ;
+    delete posSet;
+
+    // the first-page section was fine, so keep using it
+    if (!ok) {
+        error(errSyntaxError, -1, "Couldn't read the main xref table");
+        ok = true;
+    }
+}
+
 // Read one xref table section.  Also reads the associated trailer
 // dictionary, and returns the prev pointer (if any).
 bool XRef::readXRef(off_t *pos, XRefPosSet *posSet)
@@ -448,12 +761,12 @@ err1:
 
 bool XRef::readXRefTable(off_t *pos, int offset, XRefPosSet *posSet)
 {
-    XRefEntry   entry;
-    Object      obj, obj2;
-    char        buf[6];
-    off_t off, pos2;
-    bool        more;
-    int         first, n, newSize, gen, i, c;
+    XRefEntryType type;
+    Object        obj, obj2;
+    char          buf[6];
+    off_t         off, pos2;
+    bool          more;
+    int           first, n, newSize, gen, i, c;
 
     if (posSet->check(*pos)) {
         error(errSyntaxWarning, -1, "Infinite loop in xref table");
@@ -508,8 +821,7 @@ bool XRef::readXRefTable(off_t *pos, int offset, XRefPosSet *posSet)
             entries =
                 (XRefEntry *)reallocarray(entries, newSize, sizeof(XRefEntry));
             for (i = size; i < newSize; ++i) {
-                entries[i].offset = (off_t)-1;
-                entries[i].type = xrefEntryFree;
+                entries[i].clear();
             }
             size = newSize;
         }
@@ -525,7 +837,6 @@ bool XRef::readXRefTable(off_t *pos, int offset, XRefPosSet *posSet)
             if (!Lexer::isSpace(c)) {
                 return ok = false;
             }
-            entry.offset = off;
             do {
                 c = str->get();
             } while (Lexer::isSpace(c));
@@ -537,14 +848,13 @@ bool XRef::readXRefTable(off_t *pos, int offset, XRefPosSet *posSet)
             if (!Lexer::isSpace(c)) {
                 return ok = false;
             }
-            entry.gen = gen;
             do {
                 c = str->get();
             } while (Lexer::isSpace(c));
             if (c == 'n') {
-                entry.type = xrefEntryUncompressed;
+                type = xrefEntryUncompressed;
             } else if (c == 'f') {
-                entry.type = xrefEntryFree;
+                type = xrefEntryFree;
             } else {
                 return ok = false;
             }
@@ -552,16 +862,19 @@ bool XRef::readXRefTable(off_t *pos, int offset, XRefPosSet *posSet)
             if (!Lexer::isSpace(c)) {
                 return ok = false;
             }
-            if (entries[i].offset == (off_t)-1) {
-                entries[i] = entry;
+            if (!entries[i].isSet()) {
+                if (!entries[i].set(type, off, gen)) {
+                    return ok = false;
+                }
                 // PDF files of patents from the IBM Intellectual Property
                 // Network have a bug: the xref table claims to start at 1
                 // instead of 0.
-                if (i == 1 && first == 1 && entries[1].offset == 0 &&
-                    entries[1].gen == 65535 && entries[1].type == xrefEntryFree) {
+                if (i == 1 && first == 1 && entries[1].getOffset() == 0 &&
+                    entries[1].getGen() == 65535 &&
+                    entries[1].getType() == xrefEntryFree) {
                     i = first = 0;
                     entries[0] = entries[1];
-                    entries[1].offset = (off_t)-1;
+                    entries[1].clear();
                 }
                 if (i > last) {
                     last = i;
@@ -635,8 +948,7 @@ bool XRef::readXRefStream(Stream *xrefStr, off_t *pos)
     if (newSize > size) {
         entries = (XRefEntry *)reallocarray(entries, newSize, sizeof(XRefEntry));
         for (i = size; i < newSize; ++i) {
-            entries[i].offset = (off_t)-1;
-            entries[i].type = xrefEntryFree;
+            entries[i].clear();
         }
         size = newSize;
     }
@@ -699,10 +1011,15 @@ err0:
     return false;
 }
 
+// Read and decode one xref stream subsection.  Entries that are
+// already set -- by a newer section -- are kept.  The data is decoded
+// a buffer at a time, so the raw section is never held in memory.
 bool XRef::readXRefStreamSection(Stream *xrefStr, int *w, int first, int n)
 {
-    off_t offset;
-    int         type, gen, c, newSize, i, j;
+    unsigned char        buf[4096];
+    const unsigned char *p;
+    off_t                offset;
+    int                  entrySize, type, gen, newSize, nBuf, i, j, k;
 
     if (first + n < 0) {
         return false;
@@ -716,102 +1033,173 @@ bool XRef::readXRefStreamSection(Stream *xrefStr, int *w, int first, int n)
         }
         entries = (XRefEntry *)reallocarray(entries, newSize, sizeof(XRefEntry));
         for (i = size; i < newSize; ++i) {
-            entries[i].offset = (off_t)-1;
-            entries[i].type = xrefEntryFree;
+            entries[i].clear();
         }
         size = newSize;
     }
-    for (i = first; i < first + n; ++i) {
-        if (w[0] == 0) {
-            type = 1;
-        } else {
-            for (type = 0, j = 0; j < w[0]; ++j) {
-                if ((c = xrefStr->get()) == EOF) {
-                    return false;
+    if (n == 0) {
+        return true;
+    }
+
+    // w[] is at most 4 + 8 + 4 bytes, so buf holds at least 256 entries
+    entrySize = w[0] + w[1] + w[2];
+    if (entrySize == 0) {
+        return false;
+    }
+    for (i = first; i < first + n; i += nBuf) {
+        nBuf = (int)sizeof(buf) / entrySize;
+        if (nBuf > first + n - i) {
+            nBuf = first + n - i;
+        }
+        if (xrefStr->readblock((char *)buf, nBuf * entrySize) !=
+            nBuf * entrySize) {
+            return false;
+        }
+        for (p = buf, k = i; k < i + nBuf; ++k) {
+            if (w[0] == 0) {
+                type = 1;
+            } else {
+                for (type = 0, j = 0; j < w[0]; ++j) {
+                    type = (type << 8) + *p++;
                 }
-                type = (type << 8) + c;
             }
-        }
-        for (offset = 0, j = 0; j < w[1]; ++j) {
-            if ((c = xrefStr->get()) == EOF) {
-                return false;
+            for (offset = 0, j = 0; j < w[1]; ++j) {
+                offset = (offset << 8) + *p++;
             }
-            offset = (offset << 8) + c;
-        }
-        for (gen = 0, j = 0; j < w[2]; ++j) {
-            if ((c = xrefStr->get()) == EOF) {
-                return false;
+            for (gen = 0, j = 0; j < w[2]; ++j) {
+                gen = (gen << 8) + *p++;
+            }
+            if (entries[k].isSet()) {
+                continue;
             }
-            gen = (gen << 8) + c;
-        }
-        if (entries[i].offset == (off_t)-1) {
             switch (type) {
             case 0:
-                entries[i].offset = offset;
-                entries[i].gen = gen;
-                entries[i].type = xrefEntryFree;
+                if (!entries[k].set(xrefEntryFree, offset, gen)) {
+                    entries[k].set(xrefEntryFree, 0, 0);
+                }
                 break;
             case 1:
-                entries[i].offset = offset;
-                entries[i].gen = gen;
-                entries[i].type = xrefEntryUncompressed;
-                break;
             case 2:
-                entries[i].offset = offset;
-                entries[i].gen = gen;
-                entries[i].type = xrefEntryCompressed;
+                if (!entries[k].set(type == 1 ? xrefEntryUncompressed :
+                                                xrefEntryCompressed,
+                                    offset, gen)) {
+                    error(errSyntaxError, -1, "Bad xref stream entry");
+                    entries[k].set(xrefEntryFree, 0, 0);
+                }
                 break;
             default:
-                return false;
-            }
-            if (i > last) {
-                last = i;
+                // unknown types are to be treated as null references
+                entries[k].set(xrefEntryFree, 0, 0);
+                break;
             }
         }
     }
 
+    if (first + n - 1 > last) {
+        last = first + n - 1;
+    }
+
     return true;
 }
 
-// Attempt to construct an xref table for a damaged file.
+// Attempt to construct an xref table for a damaged file, from the
+// object headers and 'trailer' lines found in a single pass over the
+// file.  The objects themselves are only parsed when fetched.
 bool XRef::constructXRef()
 {
-    Object      newTrailerDict, obj;
-    char        buf[256];
-    off_t pos;
-    int         num, gen;
-    int         newSize;
-    int         streamEndsSize;
-    char *      p;
-    int         i;
-    bool        gotRoot;
+    Object                        newTrailerDict, obj;
+    std::vector< XRefScanResult > results;
+    std::vector< std::thread >    threads;
+    size_t                        len, chunkSize;
+    int                           nThreads, maxNum, newSize, n, i;
 
     free(entries);
     size = 0;
     entries = NULL;
 
-    gotRoot = false;
-    streamEndsLen = streamEndsSize = 0;
+    delete pendingPosSet;
+    pendingPosSet = NULL;
 
-    str->reset();
-    while (1) {
-        pos = str->tellg();
-        if (!str->readline(buf, 256)) {
-            break;
+    streamEndsLen = 0;
+
+    XRefFileView view(str);
+    len = view.getLength();
+
+    // split large files into chunks scanned in parallel
+    nThreads = globalParams ? globalParams->getXRefRepairThreads() : 0;
+    if (nThreads <= 0) {
+        nThreads = (int)(len / xrefRepairChunkSize) + 1;
+        n = (int)std::thread::hardware_concurrency();
+        if (nThreads > n) {
+            nThreads = n > 0 ? n : 1;
         }
-        p = buf;
+    }
+    if ((size_t)nThreads > len / 4096 + 1) {
+        nThreads = (int)(len / 4096) + 1;
+    }
+    chunkSize = len / nThreads + 1;
 
-        // skip whitespace
-        while (*p && Lexer::isSpace(*p & 0xff))
-            ++p;
+    results.resize(nThreads);
+    for (i = 1; i < nThreads; ++i) {
+        threads.emplace_back(scanXRefChunk, view.getData(), len, i * chunkSize,
+                             std::min(len, (i + 1) * chunkSize), &results[i]);
+    }
+    scanXRefChunk(view.getData(), len, 0, std::min(len, chunkSize), &results[0]);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // merge the chunks, in file order, so that later objects override
+    // earlier ones exactly as in a sequential scan
+    maxNum = -1;
+    n = 0;
+    for (auto &res : results) {
+        maxNum = std::max(maxNum, res.maxNum);
+        n += (int)res.streamEnds.size();
+    }
 
-        // got trailer dictionary
-        if (!strncmp(p, "trailer", 7)) {
+    if (maxNum >= 0) {
+        newSize = (maxNum + 1 + 255) & ~255;
+        if (newSize < 0) {
+            error(errSyntaxError, -1, "Bad object number");
+            return false;
+        }
+        entries = (XRefEntry *)reallocarray(entries, newSize, sizeof(XRefEntry));
+        for (i = 0; i < newSize; ++i) {
+            entries[i].clear();
+        }
+        size = newSize;
+    }
+
+    if (n > 0) {
+        streamEnds = (off_t *)reallocarray(streamEnds, n, sizeof(off_t));
+    }
+
+    for (auto &res : results) {
+        for (auto &x : res.objs) {
+            if ((entries[x.num].getType() == xrefEntryFree ||
+                 x.gen >= entries[x.num].getGen()) &&
+                entries[x.num].set(xrefEntryUncompressed, x.pos, x.gen)) {
+                if (x.num > last) {
+                    last = x.num;
+                }
+            }
+        }
+        for (auto pos : res.streamEnds) {
+            streamEnds[streamEndsLen++] = start + pos;
+        }
+    }
+
+    // the last trailer dictionary with a valid root wins
+    for (auto iter = results.rbegin(); iter != results.rend(); ++iter) {
+        for (auto pos = iter->trailers.rbegin(); pos != iter->trailers.rend();
+             ++pos) {
             obj = {};
 
-            Parser parser(NULL,
-                          new Lexer(str->makeSubStream(pos + 7, false, 0, &obj)),
-                          false);
+            Parser parser(
+                NULL,
+                new Lexer(str->makeSubStream(start + *pos + 7, false, 0, &obj)),
+                false);
 
             parser.getObj(&newTrailerDict);
 
@@ -821,73 +1209,12 @@ bool XRef::constructXRef()
                     rootNum = obj.getRefNum();
                     rootGen = obj.getRefGen();
                     trailerDict = newTrailerDict;
-                    gotRoot = true;
+                    return true;
                 }
             }
-        } else if (isdigit(*p & 0xff)) {
-            // look for object
-            num = atoi(p);
-            if (num > 0) {
-                do {
-                    ++p;
-                } while (*p && isdigit(*p & 0xff));
-                if (isspace(*p & 0xff)) {
-                    do {
-                        ++p;
-                    } while (*p && isspace(*p & 0xff));
-                    if (isdigit(*p & 0xff)) {
-                        gen = atoi(p);
-                        do {
-                            ++p;
-                        } while (*p && isdigit(*p & 0xff));
-                        if (isspace(*p & 0xff)) {
-                            do {
-                                ++p;
-                            } while (*p && isspace(*p & 0xff));
-                            if (!strncmp(p, "obj", 3)) {
-                                if (num >= size) {
-                                    newSize = (num + 1 + 255) & ~255;
-                                    if (newSize < 0) {
-                                        error(errSyntaxError, -1,
-                                              "Bad object number");
-                                        return false;
-                                    }
-                                    entries = (XRefEntry *)reallocarray(
-                                        entries, newSize, sizeof(XRefEntry));
-                                    for (i = size; i < newSize; ++i) {
-                                        entries[i].offset = (off_t)-1;
-                                        entries[i].type = xrefEntryFree;
-                                    }
-                                    size = newSize;
-                                }
-                                if (entries[num].type == xrefEntryFree ||
-                                    gen >= entries[num].gen) {
-                                    entries[num].offset = pos - start;
-                                    entries[num].gen = gen;
-                                    entries[num].type = xrefEntryUncompressed;
-                                    if (num > last) {
-                                        last = num;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        } else if (!strncmp(p, "endstream", 9)) {
-            if (streamEndsLen == streamEndsSize) {
-                streamEndsSize += 64;
-                streamEnds = (off_t *)reallocarray(
-                    streamEnds, streamEndsSize, sizeof(off_t));
-            }
-            streamEnds[streamEndsLen++] = pos;
         }
     }
 
-    if (gotRoot) {
-        return true;
-    }
-
     error(errSyntaxError, -1, "Couldn't find trailer dictionary");
     return false;
 }
@@ -939,6 +1266,12 @@ Object *XRef::fetch(int num, int gen, Object *obj, int recursion)
     ObjectStream *objStr;
     Object        obj1, obj2, obj3;
 
+    // objects that are not in the first-page section of a linearized
+    // file are in the rest of the xref chain
+    if (pendingPosSet && num >= 0 && (num >= size || !entries[num].isSet())) {
+        readPendingXRefs2();
+    }
+
     // check for bogus ref - this can happen in corrupted PDF files
     if (num < 0 || num >= size) {
         goto err;
@@ -946,9 +1279,9 @@ Object *XRef::fetch(int num, int gen, Object *obj, int recursion)
 
     e = &entries[num];
 
-    switch (e->type) {
+    switch (e->getType()) {
     case xrefEntryUncompressed: {
-        if (e->gen != gen) {
+        if (e->getGen() != gen) {
             goto err;
         }
 
@@ -956,7 +1289,7 @@ Object *XRef::fetch(int num, int gen, Object *obj, int recursion)
 
         Parser parser(
             this,
-            new Lexer(str->makeSubStream(start + e->offset, false, 0, &obj1)),
+            new Lexer(str->makeSubStream(start + e->getOffset(), false, 0, &obj1)),
             true);
 
         parser.getObj(&obj1, true);
@@ -973,17 +1306,17 @@ Object *XRef::fetch(int num, int gen, Object *obj, int recursion)
     } break;
 
     case xrefEntryCompressed:
-        if (e->offset >= (off_t)size ||
-            entries[e->offset].type != xrefEntryUncompressed) {
+        if (e->getOffset() >= (off_t)size ||
+            entries[(int)e->getOffset()].getType() != xrefEntryUncompressed) {
             error(errSyntaxError, -1, "Invalid object stream");
             goto err;
         }
 
-        if (!(objStr = getObjectStream((int)e->offset))) {
+        if (!(objStr = getObjectStream((int)e->getOffset()))) {
             goto err;
         }
 
-        objStr->getObject(e->gen, num, obj);
+        objStr->getObject(e->getGen(), num, obj);
         break;
 
     default:
@@ -1000,23 +1333,12 @@ err:
 ObjectStream *XRef::getObjectStream(int objStrNum)
 {
     ObjectStream *objStr;
-    int           i, j;
 
-    // check the MRU entry in the cache
-    if (objStrs[0] && objStrs[0]->getObjStrNum() == objStrNum) {
-        return objStrs[0];
-    }
-
-    // check the rest of the cache
-    for (i = 1; i < objStrCacheSize; ++i) {
-        if (objStrs[i] && objStrs[i]->getObjStrNum() == objStrNum) {
-            objStr = objStrs[i];
-            for (j = i; j > 0; --j) {
-                objStrs[j] = objStrs[j - 1];
-            }
-            objStrs[0] = objStr;
-            return objStr;
-        }
+    // check the cache, and move a hit to the front of the LRU list
+    auto iter = objStrs.find(objStrNum);
+    if (iter != objStrs.end()) {
+        objStrLRU.splice(objStrLRU.begin(), objStrLRU, iter->second);
+        return *iter->second;
     }
 
     // load a new ObjectStream
@@ -1025,13 +1347,15 @@ ObjectStream *XRef::getObjectStream(int objStrNum)
         delete objStr;
         return NULL;
     }
-    if (objStrs[objStrCacheSize - 1]) {
-        delete objStrs[objStrCacheSize - 1];
-    }
-    for (j = objStrCacheSize - 1; j > 0; --j) {
-        objStrs[j] = objStrs[j - 1];
+
+    // evict the least recently used one
+    if (objStrLRU.size() >= objStrCacheSize) {
+        objStrs.erase(objStrLRU.back()->getObjStrNum());
+        delete objStrLRU.back();
+        objStrLRU.pop_back();
     }
-    objStrs[0] = objStr;
+    objStrLRU.push_front(objStr);
+    objStrs[objStrNum] = objStrLRU.begin();
     return objStr;
 }
 
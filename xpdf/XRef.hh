@@ -6,6 +6,9 @@
 
 #include <defs.hh>
 
+#include <list>
+#include <unordered_map>
+
 #include <utils/path.hh>
 
 #include <xpdf/obj.hh>
@@ -21,11 +24,31 @@ class XRefPosSet;
 
 enum XRefEntryType { xrefEntryFree, xrefEntryUncompressed, xrefEntryCompressed };
 
-struct XRefEntry
+// An xref entry, packed in 64 bits: the state in the low 2 bits (0
+// if the entry has not been read yet, else the type plus one), the
+// generation -- or the index in the object stream, for compressed
+// entries -- in the next 20 bits, and the file offset -- or the
+// object stream number -- in the upper 42 bits.
+class XRefEntry
 {
-    off_t   offset;
-    int           gen;
-    XRefEntryType type;
+public:
+    bool          isSet() { return (bits & 3) != 0; }
+    XRefEntryType getType()
+    {
+        return isSet() ? (XRefEntryType)((bits & 3) - 1) : xrefEntryFree;
+    }
+    off_t getOffset() { return (off_t)(bits >> 22); }
+    int   getGen() { return (int)((bits >> 2) & 0xfffff); }
+
+    // Set the entry.  Returns false if the offset or generation are
+    // out of range.
+    bool set(XRefEntryType type, off_t offset, int gen);
+
+    // Mark the entry as not read yet.
+    void clear() { bits = 0; }
+
+private:
+    unsigned long long bits;
 };
 
 struct XRefCacheEntry
@@ -35,7 +58,7 @@ struct XRefCacheEntry
     Object obj;
 };
 
-#define objStrCacheSize 4
+#define objStrCacheSize 64
 
 class XRef
 {
@@ -97,7 +120,15 @@ public:
     Object *getDocInfo(Object *obj);
 
     // Return the number of objects in the xref table.
-    int getNumObjects() { return last + 1; }
+    int getNumObjects()
+    {
+        readPendingXRefs();
+        return last + 1;
+    }
+
+    // Is the xref chain read lazily, starting with the first-page
+    // section of a linearized file?
+    bool isLinearized() { return linearized; }
 
     // Return the offset of the last xref table.
     off_t getLastXRefPos() { return lastXRefPos; }
@@ -111,7 +142,11 @@ public:
     bool getStreamEnd(off_t streamStart, off_t *streamEnd);
 
     // Direct access.
-    int getSize() { return size; }
+    int getSize()
+    {
+        readPendingXRefs();
+        return size;
+    }
 
     Object *getTrailerDict() { return &trailerDict; }
 
@@ -130,8 +165,10 @@ private:
     off_t *streamEnds; // 'endstream' positions - only used in
         //   damaged files
     int streamEndsLen; // number of valid entries in streamEnds
-    ObjectStream * // cached object streams
-                   objStrs[objStrCacheSize];
+    std::list< ObjectStream * > objStrLRU; // cached object streams,
+        //   most recently used first
+    std::unordered_map< int, std::list< ObjectStream * >::iterator >
+                   objStrs; // object stream number -> objStrLRU entry
     bool           encrypted; // true if file is encrypted
     int            permFlags; // permission bits
     bool           ownerPasswordOk; // true if owner password is correct
@@ -139,8 +176,21 @@ private:
     int            keyLength; // length of key, in bytes
     int            encVersion; // encryption version
     CryptAlgorithm encAlgorithm; // encryption algorithm
+    bool           linearized; // true if the file is linearized
+    off_t          pendingXRefPos; // next xref section to read, if
+        //   the chain is read lazily
+    XRefPosSet *pendingPosSet; // xref sections read so far, if the
+        //   chain is read lazily; NULL once it is complete
 
     off_t getStartXref();
+    bool  checkLinearized();
+    void  readPendingXRefs()
+    {
+        if (pendingPosSet) {
+            readPendingXRefs2();
+        }
+    }
+    void        readPendingXRefs2();
     bool        readXRef(off_t *pos, XRefPosSet *posSet);
     bool        readXRefTable(off_t *pos, int offset, XRefPosSet *posSet);
     bool        readXRefStreamSection(Stream *xrefStr, int *w, int first, int n);
@@ -0,0 +1,110 @@
+// -*- mode: c++; -*-
+// Copyright 2019-2020 Thinkoid, LLC.
+
+#include <defs.hh>
+
+#include <cstdio>
+
+#include <utils/string.hh>
+#include <utils/parseargs.hh>
+#include <xpdf/CMap.hh>
+#include <xpdf/CharCodeToUnicode.hh>
+#include <xpdf/GlobalParams.hh>
+
+//------------------------------------------------------------------------
+// command line options
+//------------------------------------------------------------------------
+
+static bool cidToUnicode = false;
+static char cfgFileName[256] = "";
+static bool printVersion = false;
+static bool printHelp = false;
+
+static ArgDesc argDesc[] = {
+    { "-cidToUnicode", argFlag, &cidToUnicode, 0,
+      "compile a CID-to-Unicode file instead of a CMap" },
+    { "-cfg", argString, cfgFileName, sizeof(cfgFileName),
+      "configuration file to use in place of .xpdfrc" },
+    { "-v", argFlag, &printVersion, 0, "print copyright and version info" },
+    { "-h", argFlag, &printHelp, 0, "print usage information" },
+    { "-help", argFlag, &printHelp, 0, "print usage information" },
+    { "--help", argFlag, &printHelp, 0, "print usage information" },
+    { "-?", argFlag, &printHelp, 0, "print usage information" },
+    {}
+};
+
+//------------------------------------------------------------------------
+
+// Compile a text CMap (found through the cMapDir entries for its
+// collection) or a CID-to-Unicode file into the binary form that is
+// memory-mapped at load time.  The output goes next to the input, with
+// a ".bin" suffix, to be picked up in place of it:
+//
+//   compilecmap Adobe-Japan1 UniJIS-UCS2-H <cMapDir>/UniJIS-UCS2-H.bin
+//   compilecmap -cidToUnicode Adobe-Japan1 <dir>/Adobe-Japan1.cidToUnicode
+//       <dir>/Adobe-Japan1.cidToUnicode.bin
+//
+// A CMap that uses another one (usecmap) is stored with the other one
+// merged in.  The binary files are in native byte order.
+int main(int argc, char *argv[])
+{
+    GString *          collection, *name;
+    CMap *             cMap;
+    CharCodeToUnicode *ctu;
+    bool               ok;
+    int                exitCode;
+
+    exitCode = 99;
+
+    // parse args
+    ok = parseArgs(argDesc, &argc, argv);
+    if (!ok || argc != 4 || printVersion || printHelp) {
+        fprintf(stderr, "compilecmap version %s\n", PACKAGE_VERSION);
+        fprintf(stderr, "%s\n", XPDF_COPYRIGHT);
+        if (!printVersion) {
+            printUsage("compilecmap",
+                       "<collection> <CMap-name> | <cidToUnicode-file> "
+                       "<output-file>",
+                       argDesc);
+        }
+        return exitCode;
+    }
+
+    // read config file
+    globalParams = new GlobalParams(cfgFileName);
+
+    collection = new GString(argv[1]);
+    name = new GString(argv[2]);
+
+    if (cidToUnicode) {
+        if ((ctu = CharCodeToUnicode::parseCIDToUnicode(name, collection))) {
+            if (ctu->writeBinary(argv[3])) {
+                exitCode = 0;
+            } else {
+                fprintf(stderr, "Couldn't write '%s'\n", argv[3]);
+                exitCode = 2;
+            }
+            ctu->decRefCnt();
+        } else {
+            exitCode = 1;
+        }
+    } else {
+        if ((cMap = CMap::parse(NULL, collection, name))) {
+            if (cMap->writeBinary(argv[3])) {
+                exitCode = 0;
+            } else {
+                fprintf(stderr, "Couldn't write '%s'\n", argv[3]);
+                exitCode = 2;
+            }
+            cMap->decRefCnt();
+        } else {
+            exitCode = 1;
+        }
+    }
+
+    delete name;
+    delete collection;
+    delete globalParams;
+
+    return exitCode;
+}
@@ -0,0 +1,443 @@
+// -*- mode: c++; -*-
+// Copyright 2020- Thinkoid, LLC
+
+#include <defs.hh>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+#include <algorithm>
+#include <fstream>
+#include <system_error>
+
+#include <utils/string.hh>
+
+#include <xpdf/config_cache.hh>
+
+//
+// Cache file layout, in native byte order: magic, byte order mark, then
+// the config files, the nameToUnicode files and the font directories, each
+// as a count followed by the entries.  Strings are a length followed by the
+// bytes.
+//
+static const char configCacheMagic[4] = { 'X', 'C', 'C', '1' };
+#define configCacheByteOrder 0x01020304
+
+namespace xpdf {
+namespace {
+
+struct writer_type
+{
+    void u32(uint32_t x) { buf.append((const char *)&x, sizeof x); }
+    void i64(int64_t x) { buf.append((const char *)&x, sizeof x); }
+
+    void str(const std::string &s)
+    {
+        u32(uint32_t(s.size()));
+        buf.append(s);
+    }
+
+    std::string buf;
+};
+
+struct reader_type
+{
+    template< typename T > T get()
+    {
+        T x{ };
+
+        if (ok && size_t(end - p) >= sizeof x) {
+            memcpy(&x, p, sizeof x);
+            p += sizeof x;
+        } else {
+            ok = false;
+        }
+
+        return x;
+    }
+
+    uint32_t u32() { return get< uint32_t >(); }
+    int64_t  i64() { return get< int64_t >(); }
+
+    std::string str()
+    {
+        const size_t n = u32();
+
+        if (!ok || size_t(end - p) < n) {
+            ok = false;
+            return { };
+        }
+
+        std::string s(p, n);
+        p += n;
+
+        return s;
+    }
+
+    //
+    // A count of elements, each at least <size> bytes long:
+    //
+    uint32_t count(size_t size)
+    {
+        const uint32_t n = u32();
+
+        if (ok && n > size_t(end - p) / size)
+            ok = false;
+
+        return ok ? n : 0;
+    }
+
+    const char *p, *end;
+    bool        ok = true;
+};
+
+bool read_config_file(const fs::path &path,
+                      config_cache_t::config_file_type &lines)
+{
+    std::ifstream stream(path);
+
+    if (!stream.is_open())
+        return false;
+
+    int lineno = 1;
+
+    for (std::string line; std::getline(stream, line); ++lineno) {
+        auto tokens = tokenize_config_line(line);
+
+        if (tokens.empty() || (!tokens[0].empty() && tokens[0][0] == '#'))
+            continue;
+
+        lines.emplace_back(lineno, std::move(tokens));
+    }
+
+    return true;
+}
+
+bool read_name_to_unicode_file(const fs::path &path,
+                               config_cache_t::name_to_unicode_file_type &file)
+{
+    std::ifstream stream(path);
+
+    if (!stream.is_open())
+        return false;
+
+    int lineno = 1;
+
+    for (std::string line; std::getline(stream, line); ++lineno) {
+        auto tokens = xpdf::split(line);
+
+        if (2 != tokens.size()) {
+            file.badLines.push_back(lineno);
+            continue;
+        }
+
+        Unicode u = 0;
+        sscanf(tokens[0].c_str(), "%x", &u);
+
+        file.entries.emplace_back(std::move(tokens[1]), u);
+    }
+
+    return true;
+}
+
+bool read_font_dir(const fs::path &path, config_cache_t::font_dir_type &names)
+{
+    std::error_code ec;
+
+    for (fs::directory_iterator iter(path, ec), last; !ec && iter != last;
+         iter.increment(ec)) {
+        names.push_back(iter->path().filename().string());
+    }
+
+    std::sort(names.begin(), names.end());
+
+    return !ec;
+}
+
+} // anonymous namespace
+
+std::vector< std::string > tokenize_config_line(const std::string &line)
+{
+    std::vector< std::string > tokens;
+
+    const char *p1 = line.c_str(), *p2;
+
+    while (*p1) {
+        for (; *p1 && isspace(*p1); ++p1) ;
+
+        if (!*p1)
+            break;
+
+        if (*p1 == '"' || *p1 == '\'') {
+            for (p2 = p1 + 1; *p2 && *p2 != *p1; ++p2) ;
+            ++p1;
+        } else {
+            for (p2 = p1 + 1; *p2 && !isspace(*p2); ++p2) ;
+        }
+
+        tokens.emplace_back(p1, p2 - p1);
+        p1 = *p2 ? p2 + 1 : p2;
+    }
+
+    return tokens;
+}
+
+config_cache_t::config_cache_t(const fs::path &path)
+    : cacheFile(path)
+{
+    if (!load()) {
+        configFiles.clear();
+        nameToUnicodeFiles.clear();
+        fontDirs.clear();
+    }
+}
+
+bool config_cache_t::stamp(const fs::path &path, stamp_type &st)
+{
+    struct stat buf;
+
+    if (::stat(path.c_str(), &buf))
+        return false;
+
+    st.mtime = int64_t(buf.st_mtim.tv_sec) * 1000000000 + buf.st_mtim.tv_nsec;
+    st.size = buf.st_size;
+
+    return true;
+}
+
+template< typename T, typename F >
+const T *config_cache_t::lookup(entries_type< T > &entries, const fs::path &path,
+                                F read)
+{
+    stamp_type st;
+
+    if (!stamp(path, st))
+        return nullptr;
+
+    auto iter = entries.find(path.string());
+
+    //
+    // Once an entry is handed out, it stays as it is for this session:
+    //
+    if (iter != entries.end() &&
+        (iter->second.used || iter->second.stamp == st)) {
+        iter->second.used = true;
+        return &iter->second.value;
+    }
+
+    T value;
+
+    if (!read(path, value))
+        return nullptr;
+
+    auto &entry = entries[path.string()];
+
+    entry.stamp = st;
+    entry.value = std::move(value);
+    entry.used = true;
+
+    dirty = true;
+
+    return &entry.value;
+}
+
+const config_cache_t::config_file_type *
+config_cache_t::config_file(const fs::path &path)
+{
+    return lookup(configFiles, path, read_config_file);
+}
+
+const config_cache_t::name_to_unicode_file_type *
+config_cache_t::name_to_unicode_file(const fs::path &path)
+{
+    return lookup(nameToUnicodeFiles, path, read_name_to_unicode_file);
+}
+
+const config_cache_t::font_dir_type *config_cache_t::font_dir(const fs::path &path)
+{
+    return lookup(fontDirs, path, read_font_dir);
+}
+
+bool config_cache_t::load()
+{
+    std::string buf;
+
+    if (FILE *f = fopen(cacheFile.c_str(), "rb")) {
+        char   tmp[65536];
+        size_t n;
+
+        while ((n = fread(tmp, 1, sizeof tmp, f)) > 0)
+            buf.append(tmp, n);
+
+        fclose(f);
+    }
+
+    if (buf.size() < sizeof configCacheMagic + sizeof(uint32_t) ||
+        memcmp(buf.data(), configCacheMagic, sizeof configCacheMagic))
+        return false;
+
+    reader_type r{ buf.data() + sizeof configCacheMagic,
+                   buf.data() + buf.size() };
+
+    if (r.u32() != configCacheByteOrder)
+        return false;
+
+    const size_t minEntrySize = sizeof(uint32_t) + 2 * sizeof(int64_t);
+
+    for (uint32_t i = 0, n = r.count(minEntrySize); r.ok && i < n; ++i) {
+        auto &entry = configFiles[r.str()];
+
+        entry.stamp.mtime = r.i64();
+        entry.stamp.size = r.i64();
+
+        for (uint32_t j = 0, m = r.count(2 * sizeof(uint32_t)); r.ok && j < m;
+             ++j) {
+            auto &[lineno, tokens] = entry.value.emplace_back();
+
+            lineno = int(r.u32());
+
+            for (uint32_t k = 0, l = r.count(sizeof(uint32_t)); r.ok && k < l;
+                 ++k)
+                tokens.push_back(r.str());
+        }
+    }
+
+    for (uint32_t i = 0, n = r.count(minEntrySize); r.ok && i < n; ++i) {
+        auto &entry = nameToUnicodeFiles[r.str()];
+
+        entry.stamp.mtime = r.i64();
+        entry.stamp.size = r.i64();
+
+        for (uint32_t j = 0, m = r.count(2 * sizeof(uint32_t)); r.ok && j < m;
+             ++j) {
+            auto name = r.str();
+            entry.value.entries.emplace_back(std::move(name), r.u32());
+        }
+
+        for (uint32_t j = 0, m = r.count(sizeof(uint32_t)); r.ok && j < m; ++j)
+            entry.value.badLines.push_back(int(r.u32()));
+    }
+
+    for (uint32_t i = 0, n = r.count(minEntrySize); r.ok && i < n; ++i) {
+        auto &entry = fontDirs[r.str()];
+
+        entry.stamp.mtime = r.i64();
+        entry.stamp.size = r.i64();
+
+        for (uint32_t j = 0, m = r.count(sizeof(uint32_t)); r.ok && j < m; ++j)
+            entry.value.push_back(r.str());
+    }
+
+    return r.ok && r.p == r.end;
+}
+
+void config_cache_t::save() const
+{
+    if (cacheFile.empty())
+        return;
+
+    auto count_used = [](const auto &entries) {
+        uint32_t n = 0;
+
+        for (auto &[path, entry] : entries)
+            n += entry.used;
+
+        return n;
+    };
+
+    const uint32_t nConfigFiles = count_used(configFiles),
+                   nNameToUnicodeFiles = count_used(nameToUnicodeFiles),
+                   nFontDirs = count_used(fontDirs);
+
+    if (!dirty && nConfigFiles == configFiles.size() &&
+        nNameToUnicodeFiles == nameToUnicodeFiles.size() &&
+        nFontDirs == fontDirs.size())
+        return;
+
+    writer_type w;
+
+    w.buf.append(configCacheMagic, sizeof configCacheMagic);
+    w.u32(configCacheByteOrder);
+
+    w.u32(nConfigFiles);
+
+    for (auto &[path, entry] : configFiles) {
+        if (!entry.used)
+            continue;
+
+        w.str(path);
+        w.i64(entry.stamp.mtime);
+        w.i64(entry.stamp.size);
+        w.u32(uint32_t(entry.value.size()));
+
+        for (auto &[lineno, tokens] : entry.value) {
+            w.u32(uint32_t(lineno));
+            w.u32(uint32_t(tokens.size()));
+
+            for (auto &token : tokens)
+                w.str(token);
+        }
+    }
+
+    w.u32(nNameToUnicodeFiles);
+
+    for (auto &[path, entry] : nameToUnicodeFiles) {
+        if (!entry.used)
+            continue;
+
+        w.str(path);
+        w.i64(entry.stamp.mtime);
+        w.i64(entry.stamp.size);
+        w.u32(uint32_t(entry.value.entries.size()));
+
+        for (auto &[name, u] : entry.value.entries) {
+            w.str(name);
+            w.u32(u);
+        }
+
+        w.u32(uint32_t(entry.value.badLines.size()));
+
+        for (auto lineno : entry.value.badLines)
+            w.u32(uint32_t(lineno));
+    }
+
+    w.u32(nFontDirs);
+
+    for (auto &[path, entry] : fontDirs) {
+        if (!entry.used)
+            continue;
+
+        w.str(path);
+        w.i64(entry.stamp.mtime);
+        w.i64(entry.stamp.size);
+        w.u32(uint32_t(entry.value.size()));
+
+        for (auto &name : entry.value)
+            w.str(name);
+    }
+
+    //
+    // Write a temporary file and rename it, so a concurrent reader never
+    // sees a partial file.  The cache is only an optimization: failures are
+    // not reported.
+    //
+    std::error_code ec;
+    fs::create_directories(cacheFile.parent_path(), ec);
+
+    auto tmpPath = cacheFile;
+    tmpPath += "." + std::to_string(getpid()) + ".tmp";
+
+    if (FILE *f = fopen(tmpPath.c_str(), "wb")) {
+        bool ok = fwrite(w.buf.data(), 1, w.buf.size(), f) == w.buf.size();
+        ok = fclose(f) == 0 && ok;
+
+        if (!ok || rename(tmpPath.c_str(), cacheFile.c_str()))
+            remove(tmpPath.c_str());
+    }
+}
+
+} // namespace xpdf
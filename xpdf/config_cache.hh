@@ -0,0 +1,111 @@
+// -*- mode: c++; -*-
+// Copyright 2020- Thinkoid, LLC
+
+#ifndef XPDF_XPDF_CONFIG_CACHE_HH
+#define XPDF_XPDF_CONFIG_CACHE_HH
+
+#include <defs.hh>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <filesystem>
+namespace fs = std::filesystem;
+
+#include <xpdf/CharTypes.hh>
+
+namespace xpdf {
+
+//
+// Breaks a config file line into tokens; quoted tokens may contain blanks:
+//
+std::vector< std::string > tokenize_config_line(const std::string &);
+
+//
+// A snapshot of the files read while parsing the config: config files
+// (tokenized), nameToUnicode files (parsed) and font directories (listed).
+// Each entry is keyed by path and remembers the modification time and size
+// of its file; an entry whose file changed is read again.  The snapshot is
+// loaded from, and saved to, a cache file; entries not used in a session
+// are dropped when it is saved.
+//
+struct config_cache_t
+{
+    using tokens_type = std::vector< std::string >;
+
+    //
+    // Line numbers and tokens of the lines that are neither blank nor
+    // comments:
+    //
+    using config_file_type = std::vector< std::pair< int, tokens_type > >;
+
+    struct name_to_unicode_file_type
+    {
+        std::vector< std::pair< std::string, Unicode > > entries;
+        std::vector< int >                               badLines;
+    };
+
+    //
+    // File names in a directory, sorted:
+    //
+    using font_dir_type = std::vector< std::string >;
+
+    //
+    // A cache without a file only reads:
+    //
+    config_cache_t() = default;
+    explicit config_cache_t(const fs::path &);
+
+    //
+    // The contents of the file or directory, or nullptr if it cannot be
+    // read.  The pointers stay valid for the lifetime of the cache:
+    //
+    const config_file_type *          config_file(const fs::path &);
+    const name_to_unicode_file_type * name_to_unicode_file(const fs::path &);
+    const font_dir_type *             font_dir(const fs::path &);
+
+    //
+    // Writes the cache file if anything was read or dropped:
+    //
+    void save() const;
+
+private:
+    struct stamp_type
+    {
+        int64_t mtime = -1; // ns
+        int64_t size = -1;
+
+        bool operator==(const stamp_type &) const = default;
+    };
+
+    template< typename T > struct entry_type
+    {
+        stamp_type stamp;
+        T          value;
+        bool       used = false;
+    };
+
+    template< typename T >
+    using entries_type = std::map< std::string, entry_type< T > >;
+
+    static bool stamp(const fs::path &, stamp_type &);
+
+    template< typename T, typename F >
+    const T *lookup(entries_type< T > &, const fs::path &, F);
+
+    bool load();
+
+    fs::path cacheFile;
+    bool     dirty = false;
+
+    entries_type< config_file_type >          configFiles;
+    entries_type< name_to_unicode_file_type > nameToUnicodeFiles;
+    entries_type< font_dir_type >             fontDirs;
+};
+
+} // namespace xpdf
+
+#endif // XPDF_XPDF_CONFIG_CACHE_HH
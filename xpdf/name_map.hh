@@ -0,0 +1,250 @@
+// -*- mode: c++; -*-
+// Copyright 2020- Thinkoid, LLC
+
+#ifndef XPDF_XPDF_NAME_MAP_HH
+#define XPDF_XPDF_NAME_MAP_HH
+
+#include <defs.hh>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+//
+// Constant tables keyed by glyph name, hashed by the compiler: each
+// name's bucket (top bits of the hash) holds a displacement for which all
+// names in that bucket land in distinct free slots ("hash and displace").
+// A lookup is one pass over the name, two table loads and one comparison;
+// there is no work at startup.  Of duplicate names, the first one wins.
+//
+namespace xpdf {
+namespace detail {
+
+constexpr uint64_t name_hash(std::string_view s)
+{
+    uint64_t h = 14695981039346656037ULL;
+
+    for (auto c : s) {
+        h ^= (unsigned char)c;
+        h *= 1099511628211ULL;
+    }
+
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+
+    return h;
+}
+
+constexpr size_t name_slot(uint64_t h, uint32_t d, size_t mask)
+{
+    return (uint32_t(h) + d * (uint32_t(h >> 32) | 1)) & mask;
+}
+
+constexpr size_t name_bucket(uint64_t h, size_t mask)
+{
+    return (h >> 52) & mask;
+}
+
+constexpr size_t ceil2(size_t n)
+{
+    size_t m = 1;
+
+    for (; m < n; m <<= 1)
+        ;
+
+    return m;
+}
+
+} // namespace detail
+
+//
+// Non-owning, size-erased handle on a name_map_t:
+//
+template< typename T > class name_map_view_t
+{
+public:
+    using value_type = std::pair< std::string_view, T >;
+
+    constexpr name_map_view_t(const value_type *entries, size_t size,
+                              const uint16_t *slots, size_t slotMask,
+                              const uint16_t *disps, size_t bucketMask)
+        : entries_(entries), size_(size), slots_(slots), slotMask_(slotMask),
+          disps_(disps), bucketMask_(bucketMask)
+    { }
+
+    //
+    // Value for name, or nullptr if the name is not in the table:
+    //
+    constexpr const T *find(std::string_view s) const
+    {
+        const uint64_t h = detail::name_hash(s);
+
+        const size_t i = slots_[detail::name_slot(
+            h, disps_[detail::name_bucket(h, bucketMask_)], slotMask_)];
+
+        return i < size_ && entries_[i].first == s ? &entries_[i].second
+                                                   : nullptr;
+    }
+
+private:
+    const value_type *entries_;
+    size_t            size_;
+    const uint16_t *  slots_;
+    size_t            slotMask_;
+    const uint16_t *  disps_;
+    size_t            bucketMask_;
+};
+
+template< typename T, size_t N > class name_map_t
+{
+    static_assert(N < 0xffff);
+
+public:
+    using value_type = std::pair< std::string_view, T >;
+
+    //
+    // From a table of (name, value) pairs:
+    //
+    constexpr name_map_t(const value_type (&arr)[N])
+    {
+        for (size_t i = 0; i < N; ++i)
+            entries_[i] = arr[i];
+
+        build();
+    }
+
+    //
+    // From an encoding, i.e., a table of names indexed by character
+    // code; null names are skipped:
+    //
+    constexpr name_map_t(const char *const (&arr)[N])
+    {
+        for (size_t i = 0; i < N; ++i)
+            entries_[i] = value_type(arr[i] ? arr[i] : "", T(i));
+
+        build();
+    }
+
+    constexpr const T *find(std::string_view s) const
+    {
+        return view().find(s);
+    }
+
+    constexpr name_map_view_t< T > view() const
+    {
+        return { entries_.data(), N,           slots_.data(), slotCount - 1,
+                 disps_.data(),   bucketCount - 1 };
+    }
+
+    constexpr operator name_map_view_t< T >() const { return view(); }
+
+private:
+    static constexpr size_t slotCount = detail::ceil2(N + N / 2);
+    static constexpr size_t bucketCount = detail::ceil2(N / 4 + 1);
+
+    constexpr void build()
+    {
+        std::array< uint64_t, N > hashes{};
+        std::array< uint16_t, N > order{};
+        std::array< uint16_t, bucketCount + 1 > first{};
+        std::array< uint16_t, bucketCount > buckets{};
+
+        //
+        // Group the names by bucket, in table order:
+        //
+        for (size_t i = 0; i < N; ++i) {
+            hashes[i] = detail::name_hash(entries_[i].first);
+            ++first[detail::name_bucket(hashes[i], bucketCount - 1) + 1];
+        }
+
+        for (size_t b = 0; b < bucketCount; ++b)
+            first[b + 1] += first[b];
+
+        {
+            std::array< uint16_t, bucketCount + 1 > next = first;
+
+            for (size_t i = 0; i < N; ++i)
+                order[next[detail::name_bucket(hashes[i], bucketCount - 1)]++] =
+                    uint16_t(i);
+        }
+
+        for (auto &x : slots_)
+            x = uint16_t(N);
+
+        //
+        // Place the largest buckets first, while the table is empty:
+        //
+        for (size_t b = 0; b < bucketCount; ++b)
+            buckets[b] = uint16_t(b);
+
+        std::sort(buckets.begin(), buckets.end(), [&](auto a, auto b) {
+            return first[a + 1] - first[a] > first[b + 1] - first[b];
+        });
+
+        for (auto b : buckets) {
+            std::array< uint16_t, 32 > keys{};
+            size_t                     n = 0;
+
+            for (size_t j = first[b]; j < first[b + 1]; ++j) {
+                const auto i = order[j];
+
+                if (entries_[i].first.empty())
+                    continue;
+
+                bool dup = false;
+
+                for (size_t k = 0; k < n; ++k)
+                    dup = dup || entries_[keys[k]].first == entries_[i].first;
+
+                if (!dup) {
+                    if (n == keys.size())
+                        throw "name_map_t: bucket overflow";
+
+                    keys[n++] = i;
+                }
+            }
+
+            for (uint32_t d = 0;; ++d) {
+                if (d == 0xffff)
+                    throw "name_map_t: no displacement found";
+
+                bool ok = true;
+
+                for (size_t k = 0; ok && k < n; ++k) {
+                    const auto s = detail::name_slot(hashes[keys[k]], d,
+                                                     slotCount - 1);
+
+                    ok = slots_[s] == N;
+
+                    for (size_t m = 0; ok && m < k; ++m)
+                        ok = s != detail::name_slot(hashes[keys[m]], d,
+                                                    slotCount - 1);
+                }
+
+                if (ok) {
+                    for (size_t k = 0; k < n; ++k)
+                        slots_[detail::name_slot(hashes[keys[k]], d,
+                                                 slotCount - 1)] = keys[k];
+
+                    disps_[b] = uint16_t(d);
+                    break;
+                }
+            }
+        }
+    }
+
+    std::array< value_type, N >          entries_{};
+    std::array< uint16_t, slotCount >   slots_{};
+    std::array< uint16_t, bucketCount > disps_{};
+};
+
+template< typename T, size_t N >
+name_map_t(const std::pair< std::string_view, T > (&)[N]) -> name_map_t< T, N >;
+
+} // namespace xpdf
+
+#endif // XPDF_XPDF_NAME_MAP_HH
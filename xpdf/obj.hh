@@ -10,6 +10,7 @@
 #include <cstdio>
 #include <cstring>
 
+#include <functional>
 #include <memory>
 #include <variant>
 
@@ -120,6 +121,19 @@ inline bool operator!=(const ref_t &lhs, const ref_t &rhs)
     return !(lhs == rhs);
 }
 
+//
+// Hashes the object number and generation, consistent with operator==:
+//
+struct ref_hash_t
+{
+    size_t operator()(const ref_t &ref) const
+    {
+        return std::hash< unsigned long long >()(
+            (static_cast< unsigned long long >(unsigned(ref.num)) << 32) |
+            unsigned(ref.gen));
+    }
+};
+
 struct obj_t
 {
     obj_t() noexcept
@@ -0,0 +1,176 @@
+// -*- mode: c++; -*-
+// Copyright 2019-2020 Thinkoid, LLC.
+
+#include <defs.hh>
+
+#include <algorithm>
+#include <cmath>
+
+#include <xpdf/rect_index.hh>
+
+namespace xpdf {
+namespace {
+
+// Upper bound on the number of rows and columns of the grid:
+const size_t max_grid_side = 256;
+
+inline bool contains(const bbox_t &box, double x, double y)
+{
+    return box.xmin <= x && x <= box.xmax && box.ymin <= y && y <= box.ymax;
+}
+
+inline bool intersects(const bbox_t &lhs, const bbox_t &rhs)
+{
+    return lhs.xmin <= rhs.xmax && rhs.xmin <= lhs.xmax &&
+           lhs.ymin <= rhs.ymax && rhs.ymin <= lhs.ymax;
+}
+
+} // anonymous namespace
+
+rect_index_t::rect_index_t(std::vector< bbox_t > boxes_)
+    : boxes(std::move(boxes_))
+{
+    if (boxes.empty()) {
+        return;
+    }
+
+    for (auto &box : boxes) {
+        box = detail::normalize(box);
+    }
+
+    extent = boxes.front();
+
+    for (const auto &box : boxes) {
+        extent += box;
+    }
+
+    //
+    // About one box per cell, on a square grid; degenerate extents collapse
+    // to a single row or column:
+    //
+    const auto side = (std::min)(
+        max_grid_side, size_t(std::ceil(std::sqrt(double(boxes.size())))));
+
+    const auto w = width_of(extent), h = height_of(extent);
+
+    columns = w > 0 ? side : 1;
+    rows = h > 0 ? side : 1;
+
+    cell_width = w > 0 ? w / columns : 1;
+    cell_height = h > 0 ? h / rows : 1;
+
+    cells.resize(columns * rows);
+
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        const auto &box = boxes[i];
+
+        const auto c0 = column_of(box.xmin), c1 = column_of(box.xmax);
+        const auto r0 = row_of(box.ymin), r1 = row_of(box.ymax);
+
+        for (auto r = r0; r <= r1; ++r) {
+            for (auto c = c0; c <= c1; ++c) {
+                cells[r * columns + c].push_back(i);
+            }
+        }
+    }
+}
+
+size_t rect_index_t::column_of(double x) const
+{
+    const auto n = std::floor((x - extent.xmin) / cell_width);
+    return n <= 0 ? 0 : (std::min)(columns - 1, size_t(n));
+}
+
+size_t rect_index_t::row_of(double y) const
+{
+    const auto n = std::floor((y - extent.ymin) / cell_height);
+    return n <= 0 ? 0 : (std::min)(rows - 1, size_t(n));
+}
+
+const std::vector< size_t > &rect_index_t::cell_at(double x, double y) const
+{
+    return cells[row_of(y) * columns + column_of(x)];
+}
+
+std::vector< size_t > rect_index_t::find(double x, double y) const
+{
+    std::vector< size_t > result;
+
+    if (boxes.empty() || !contains(extent, x, y)) {
+        return result;
+    }
+
+    for (auto i : cell_at(x, y)) {
+        if (contains(boxes[i], x, y)) {
+            result.push_back(i);
+        }
+    }
+
+    return result;
+}
+
+std::vector< size_t > rect_index_t::find(const bbox_t &box_) const
+{
+    std::vector< size_t > result;
+
+    const auto box = detail::normalize(box_);
+
+    if (boxes.empty() || !intersects(extent, box)) {
+        return result;
+    }
+
+    const auto c0 = column_of(box.xmin), c1 = column_of(box.xmax);
+    const auto r0 = row_of(box.ymin), r1 = row_of(box.ymax);
+
+    for (auto r = r0; r <= r1; ++r) {
+        for (auto c = c0; c <= c1; ++c) {
+            for (auto i : cells[r * columns + c]) {
+                if (intersects(boxes[i], box)) {
+                    result.push_back(i);
+                }
+            }
+        }
+    }
+
+    //
+    // Boxes spanning several cells are reported once per cell:
+    //
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+
+    return result;
+}
+
+long rect_index_t::find_first(double x, double y) const
+{
+    if (boxes.empty() || !contains(extent, x, y)) {
+        return -1;
+    }
+
+    for (auto i : cell_at(x, y)) {
+        if (contains(boxes[i], x, y)) {
+            return long(i);
+        }
+    }
+
+    return -1;
+}
+
+long rect_index_t::find_last(double x, double y) const
+{
+    if (boxes.empty() || !contains(extent, x, y)) {
+        return -1;
+    }
+
+    const auto &cell = cell_at(x, y);
+
+    for (auto iter = cell.rbegin(); iter != cell.rend(); ++iter) {
+        if (contains(boxes[*iter], x, y)) {
+            return long(*iter);
+        }
+    }
+
+    return -1;
+}
+
+} // namespace xpdf
@@ -0,0 +1,67 @@
+// -*- mode: c++; -*-
+// Copyright 2019-2020 Thinkoid, LLC.
+
+#ifndef XPDF_XPDF_RECT_INDEX_HH
+#define XPDF_XPDF_RECT_INDEX_HH
+
+#include <defs.hh>
+
+#include <cstddef>
+#include <vector>
+
+#include <xpdf/bbox.hh>
+
+namespace xpdf {
+
+//
+// Spatial index over a fixed set of (normalized) boxes. The boxes are bucketed
+// into a uniform grid sized after the number of boxes, so that point queries
+// only test the few boxes sharing the grid cell of the point. Boxes are
+// identified by their position in the sequence given at construction, and all
+// queries report them in ascending order. Box edges are inclusive, matching
+// Link::inRect:
+//
+struct rect_index_t
+{
+    rect_index_t() = default;
+    explicit rect_index_t(std::vector< bbox_t >);
+
+    bool empty() const { return boxes.empty(); }
+    size_t size() const { return boxes.size(); }
+
+    //
+    // Positions of the boxes containing the point, respectively intersecting
+    // the box:
+    //
+    std::vector< size_t > find(double x, double y) const;
+    std::vector< size_t > find(const bbox_t &) const;
+
+    //
+    // Position of the first (lowest) or last (highest) box containing the
+    // point, or -1 if none:
+    //
+    long find_first(double x, double y) const;
+    long find_last(double x, double y) const;
+
+private:
+    const std::vector< size_t > &cell_at(double x, double y) const;
+
+    size_t column_of(double) const;
+    size_t row_of(double) const;
+
+private:
+    std::vector< bbox_t > boxes;
+
+    // Union of all boxes, the area covered by the grid:
+    bbox_t extent{};
+
+    size_t columns = 0, rows = 0;
+    double cell_width = 1, cell_height = 1;
+
+    // Row-major grid of cells, each with an ascending list of box positions:
+    std::vector< std::vector< size_t > > cells;
+};
+
+} // namespace xpdf
+
+#endif // XPDF_XPDF_RECT_INDEX_HH